@@ -62,7 +62,7 @@ private:
     void send_ws_pong(intptr_t fd, const std::string& payload);
     void close_socket(intptr_t fd);
 
-    void on_market_tick(const void* data, size_t size);
+    void on_market_tick(const MarketTick& tick);
     void broadcast_json_event(const std::string& payload);
 
     bool parse_order_json(const std::string& body, Order* out_order) const;
@@ -90,6 +90,7 @@ private:
     std::thread accept_thread_;
     std::vector<std::thread> client_threads_;
     std::atomic<bool> running_{false};
+    bus::SubscriptionId market_subscription_ = bus::kInvalidSubscription;
 
     struct IpRateState {
         std::chrono::steady_clock::time_point window_start{};
@@ -9,6 +9,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace argentum::persist {
@@ -44,6 +45,7 @@ struct GatewayMetrics {
     uint64_t auth_failures = 0;
     uint64_t rate_limited = 0;
     uint64_t tracked_symbols = 0;
+    uint64_t unknown_symbol_ticks = 0; // ticks whose symbol is not in the instrument registry
 };
 
 struct OrderAck {
@@ -88,6 +90,13 @@ public:
     void reset_metrics();
 
 private:
+    struct SymbolHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
     struct RateWindowState {
         std::chrono::steady_clock::time_point window_start{};
         uint32_t requests = 0;
@@ -95,17 +104,20 @@ private:
 
     bool consume_rate_limit(const std::string& key);
     bool token_allowed_unlocked(const std::string& token, uint64_t now_ns);
-    void on_market_message(const void* data, size_t size);
-    static std::string normalize_key(const char* symbol);
+    void on_market_tick(const MarketTick& tick);
+    void on_market_decode_error();
+    uint32_t resolve_instrument_unlocked(const MarketTick& tick);
 
     std::shared_ptr<bus::MessageBus> bus_;
     std::shared_ptr<persist::EventJournal> journal_;
     std::string market_topic_;
     GatewaySecurityConfig security_;
     std::atomic<bool> started_{false};
+    bus::SubscriptionId market_subscription_ = bus::kInvalidSubscription;
 
     mutable std::mutex mutex_;
-    std::unordered_map<std::string, MarketTick> latest_ticks_;
+    std::unordered_map<uint32_t, MarketTick> latest_ticks_; // by instrument_id_for_symbol()
+    std::unordered_map<std::string, uint32_t, SymbolHash, std::equal_to<>> symbol_ids_; // bus spelling -> id
     std::unordered_map<std::string, uint64_t> token_expiry_ns_;
     std::unordered_map<std::string, RateWindowState> rate_windows_;
     std::atomic<uint64_t> ticks_received_{0};
@@ -116,6 +128,7 @@ private:
     std::atomic<uint64_t> order_rejected_{0};
     std::atomic<uint64_t> auth_failures_{0};
     std::atomic<uint64_t> rate_limited_{0};
+    std::atomic<uint64_t> unknown_symbol_ticks_{0};
 };
 
 OrderAck submit_order(trading::OrderManager& manager, const Order& order);
@@ -4,6 +4,7 @@
 #include "codec/market_tick_codec.hpp"
 #include "core/fixed_point.hpp"
 #include "core/time_utils.hpp"
+#include "datafeed/normalizer.h"
 
 #include <algorithm>
 #include <array>
@@ -131,7 +132,7 @@ std::string base64_encode(const uint8_t* data, size_t len) {
     return out;
 }
 
-bool parse_double_field(const std::string& json, const std::string& key, double* out) {
+bool parse_scaled_field(const std::string& json, const std::string& key, int scale_digits, int64_t* out) {
     if (!out) return false;
     const std::string marker = "\"" + key + "\"";
     size_t pos = json.find(marker);
@@ -148,8 +149,7 @@ bool parse_double_field(const std::string& json, const std::string& key, double*
         ++end;
     }
     if (end == pos) return false;
-    *out = std::strtod(json.substr(pos, end - pos).c_str(), nullptr);
-    return true;
+    return core::parse_scaled(std::string_view(json).substr(pos, end - pos), scale_digits, out);
 }
 
 bool parse_u64_field(const std::string& json, const std::string& key, uint64_t* out) {
@@ -272,7 +272,8 @@ bool HttpWsServer::start() {
     listen_fd_ = static_cast<intptr_t>(listener);
 
     if (bus_) {
-        bus_->subscribe(market_topic_, [this](const void* data, size_t size) { on_market_tick(data, size); });
+        bus::MarketTickTopic ticks(bus_, market_topic_);
+        market_subscription_ = ticks.subscribe([this](const MarketTick& tick) { on_market_tick(tick); });
     }
 
     accept_thread_ = std::thread([this] { accept_loop(); });
@@ -282,6 +283,11 @@ bool HttpWsServer::start() {
 void HttpWsServer::stop() {
     if (!running_.exchange(false, std::memory_order_relaxed)) return;
 
+    if (bus_ && market_subscription_ != bus::kInvalidSubscription) {
+        bus_->unsubscribe(market_topic_, market_subscription_);
+        market_subscription_ = bus::kInvalidSubscription;
+    }
+
     if (listen_fd_ != -1) {
         closesocket(static_cast<SOCKET>(listen_fd_));
         listen_fd_ = -1;
@@ -681,9 +687,7 @@ void HttpWsServer::close_socket(intptr_t fd) {
     closesocket(static_cast<SOCKET>(fd));
 }
 
-void HttpWsServer::on_market_tick(const void* data, size_t size) {
-    MarketTick tick{};
-    if (codec::decode_market_tick(data, size, &tick) != ARGENTUM_OK) return;
+void HttpWsServer::on_market_tick(const MarketTick& tick) {
     broadcast_json_event(to_json(tick));
 }
 
@@ -711,8 +715,8 @@ bool HttpWsServer::parse_order_json(const std::string& body, Order* out_order) c
     std::string side;
     std::string type;
     std::string tif = "gtc";
-    double price = 0.0;
-    double quantity = 0.0;
+    int64_t price_ticks = 0;
+    int64_t quantity_lots = 0;
 
     if (!parse_u64_field(body, "order_id", &order.order_id)) return false;
     (void)parse_u64_field(body, "client_id", &order.client_id);
@@ -720,18 +724,19 @@ bool HttpWsServer::parse_order_json(const std::string& body, Order* out_order) c
     if (!parse_string_field(body, "side", &side)) return false;
     if (!parse_string_field(body, "type", &type)) return false;
     (void)parse_string_field(body, "time_in_force", &tif);
-    if (!parse_double_field(body, "quantity", &quantity)) return false;
-    const bool has_price = parse_double_field(body, "price", &price);
+    if (!parse_scaled_field(body, "quantity", core::kQuantityScaleDigits, &quantity_lots)) return false;
+    const bool has_price = parse_scaled_field(body, "price", core::kPriceScaleDigits, &price_ticks);
     if (!has_price) {
-        price = 0.0;
+        price_ticks = 0;
     }
 
     order.timestamp_ns = core::unix_now_ns();
-    order.price = price;
-    order.quantity = quantity;
-    order.price_ticks = core::to_price_ticks(price);
-    order.quantity_lots = core::to_quantity_lots(quantity);
+    order.price_ticks = price_ticks;
+    order.quantity_lots = quantity_lots;
+    order.price = core::from_price_ticks(price_ticks);
+    order.quantity = core::from_quantity_lots(quantity_lots);
     std::strncpy(order.symbol, symbol.c_str(), sizeof(order.symbol) - 1);
+    order.instrument_id = instrument_id_for_symbol(symbol.data(), symbol.size(), 0);
 
     const std::string side_lc = to_lower(side);
     if (side_lc == "buy" || side_lc == "b") {
@@ -764,8 +769,8 @@ bool HttpWsServer::parse_order_json(const std::string& body, Order* out_order) c
         return false;
     }
 
-    if (quantity <= 0.0) return false;
-    if (price <= 0.0) return false;
+    if (quantity_lots <= 0) return false;
+    if (price_ticks <= 0) return false;
 
     *out_order = order;
     return true;
@@ -932,6 +937,8 @@ std::string HttpWsServer::openmetrics_from_gateway(const GatewayMetrics& metrics
     os << "argentum_active_orders " << active_orders << "\n";
     os << "# TYPE argentum_tracked_symbols gauge\n";
     os << "argentum_tracked_symbols " << metrics.tracked_symbols << "\n";
+    os << "# TYPE argentum_unknown_symbol_ticks_total counter\n";
+    os << "argentum_unknown_symbol_ticks_total " << metrics.unknown_symbol_ticks << "\n";
     return os.str();
 }
 
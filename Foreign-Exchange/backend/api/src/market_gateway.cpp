@@ -3,9 +3,11 @@
 #include "codec/market_tick_codec.hpp"
 #include "core/time_utils.hpp"
 #include "core/fixed_point.hpp"
+#include "core/instrument_registry.hpp"
+#include "datafeed/normalizer.h"
 #include "persist/event_journal.hpp"
 
-#include <cctype>
+#include <cstring>
 #include <functional>
 #include <sstream>
 
@@ -28,6 +30,11 @@ std::string json_escape(const char* raw) {
     }
     return out;
 }
+
+size_t symbol_length(const char* symbol, size_t capacity) {
+    const void* nul = std::memchr(symbol, '\0', capacity);
+    return nul ? static_cast<size_t>(static_cast<const char*>(nul) - symbol) : capacity;
+}
 } // namespace
 
 MarketGatewayService::MarketGatewayService(
@@ -57,32 +64,62 @@ void MarketGatewayService::start() {
         return;
     }
 
-    bus_->subscribe(market_topic_, [this](const void* data, size_t size) { on_market_message(data, size); });
+    bus::MarketTickTopic ticks(bus_, market_topic_);
+    market_subscription_ = ticks.subscribe(
+        [this](const MarketTick& tick) { on_market_tick(tick); },
+        [this](ArgentumStatus) { on_market_decode_error(); });
 }
 
 void MarketGatewayService::stop() {
-    started_.store(false, std::memory_order_relaxed);
+    if (!started_.exchange(false, std::memory_order_relaxed)) {
+        return;
+    }
+    if (bus_ && market_subscription_ != bus::kInvalidSubscription) {
+        bus_->unsubscribe(market_topic_, market_subscription_);
+        market_subscription_ = bus::kInvalidSubscription;
+    }
 }
 
-void MarketGatewayService::on_market_message(const void* data, size_t size) {
+void MarketGatewayService::on_market_decode_error() {
     if (!started_.load(std::memory_order_relaxed)) return;
     ticks_received_.fetch_add(1, std::memory_order_relaxed);
+    decode_errors_.fetch_add(1, std::memory_order_relaxed);
+}
 
-    MarketTick tick{};
-    if (codec::decode_market_tick(data, size, &tick) != ARGENTUM_OK) {
-        decode_errors_.fetch_add(1, std::memory_order_relaxed);
-        return;
-    }
+void MarketGatewayService::on_market_tick(const MarketTick& tick) {
+    if (!started_.load(std::memory_order_relaxed)) return;
+    ticks_received_.fetch_add(1, std::memory_order_relaxed);
 
     std::lock_guard<std::mutex> lock(mutex_);
-    latest_ticks_[normalize_key(tick.symbol)] = tick;
+    const uint32_t id = resolve_instrument_unlocked(tick);
+    if (id != core::InstrumentRegistry::kInvalidId) {
+        latest_ticks_[id] = tick;
+    } else {
+        unknown_symbol_ticks_.fetch_add(1, std::memory_order_relaxed);
+    }
     ticks_decoded_.fetch_add(1, std::memory_order_relaxed);
 }
 
+uint32_t MarketGatewayService::resolve_instrument_unlocked(const MarketTick& tick) {
+    // Feed-parsed ticks arrive resolved. Decoded V2 frames carry only the symbol, which is
+    // resolved against the process tables once per spelling and then served from symbol_ids_.
+    // Bus symbols are only looked up: instruments are registered from configuration or the
+    // instrument master, so a bad publisher cannot fill the registry.
+    if (tick.instrument_id != core::InstrumentRegistry::kInvalidId) return tick.instrument_id;
+    const std::string_view symbol(tick.symbol, symbol_length(tick.symbol, sizeof(tick.symbol)));
+    auto it = symbol_ids_.find(symbol);
+    if (it != symbol_ids_.end()) return it->second;
+    const uint32_t id = instrument_id_for_symbol(symbol.data(), symbol.size(), 0);
+    if (id != core::InstrumentRegistry::kInvalidId) symbol_ids_.emplace(symbol, id);
+    return id;
+}
+
 bool MarketGatewayService::get_latest_tick(const std::string& symbol, MarketTick* out) const {
     if (!out) return false;
+    const uint32_t id = instrument_id_for_symbol(symbol.data(), symbol.size(), 0);
+    if (id == core::InstrumentRegistry::kInvalidId) return false;
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = latest_ticks_.find(normalize_key(symbol.c_str()));
+    auto it = latest_ticks_.find(id);
     if (it == latest_ticks_.end()) return false;
     *out = it->second;
     return true;
@@ -225,6 +262,7 @@ GatewayMetrics MarketGatewayService::metrics() const {
     out.order_rejected = order_rejected_.load(std::memory_order_relaxed);
     out.auth_failures = auth_failures_.load(std::memory_order_relaxed);
     out.rate_limited = rate_limited_.load(std::memory_order_relaxed);
+    out.unknown_symbol_ticks = unknown_symbol_ticks_.load(std::memory_order_relaxed);
 
     std::lock_guard<std::mutex> lock(mutex_);
     out.tracked_symbols = latest_ticks_.size();
@@ -240,6 +278,7 @@ void MarketGatewayService::reset_metrics() {
     order_rejected_.store(0, std::memory_order_relaxed);
     auth_failures_.store(0, std::memory_order_relaxed);
     rate_limited_.store(0, std::memory_order_relaxed);
+    unknown_symbol_ticks_.store(0, std::memory_order_relaxed);
 }
 
 void MarketGatewayService::emit_gateway_reject_event(
@@ -270,16 +309,6 @@ void MarketGatewayService::emit_gateway_reject_event(
     (void)journal_->append(event);
 }
 
-std::string MarketGatewayService::normalize_key(const char* symbol) {
-    std::string key;
-    if (!symbol) return key;
-    for (const char* p = symbol; *p != '\0'; ++p) {
-        if (*p == '/' || *p == '-' || *p == '_' || *p == ' ') continue;
-        key.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(*p))));
-    }
-    return key;
-}
-
 OrderAck submit_order(trading::OrderManager& manager, const Order& order) {
     trading::OrderSubmissionResult result = manager.submit_order(order);
     return {
@@ -384,6 +413,7 @@ std::string to_json(const GatewayMetrics& metrics, bool running) {
        << ",\"auth_failures\":" << metrics.auth_failures
        << ",\"rate_limited\":" << metrics.rate_limited
        << ",\"tracked_symbols\":" << metrics.tracked_symbols
+       << ",\"unknown_symbol_ticks\":" << metrics.unknown_symbol_ticks
        << "}";
     return os.str();
 }
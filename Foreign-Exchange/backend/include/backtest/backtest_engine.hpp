@@ -30,8 +30,19 @@ public:
      */
     void load_data(const std::string& symbol, const std::string& start_date, const std::string& end_date);
     bool load_ticks_from_csv(const std::string& csv_path, const std::string& symbol = "");
+    /**
+     * @brief Loads ticks from a columnar tick store (persist/tick_store.hpp); segments are
+     * mapped and read column-wise, with no text parsing.
+     */
+    bool load_ticks_from_store(const std::string& root, const std::string& symbol = "");
     bool load_trades_from_journal(const std::string& journal_path);
 
+    /**
+     * @brief Ticks loaded with instrument_id 0 because their symbol is not in the instrument
+     * registry. Loaders register only the requested symbol, never symbols read from data.
+     */
+    uint64_t unknown_symbol_ticks() const { return unknown_symbol_ticks_; }
+
     /**
      * @brief Runs the simulation with a specific strategy.
      */
@@ -47,6 +58,7 @@ private:
     std::vector<MarketTick> history_;
     std::vector<HistoricalTrade> trades_;
     double initial_capital_ = 100000.0;
+    uint64_t unknown_symbol_ticks_ = 0;
 };
 
 } // namespace argentum::backtest
@@ -1,16 +1,52 @@
 #pragma once
 
+#include "bus/wait_strategy.hpp"
 #include "core/errors.h"
+#include "core/latency_histogram.hpp"
 
 #include <string>
 #include <functional>
 #include <vector>
 #include <memory>
+#include <unordered_map>
 #include <cstdint>
 #include <cstddef>
 
 namespace argentum::bus {
 
+using MessageCallback = std::function<void(const void* data, size_t size)>;
+
+// Conflation key. 16 bytes so a short identifier (e.g. a SYMBOL_LEN symbol) fits verbatim
+// and distinct identifiers never share a key.
+struct ConflationKey {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    bool operator==(const ConflationKey&) const = default;
+};
+
+// Extracts a conflation key from a payload; return false to enqueue the message unconflated.
+using ConflationKeyFn = std::function<bool(const void* data, size_t size, ConflationKey* key)>;
+
+/**
+ * @brief Type-erased codec for typed topics (see bus/typed_topic.hpp).
+ * One static instance exists per (T, Codec); its address identifies the value type.
+ * Values must be trivially copyable and fit kMaxTypedValueBytes / kMaxTypedValueAlign.
+ */
+struct TypedCodecOps {
+    size_t value_size;
+    ArgentumStatus (*encode)(const void* value, std::vector<uint8_t>* out);
+    ArgentumStatus (*decode)(const void* data, size_t size, void* out_value);
+};
+constexpr size_t kMaxTypedValueBytes = 256;
+constexpr size_t kMaxTypedValueAlign = 64;
+
+using TypedCallback = std::function<void(const void* value)>;
+using DecodeErrorCallback = std::function<void(ArgentumStatus status)>;
+
+// Token returned by subscribe(); 0 is never issued.
+using SubscriptionId = uint64_t;
+constexpr SubscriptionId kInvalidSubscription = 0;
+
 enum class BackpressurePolicy {
     DropNewest = 0,
     DropOldest = 1,
@@ -22,6 +58,25 @@ struct InprocBusConfig {
     BackpressurePolicy policy = BackpressurePolicy::DropNewest;
     uint32_t block_timeout_ms = 0; // 0 = wait indefinitely
     uint32_t consumer_threads = 1;
+    ConsumerWaitConfig wait{};                                       // default for every topic
+    std::unordered_map<std::string, ConsumerWaitConfig> topic_wait; // per-topic overrides (e.g. "market.ticks")
+    // Conflated (last-value) topics: a message whose key is already queued replaces the queued
+    // payload in place, so depth is bounded by key cardinality (still capped by queue_capacity).
+    std::unordered_map<std::string, ConflationKeyFn> topic_conflation;
+};
+
+struct ShmBusConfig {
+    std::string region_name;              // e.g. "argentum_bus"; empty = map on connect("shm://name")
+    uint32_t max_topics = 16;
+    uint32_t slots_per_topic = 4096;      // rounded up to a power of two
+    uint32_t slot_payload_bytes = 256;    // larger messages are rejected with ARGENTUM_ERR_RANGE
+    uint32_t max_consumers_per_topic = 8; // consumer cursors (one per subscribing process/topic); subscribe fails when all are claimed
+    BackpressurePolicy policy = BackpressurePolicy::DropNewest;
+    uint32_t block_timeout_ms = 0;        // 0 = wait indefinitely
+    bool reset_existing = false;          // unlink a stale region with the same name before mapping
+    bool unlink_on_close = false;         // remove the named region when this instance is destroyed
+    ConsumerWaitConfig wait{WaitStrategy::SpinPark, 2048};
+    std::unordered_map<std::string, ConsumerWaitConfig> topic_wait; // per-topic overrides for local consumers
 };
 
 struct TopicMetrics {
@@ -29,8 +84,15 @@ struct TopicMetrics {
     uint64_t drops = 0;
     uint64_t backpressure_hits = 0;
     uint64_t published = 0;
+    uint64_t conflated = 0; // messages merged into an already-queued message with the same key
     uint64_t publish_latency_ns_avg = 0;
     uint64_t publish_latency_ns_max = 0;
+    uint64_t wait_spins = 0;  // consumer pause iterations while idle
+    uint64_t wait_yields = 0; // consumer time-slice yields while idle
+    uint64_t wait_parks = 0;  // consumer OS parks (condition variable / futex waits)
+    core::LatencyPercentiles publish_latency; // publish() call duration
+    core::LatencyPercentiles dwell;           // enqueue -> dequeue by a consumer
+    core::LatencyPercentiles callback;        // per subscriber callback invocation
 };
 
 /**
@@ -61,8 +123,36 @@ public:
      * @brief Subscribe to a topic.
      * @param topic Topic to subscribe to.
      * @param callback Function to handle incoming data.
+     * @return Token for unsubscribe(), or kInvalidSubscription on failure.
      */
-    virtual void subscribe(const std::string& topic, std::function<void(const void* data, size_t size)> callback) = 0;
+    virtual SubscriptionId subscribe(const std::string& topic, MessageCallback callback) = 0;
+
+    /**
+     * @brief Remove a subscription.
+     * Subscriber lists are immutable snapshots. This blocks until every dispatch already
+     * running on an older snapshot has finished, so the callback is not invoked after it
+     * returns. The exception is a callback unsubscribing itself from its own consumer
+     * thread: that thread does not wait on itself, and the current dispatch completes.
+     * @return true if the subscription existed.
+     */
+    virtual bool unsubscribe(const std::string& topic, SubscriptionId id) = 0;
+
+    /**
+     * @brief Publish a typed value. Prefer bus::Topic<T> over calling this directly.
+     * The default encodes with ops.encode and calls publish(); in-process buses may
+     * queue the struct itself and only serialize if a raw subscriber needs bytes.
+     */
+    virtual ArgentumStatus publish_typed(const std::string& topic, const TypedCodecOps& ops, const void* value);
+
+    /**
+     * @brief Subscribe with a decoded value. Buses decode each message at most once per
+     * value type and hand every typed subscriber the same object.
+     * @param on_error Optional; invoked when a message on the topic fails to decode.
+     */
+    virtual SubscriptionId subscribe_typed(const std::string& topic,
+                                           const TypedCodecOps& ops,
+                                           TypedCallback callback,
+                                           DecodeErrorCallback on_error);
 
     /**
      * @brief Read metrics for a topic.
@@ -78,4 +168,13 @@ public:
 std::shared_ptr<MessageBus> create_inproc_bus(const InprocBusConfig& config);
 std::shared_ptr<MessageBus> create_inproc_bus();
 
+/**
+ * @brief Create a shared-memory MessageBus for inter-process pub/sub.
+ * Maps a named region (POSIX shm, /dev/shm on Linux) holding one bounded ring per
+ * topic with cross-process atomic cursors and futex wakeups. Processes that open
+ * the same region name exchange messages; the region layout is fixed by its creator.
+ * @return nullptr if the platform is unsupported or the named region cannot be mapped.
+ */
+std::shared_ptr<MessageBus> create_shm_bus(const ShmBusConfig& config);
+
 } // namespace argentum::bus
@@ -2,14 +2,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
+#include "core/checksum.hpp"
 #include "core/errors.h"
 
 namespace argentum::bus {
 
 constexpr uint16_t kMessageProtocolVersionV1 = 1;
 constexpr uint16_t kMessageProtocolVersionV2 = 2;
+constexpr uint16_t kMessageProtocolVersionV3 = 3; // V2 header layout, compact fixed-point payload
 
 enum class MessageType : uint16_t {
     MarketTick = 1,
@@ -19,9 +22,23 @@ enum class MessageType : uint16_t {
 
 enum class MessageFlags : uint32_t {
     None = 0,
-    HasCrc32 = 1 << 0
+    HasCrc32 = 1 << 0 // payload checksum present; algorithm in the checksum-kind bits
 };
 
+// V2 flags bits 8..11 select the payload checksum algorithm (core::ChecksumKind).
+// Zero is CRC-32 (IEEE), so frames written before the field existed still verify.
+constexpr uint32_t kChecksumKindShift = 8;
+constexpr uint32_t kChecksumKindMask = 0xFU << kChecksumKindShift;
+
+constexpr uint32_t checksum_flags(core::ChecksumKind kind) {
+    return static_cast<uint32_t>(MessageFlags::HasCrc32) |
+           (static_cast<uint32_t>(kind) << kChecksumKindShift);
+}
+
+constexpr core::ChecksumKind checksum_kind_from_flags(uint32_t flags) {
+    return static_cast<core::ChecksumKind>((flags & kChecksumKindMask) >> kChecksumKindShift);
+}
+
 struct MessageHeaderV1 {
     uint16_t version;
     uint16_t type;
@@ -35,7 +52,7 @@ struct MessageHeaderV2 {
     uint32_t size;
     uint64_t timestamp_ns;
     uint32_t flags;
-    uint32_t crc32;
+    uint32_t crc32; // payload checksum of the kind named in flags
 };
 
 #ifdef __cplusplus
@@ -59,8 +76,27 @@ struct DecodedHeader {
 
 std::vector<uint8_t> encode_message(MessageType type, const void* data, size_t size, uint64_t timestamp_ns);
 std::vector<uint8_t> encode_message_v2(MessageType type, const void* data, size_t size, uint64_t timestamp_ns, uint32_t flags);
+
+/**
+ * @brief Heap-free framing: writes header + payload into caller storage.
+ * On success `*out_written` is the frame length. If `out` is too small, returns
+ * ARGENTUM_ERR_RANGE, writes nothing and sets `*out_written` to the required length.
+ */
+ArgentumStatus encode_message_into(MessageType type, const void* data, size_t size, uint64_t timestamp_ns,
+                                   std::span<uint8_t> out, size_t* out_written);
+ArgentumStatus encode_message_v2_into(MessageType type, const void* data, size_t size, uint64_t timestamp_ns,
+                                      uint32_t flags, std::span<uint8_t> out, size_t* out_written);
+
+/**
+ * @brief Writes only the fixed-size V2 header for a payload the caller has already
+ * placed at `out.data() + sizeof(MessageHeaderV2)` (or will place there). The
+ * checksum, if requested by `flags`, is computed over `payload`.
+ */
+void write_header_v2(MessageType type, const void* payload, size_t size, uint64_t timestamp_ns, uint32_t flags,
+                     std::span<uint8_t, sizeof(MessageHeaderV2)> out);
 ArgentumStatus decode_header(const void* data, size_t size, DecodedHeader* out_header);
 const uint8_t* payload_ptr(const void* data, size_t size, size_t header_size);
 uint32_t compute_crc32(const uint8_t* data, size_t size);
+uint32_t compute_payload_checksum(uint32_t flags, const uint8_t* data, size_t size);
 
 } // namespace argentum::bus
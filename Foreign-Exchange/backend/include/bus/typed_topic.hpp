@@ -0,0 +1,94 @@
+#pragma once
+
+#include "bus/message_bus.hpp"
+
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace argentum::bus {
+
+/**
+ * @brief Compile-time wire codec for a topic value type.
+ * Specialize for each T carried on a typed topic:
+ *   static ArgentumStatus encode(const T& value, std::vector<uint8_t>* out);
+ *   static ArgentumStatus decode(const void* data, size_t size, T* out);
+ */
+template <typename T>
+struct TopicCodec;
+
+/**
+ * @brief The single type-erased codec instance for (T, Codec).
+ * Buses compare these addresses to decide when a queued value can be handed
+ * to a subscriber as-is.
+ */
+template <typename T, typename Codec = TopicCodec<T>>
+const TypedCodecOps& typed_codec_ops() {
+    static_assert(std::is_trivially_copyable_v<T>, "Typed topic values are queued by byte copy.");
+    static_assert(std::is_trivially_destructible_v<T>, "Typed topic values are never destroyed explicitly.");
+    static_assert(sizeof(T) <= kMaxTypedValueBytes, "Typed topic value exceeds kMaxTypedValueBytes.");
+    static_assert(alignof(T) <= kMaxTypedValueAlign, "Typed topic value exceeds kMaxTypedValueAlign.");
+
+    static const TypedCodecOps ops{
+        sizeof(T),
+        [](const void* value, std::vector<uint8_t>* out) -> ArgentumStatus {
+            return Codec::encode(*static_cast<const T*>(value), out);
+        },
+        [](const void* data, size_t size, void* out_value) -> ArgentumStatus {
+            return Codec::decode(data, size, ::new (out_value) T{});
+        }};
+    return ops;
+}
+
+/**
+ * @class Topic
+ * @brief Typed handle over a MessageBus topic.
+ * Subscribers receive `const T&`. Each message is decoded at most once per process
+ * regardless of subscriber count, and an in-process publisher with in-process
+ * subscribers skips serialization entirely.
+ */
+template <typename T, typename Codec = TopicCodec<T>>
+class Topic {
+public:
+    using Callback = std::function<void(const T&)>;
+
+    Topic(std::shared_ptr<MessageBus> bus, std::string name)
+        : bus_(std::move(bus)), name_(std::move(name)) {}
+
+    const std::string& name() const {
+        return name_;
+    }
+
+    const std::shared_ptr<MessageBus>& bus() const {
+        return bus_;
+    }
+
+    ArgentumStatus publish(const T& value) const {
+        if (!bus_) return ARGENTUM_ERR_INVALID;
+        return bus_->publish_typed(name_, typed_codec_ops<T, Codec>(), &value);
+    }
+
+    /**
+     * @param on_decode_error Optional; called for messages that fail Codec::decode.
+     */
+    SubscriptionId subscribe(Callback callback, DecodeErrorCallback on_decode_error = {}) const {
+        if (!bus_ || !callback) return kInvalidSubscription;
+        return bus_->subscribe_typed(
+            name_,
+            typed_codec_ops<T, Codec>(),
+            [callback = std::move(callback)](const void* value) { callback(*static_cast<const T*>(value)); },
+            std::move(on_decode_error));
+    }
+
+    bool unsubscribe(SubscriptionId id) const {
+        return bus_ && bus_->unsubscribe(name_, id);
+    }
+
+private:
+    std::shared_ptr<MessageBus> bus_;
+    std::string name_;
+};
+
+} // namespace argentum::bus
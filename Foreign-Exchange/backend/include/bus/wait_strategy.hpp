@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace argentum::bus {
+
+/**
+ * @brief How an idle consumer thread waits for the next message.
+ * Block parks on the OS immediately (lowest CPU, highest wake-up latency);
+ * BusySpin never leaves the core and should only be used on isolated cores.
+ */
+enum class WaitStrategy {
+    Block = 0,     // park immediately (condition variable / futex)
+    BusySpin = 1,  // spin with a pause hint until data arrives
+    SpinYield = 2, // spin for spin_budget iterations, then yield the time slice
+    SpinPark = 3   // spin for spin_budget iterations, then park
+};
+
+struct ConsumerWaitConfig {
+    WaitStrategy strategy = WaitStrategy::Block;
+    uint32_t spin_budget = 4096; // pause iterations before yielding/parking
+};
+
+/**
+ * @brief CPU hint for spin-wait loops (PAUSE on x86).
+ * Reduces power and pipeline flushes while polling a shared cache line.
+ */
+inline void cpu_relax() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) && defined(__GNUC__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/**
+ * @brief True if the strategy eventually hands the thread back to the OS scheduler.
+ */
+inline bool wait_strategy_parks(WaitStrategy strategy) {
+    return strategy == WaitStrategy::Block || strategy == WaitStrategy::SpinPark;
+}
+
+} // namespace argentum::bus
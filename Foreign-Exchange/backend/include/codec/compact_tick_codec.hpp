@@ -0,0 +1,128 @@
+#pragma once
+
+#include "bus/message_protocol.hpp"
+#include "bus/typed_topic.hpp"
+#include "core/errors.h"
+#include "core/types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace argentum::codec {
+
+/**
+ * @brief Fixed-point tick as carried by the compact (V3) wire format.
+ * Symbols and venues are interned ids from core::instrument_registry() / venue_registry().
+ */
+struct CompactTick {
+    uint64_t timestamp_ns = 0;
+    int64_t price_ticks = 0;   // core::kPriceScale
+    int64_t quantity_lots = 0; // core::kQuantityScale
+    uint32_t instrument_id = 0;
+    uint16_t venue_id = 0;
+    uint8_t side = 0;
+};
+
+/**
+ * V3 frame: MessageHeaderV2 layout with version 3, type MarketTick and
+ * timestamp_ns = batch base time, followed by
+ *   CompactTickBatchHeader, then `count` x CompactTickRecord.
+ * Record timestamps are unsigned deltas from the base, so a batch spans < ~4.29 s.
+ * Fields are little-endian, read and written with memcpy (no alignment requirement).
+ */
+struct CompactTickBatchHeader {
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct CompactTickRecord {
+    int64_t price_ticks;
+    int64_t quantity_lots;
+    uint32_t instrument_id;
+    uint32_t ts_delta_ns;
+    uint16_t venue_id;
+    uint8_t side;
+    uint8_t reserved[5];
+};
+
+static_assert(sizeof(CompactTickBatchHeader) == 8, "CompactTickBatchHeader must be 8 bytes.");
+static_assert(sizeof(CompactTickRecord) == 32, "CompactTickRecord must be 32 bytes.");
+
+constexpr size_t compact_tick_frame_size(size_t count) {
+    return sizeof(bus::MessageHeaderV2) + sizeof(CompactTickBatchHeader) + count * sizeof(CompactTickRecord);
+}
+
+/**
+ * @brief Converts price/quantity to fixed point and interns symbol/source.
+ * @return ARGENTUM_ERR_RANGE if a registry is full or a name is too long.
+ */
+ArgentumStatus to_compact_tick(const MarketTick& tick, CompactTick* out);
+
+/**
+ * @brief Inverse of to_compact_tick. Prices are exact to 1e-6.
+ * @return ARGENTUM_ERR_PROTO if an id is not known to this process.
+ */
+ArgentumStatus from_compact_tick(const CompactTick& tick, MarketTick* out);
+
+/**
+ * @class CompactTickFrameWriter
+ * @brief Packs ticks into one V3 frame in caller storage, without allocating.
+ * The first tick sets the base timestamp; later ticks must fall within
+ * [base, base + UINT32_MAX] ns, otherwise add() returns ARGENTUM_ERR_RANGE and the
+ * caller should finish() and start a new frame.
+ */
+class CompactTickFrameWriter {
+public:
+    /**
+     * @param flags V2-style header flags, e.g. bus::checksum_flags(core::ChecksumKind::Crc32c).
+     */
+    explicit CompactTickFrameWriter(std::span<uint8_t> out, uint32_t flags = 0);
+
+    ArgentumStatus add(const CompactTick& tick);
+
+    /**
+     * @brief Writes the headers (and checksum). `*out_written` is the frame length.
+     */
+    ArgentumStatus finish(size_t* out_written);
+
+    size_t count() const {
+        return count_;
+    }
+
+    size_t capacity() const;
+
+private:
+    std::span<uint8_t> out_;
+    uint32_t flags_ = 0;
+    uint64_t base_ns_ = 0;
+    size_t count_ = 0;
+};
+
+/**
+ * @brief Single-tick V3 frame for a MarketTick.
+ */
+ArgentumStatus encode_compact_tick_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written);
+ArgentumStatus encode_compact_tick(const MarketTick& tick, std::vector<uint8_t>* out);
+
+/**
+ * @brief Validates a V3 frame and unpacks its ticks.
+ * If `out` is too small, returns ARGENTUM_ERR_RANGE with `*out_count` set to the tick count.
+ */
+ArgentumStatus decode_compact_ticks(const void* data, size_t size, std::span<CompactTick> out, size_t* out_count);
+
+/**
+ * @brief Topic codec that carries MarketTick as single-tick V3 frames. Only for
+ * peers that share the instrument/venue id tables.
+ */
+struct CompactMarketTickCodec {
+    static ArgentumStatus encode(const MarketTick& tick, std::vector<uint8_t>* out) {
+        return encode_compact_tick(tick, out);
+    }
+    static ArgentumStatus decode(const void* data, size_t size, MarketTick* out);
+};
+
+using CompactMarketTickTopic = bus::Topic<MarketTick, CompactMarketTickCodec>;
+
+} // namespace argentum::codec
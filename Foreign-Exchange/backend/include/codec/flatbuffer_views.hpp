@@ -0,0 +1,200 @@
+#pragma once
+
+#ifdef ARGENTUM_USE_FLATBUFFERS
+
+#include "argentum_generated.h"
+#include "bus/message_protocol.hpp"
+#include "core/errors.h"
+#include "core/fixed_point.hpp"
+#include "core/types.h"
+
+#include <flatbuffers/flatbuffers.h>
+#include <flatbuffers/verifier.h>
+
+#include <cstring>
+#include <string_view>
+
+namespace argentum::codec {
+
+/**
+ * @brief Whether a FlatBuffers payload must be verified before access.
+ * Trusted skips the Verifier walk; use it only for frames produced in this
+ * process (or a peer sharing its memory) whose bytes cannot be malformed.
+ * Header size bounds and any frame checksum are still checked.
+ */
+enum class FrameTrust : uint8_t {
+    Verify,
+    Trusted
+};
+
+namespace detail {
+
+inline std::string_view fb_string(const flatbuffers::String* s) {
+    return s ? std::string_view(s->c_str(), s->size()) : std::string_view();
+}
+
+inline void copy_fixed(std::string_view value, char* out, size_t capacity) {
+    const size_t n = value.size() < capacity ? value.size() : capacity - 1;
+    std::memcpy(out, value.data(), n);
+    std::memset(out + n, 0, capacity - n);
+}
+
+template <typename Table>
+ArgentumStatus open_table(const void* data, size_t size, bus::MessageType type, FrameTrust trust, const Table** out) {
+    if (!data || !out) return ARGENTUM_ERR_INVALID;
+    bus::DecodedHeader decoded{};
+    const ArgentumStatus status = bus::decode_header(data, size, &decoded);
+    if (status != ARGENTUM_OK) return status;
+    if (decoded.header.version != bus::kMessageProtocolVersionV2 ||
+        decoded.header.type != static_cast<uint16_t>(type)) {
+        return ARGENTUM_ERR_PROTO;
+    }
+
+    const uint8_t* payload = static_cast<const uint8_t*>(data) + decoded.header_size;
+    if (trust == FrameTrust::Verify) {
+        flatbuffers::Verifier verifier(payload, decoded.header.size);
+        if (!verifier.VerifyBuffer<Table>(nullptr)) return ARGENTUM_ERR_PROTO;
+    } else if (decoded.header.size < sizeof(flatbuffers::uoffset_t)) {
+        return ARGENTUM_ERR_PROTO;
+    }
+    *out = flatbuffers::GetRoot<Table>(payload);
+    return *out ? ARGENTUM_OK : ARGENTUM_ERR_PROTO;
+}
+
+} // namespace detail
+
+/**
+ * @class MarketTickView
+ * @brief Reads a V2 MarketTick frame in place. Valid while the frame bytes are.
+ * V2 frames carry the symbol only (ids are process-local), so copy_to() leaves
+ * instrument_id 0 for the consumer to resolve.
+ */
+class MarketTickView {
+public:
+    static ArgentumStatus open(const void* data, size_t size, MarketTickView* out, FrameTrust trust = FrameTrust::Verify) {
+        if (!out) return ARGENTUM_ERR_INVALID;
+        return detail::open_table(data, size, bus::MessageType::MarketTick, trust, &out->table_);
+    }
+
+    uint64_t timestamp_ns() const { return table_->timestamp_ns(); }
+    double price() const { return table_->price(); }
+    double quantity() const { return table_->quantity(); }
+    std::string_view symbol() const { return detail::fb_string(table_->symbol()); }
+    std::string_view source() const { return detail::fb_string(table_->source()); }
+    uint8_t side() const { return static_cast<uint8_t>(table_->side()); }
+
+    void copy_to(::MarketTick* out) const {
+        *out = ::MarketTick{};
+        out->timestamp_ns = timestamp_ns();
+        out->price = price();
+        out->quantity = quantity();
+        detail::copy_fixed(symbol(), out->symbol, sizeof(out->symbol));
+        detail::copy_fixed(source(), out->source, sizeof(out->source));
+        out->side = side();
+    }
+
+private:
+    const fb::MarketTick* table_ = nullptr;
+};
+
+/**
+ * @class OrderView
+ * @brief Reads a V2 Order frame in place. Fixed-point fields fall back to the
+ * doubles for frames from producers that predate them. As with MarketTickView,
+ * copy_to() leaves instrument_id 0.
+ */
+class OrderView {
+public:
+    static ArgentumStatus open(const void* data, size_t size, OrderView* out, FrameTrust trust = FrameTrust::Verify) {
+        if (!out) return ARGENTUM_ERR_INVALID;
+        return detail::open_table(data, size, bus::MessageType::Order, trust, &out->table_);
+    }
+
+    uint64_t order_id() const { return table_->order_id(); }
+    uint64_t client_id() const { return table_->client_id(); }
+    uint64_t timestamp_ns() const { return table_->timestamp_ns(); }
+    double price() const { return table_->price(); }
+    double quantity() const { return table_->quantity(); }
+    std::string_view symbol() const { return detail::fb_string(table_->symbol()); }
+    uint8_t side() const { return static_cast<uint8_t>(table_->side()); }
+    uint8_t type() const { return table_->type(); }
+    uint8_t tif() const { return table_->tif(); }
+
+    int64_t price_ticks() const {
+        const int64_t ticks = table_->price_ticks();
+        return ticks != 0 ? ticks : core::to_price_ticks(price());
+    }
+
+    int64_t quantity_lots() const {
+        const int64_t lots = table_->quantity_lots();
+        return lots != 0 ? lots : core::to_quantity_lots(quantity());
+    }
+
+    void copy_to(::Order* out) const {
+        *out = ::Order{};
+        out->order_id = order_id();
+        out->client_id = client_id();
+        out->timestamp_ns = timestamp_ns();
+        out->price = price();
+        out->quantity = quantity();
+        out->price_ticks = price_ticks();
+        out->quantity_lots = quantity_lots();
+        detail::copy_fixed(symbol(), out->symbol, sizeof(out->symbol));
+        out->side = side();
+        out->type = type();
+        out->tif = tif();
+    }
+
+private:
+    const fb::Order* table_ = nullptr;
+};
+
+/**
+ * @class TradeView
+ * @brief Reads a V2 Trade frame in place.
+ */
+class TradeView {
+public:
+    static ArgentumStatus open(const void* data, size_t size, TradeView* out, FrameTrust trust = FrameTrust::Verify) {
+        if (!out) return ARGENTUM_ERR_INVALID;
+        return detail::open_table(data, size, bus::MessageType::Trade, trust, &out->table_);
+    }
+
+    uint64_t trade_id() const { return table_->trade_id(); }
+    uint64_t maker_order_id() const { return table_->maker_order_id(); }
+    uint64_t taker_order_id() const { return table_->taker_order_id(); }
+    uint64_t timestamp_ns() const { return table_->timestamp_ns(); }
+    double price() const { return table_->price(); }
+    double quantity() const { return table_->quantity(); }
+    uint8_t side() const { return static_cast<uint8_t>(table_->side()); }
+
+    int64_t price_ticks() const {
+        const int64_t ticks = table_->price_ticks();
+        return ticks != 0 ? ticks : core::to_price_ticks(price());
+    }
+
+    int64_t quantity_lots() const {
+        const int64_t lots = table_->quantity_lots();
+        return lots != 0 ? lots : core::to_quantity_lots(quantity());
+    }
+
+    void copy_to(::Trade* out) const {
+        *out = ::Trade{};
+        out->trade_id = trade_id();
+        out->maker_order_id = maker_order_id();
+        out->taker_order_id = taker_order_id();
+        out->timestamp_ns = timestamp_ns();
+        out->price = price();
+        out->quantity = quantity();
+        out->price_ticks = price_ticks();
+        out->quantity_lots = quantity_lots();
+        out->side = side();
+    }
+
+private:
+    const fb::Trade* table_ = nullptr;
+};
+
+} // namespace argentum::codec
+
+#endif // ARGENTUM_USE_FLATBUFFERS
@@ -1,17 +1,70 @@
 #pragma once
 
+#include "bus/typed_topic.hpp"
 #include "core/types.h"
 #include "core/errors.h"
 
+#include <span>
 #include <vector>
 
 namespace argentum::codec {
 
+/**
+ * @brief Upper bound on any MarketTick frame produced by this codec; a stack buffer of
+ * this size always fits encode_market_tick_into().
+ */
+constexpr size_t kMarketTickMaxEncodedBytes = 256;
+
 ArgentumStatus encode_market_tick_legacy(const MarketTick& tick, std::vector<uint8_t>* out);
 ArgentumStatus decode_market_tick(const void* data, size_t size, MarketTick* out);
 
+/**
+ * @brief Conflation key for encoded MarketTick payloads: the symbol bytes verbatim
+ * (the instrument id for single-tick V3 frames), read in place without decoding the tick.
+ * Matches bus::ConflationKeyFn, e.g. config.topic_conflation["market.ticks.ws"] = market_tick_conflation_key.
+ * @return false if the payload is not a single MarketTick frame.
+ */
+bool market_tick_conflation_key(const void* data, size_t size, bus::ConflationKey* out_key);
+
 #ifdef ARGENTUM_USE_FLATBUFFERS
 ArgentumStatus encode_market_tick_flatbuffers(const MarketTick& tick, std::vector<uint8_t>* out, bool with_crc);
 #endif
 
+/**
+ * @brief Allocation-free encoders. Same framing as the vector overloads; on success
+ * `*out_written` is the frame length. If `out` is too small they return
+ * ARGENTUM_ERR_RANGE and set `*out_written` to the required length.
+ * The FlatBuffers path builds in a reused thread-local FlatBufferBuilder.
+ */
+ArgentumStatus encode_market_tick_legacy_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written);
+#ifdef ARGENTUM_USE_FLATBUFFERS
+ArgentumStatus encode_market_tick_flatbuffers_into(const MarketTick& tick,
+                                                   std::span<uint8_t> out,
+                                                   bool with_crc,
+                                                   size_t* out_written);
+#endif
+ArgentumStatus encode_market_tick_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written);
+
+/**
+ * @brief Wire encoding used for MarketTick on the bus: FlatBuffers (V2) when enabled, legacy V1 otherwise.
+ * Reuses `out`'s capacity, so a caller that keeps its vector encodes without allocating.
+ */
+ArgentumStatus encode_market_tick(const MarketTick& tick, std::vector<uint8_t>* out);
+
 } // namespace argentum::codec
+
+namespace argentum::bus {
+
+template <>
+struct TopicCodec<MarketTick> {
+    static ArgentumStatus encode(const MarketTick& tick, std::vector<uint8_t>* out) {
+        return codec::encode_market_tick(tick, out);
+    }
+    static ArgentumStatus decode(const void* data, size_t size, MarketTick* out) {
+        return codec::decode_market_tick(data, size, out);
+    }
+};
+
+using MarketTickTopic = Topic<MarketTick>;
+
+} // namespace argentum::bus
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "bus/typed_topic.hpp"
+#include "core/errors.h"
+#include "core/types.h"
+
+#include <span>
+#include <vector>
+
+namespace argentum::codec {
+
+/**
+ * @brief Upper bound on Order/Trade frames from this codec; stack buffers of this size
+ * always fit the *_into encoders.
+ */
+constexpr size_t kOrderMaxEncodedBytes = 256;
+constexpr size_t kTradeMaxEncodedBytes = 256;
+
+/**
+ * Order and Trade frames mirror MarketTick: FlatBuffers (V2) when enabled, raw struct
+ * (V1) otherwise. The *_into forms write into caller storage; if it is too small they
+ * return ARGENTUM_ERR_RANGE with `*out_written` set to the required length. Decoders
+ * accept both versions and fill the fixed-point fields from the doubles for producers
+ * that did not send them.
+ */
+ArgentumStatus encode_order_into(const Order& order, std::span<uint8_t> out, size_t* out_written);
+ArgentumStatus encode_order(const Order& order, std::vector<uint8_t>* out);
+ArgentumStatus decode_order(const void* data, size_t size, Order* out);
+
+ArgentumStatus encode_trade_into(const Trade& trade, std::span<uint8_t> out, size_t* out_written);
+ArgentumStatus encode_trade(const Trade& trade, std::vector<uint8_t>* out);
+ArgentumStatus decode_trade(const void* data, size_t size, Trade* out);
+
+} // namespace argentum::codec
+
+namespace argentum::bus {
+
+template <>
+struct TopicCodec<Order> {
+    static ArgentumStatus encode(const Order& order, std::vector<uint8_t>* out) {
+        return codec::encode_order(order, out);
+    }
+    static ArgentumStatus decode(const void* data, size_t size, Order* out) {
+        return codec::decode_order(data, size, out);
+    }
+};
+
+template <>
+struct TopicCodec<Trade> {
+    static ArgentumStatus encode(const Trade& trade, std::vector<uint8_t>* out) {
+        return codec::encode_trade(trade, out);
+    }
+    static ArgentumStatus decode(const void* data, size_t size, Trade* out) {
+        return codec::decode_trade(data, size, out);
+    }
+};
+
+using OrderTopic = Topic<Order>;
+using TradeTopic = Topic<Trade>;
+
+} // namespace argentum::bus
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace argentum::core {
+
+/**
+ * @brief Non-cryptographic checksums available for frame and record integrity.
+ * Values are persisted (frame flags, journals); never renumber.
+ */
+enum class ChecksumKind : uint8_t {
+    Crc32 = 0,   // IEEE 802.3 / zlib polynomial
+    Crc32c = 1,  // Castagnoli; SSE4.2 `crc32` instruction
+    XxHash32 = 2 // xxHash32, seed 0
+};
+
+constexpr uint8_t kChecksumKindCount = 3;
+
+/**
+ * @brief CRC-32 (IEEE). Pass a previous result as `crc` to continue a running checksum.
+ * Uses PCLMUL folding when available, slicing-by-8 otherwise.
+ */
+uint32_t crc32(const void* data, size_t size, uint32_t crc = 0);
+
+/**
+ * @brief CRC-32C (Castagnoli). Pass a previous result as `crc` to continue a running checksum.
+ * Uses the SSE4.2 `crc32` instruction when available, slicing-by-8 otherwise.
+ */
+uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0);
+
+uint32_t xxhash32(const void* data, size_t size, uint32_t seed = 0);
+
+uint32_t compute_checksum(ChecksumKind kind, const void* data, size_t size);
+
+const char* checksum_kind_name(ChecksumKind kind);
+
+namespace detail {
+// Table-driven reference paths; exposed so tests can cross-check the accelerated kernels.
+uint32_t crc32_portable(const void* data, size_t size, uint32_t crc = 0);
+uint32_t crc32c_portable(const void* data, size_t size, uint32_t crc = 0);
+} // namespace detail
+
+} // namespace argentum::core
@@ -0,0 +1,38 @@
+#pragma once
+
+namespace argentum::core {
+
+/**
+ * @brief x86 ISA extensions usable by runtime-dispatched kernels.
+ * AVX flags are only set when the OS also saves the wide register state (XGETBV).
+ * All flags are false on non-x86 targets.
+ */
+struct CpuFeatures {
+    bool sse42 = false;
+    bool pclmul = false;
+    bool avx2 = false;
+    bool fma = false;
+    bool bmi2 = false;
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512dq = false;
+};
+
+/**
+ * @brief Features of the running CPU, probed once on first call.
+ */
+const CpuFeatures& cpu_features();
+
+} // namespace argentum::core
+
+// Per-function ISA enablement for kernels selected through cpu_features().
+// MSVC emits intrinsics without a target switch, so the attribute is dropped there.
+#if defined(__GNUC__) || defined(__clang__)
+#define ARGENTUM_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ARGENTUM_TARGET(isa)
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ARGENTUM_X86 1
+#endif
@@ -0,0 +1,35 @@
+#ifndef ARGENTUM_CORE_DECIMAL_H
+#define ARGENTUM_CORE_DECIMAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "core/errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Decimal ASCII -> scaled int64 without going through double, in the style of
+ * std::from_chars: no whitespace skipping, no terminator required, and `*out_end`
+ * reports where parsing stopped.
+ *
+ * Accepted form: [+-]digits[.digits][(e|E)[+-]digits], with digits on at least one
+ * side of the point. An exponent marker not followed by digits is not consumed.
+ * The result is value * 10^scale_digits, rounded half away from zero on the digits
+ * that fall below the scale (1.0000005 at scale 6 -> 1000001).
+ *
+ * Returns ARGENTUM_ERR_PARSE when no number is present and ARGENTUM_ERR_RANGE when
+ * the scaled magnitude exceeds INT64_MAX; `*out` is only written on success.
+ */
+ArgentumStatus decimal_parse_scaled(const char* first,
+                                    const char* last,
+                                    int scale_digits,
+                                    int64_t* out,
+                                    const char** out_end);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARGENTUM_CORE_DECIMAL_H
@@ -0,0 +1,51 @@
+#ifndef ARGENTUM_CORE_FIX_TOKENIZER_H
+#define ARGENTUM_CORE_FIX_TOKENIZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Allocation-free tag=value tokenizer for FIX messages. Fields are reported as
+ * (tag, offset, length) views into the caller's buffer; nothing is copied and
+ * values are not NUL-terminated. Tokens without '=' or with a non-numeric or zero
+ * tag are skipped, as are empty tokens between consecutive delimiters.
+ */
+
+#define FIX_SOH '\x01'
+
+typedef struct FixField {
+    uint32_t tag;    /* 0 when a requested tag was not found */
+    uint32_t offset; /* value start, relative to the message */
+    uint32_t length; /* value length in bytes */
+} FixField;
+
+/** @brief '|' when the message contains one (test/log form), otherwise SOH. */
+char fix_detect_delimiter(const char* data, size_t len);
+
+/**
+ * @brief Advances `*cursor` past the next well-formed field and stores it in `out`.
+ * Start with `*cursor == 0`. Returns 1 when a field was produced, 0 at end of message.
+ */
+int fix_next_field(const char* data, size_t len, char delimiter, size_t* cursor, FixField* out);
+
+/**
+ * @brief Single pass over the message, capturing the first occurrence of each tag in `tags`.
+ * `out[i]` describes `tags[i]`; missing tags leave `out[i].tag == 0`. Returns the
+ * number of requested tags found. Stops early once every tag has been seen.
+ */
+size_t fix_scan_tags(const char* data,
+                     size_t len,
+                     char delimiter,
+                     const uint32_t* tags,
+                     size_t tag_count,
+                     FixField* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARGENTUM_CORE_FIX_TOKENIZER_H
@@ -1,27 +1,55 @@
 #pragma once
 
+#include "core/decimal.h"
 #include "core/types.h"
 
 #include <cmath>
 #include <cstdint>
 #include <limits>
+#include <span>
+#include <string_view>
 
 namespace argentum::core {
 
 constexpr int64_t kPriceScale = 1'000'000;      // 1 tick = 1e-6
 constexpr int64_t kQuantityScale = 1'000'000;   // 1 lot = 1e-6
 constexpr int64_t kNotionalScale = kPriceScale * kQuantityScale;
+constexpr int kPriceScaleDigits = 6;
+constexpr int kQuantityScaleDigits = 6;
+
+namespace detail {
+
+constexpr double kTwo52 = 4503599627370496.0;
+constexpr double kTwo63 = 9223372036854775808.0;
+
+/**
+ * @brief round(magnitude * scale), half away from zero, for a product below 2^63.
+ * The FMA residual recovers the exact product, so ties and near-ties round the way
+ * the decimal value would instead of the way the rounded double product would.
+ * The batch kernels in fixed_point.cpp repeat this operation sequence lane-wise.
+ */
+inline int64_t round_scaled_magnitude(double magnitude, double scale) {
+    const double product = magnitude * scale;
+    const double residual = std::fma(magnitude, scale, -product);
+    if (product < kTwo52) {
+        const double whole = std::floor(product);
+        const double above_half = ((product - whole) - 0.5) + residual;
+        return static_cast<int64_t>(whole) + (above_half >= 0.0 ? 1 : 0);
+    }
+    return static_cast<int64_t>(product) + static_cast<int64_t>(std::floor(residual + 0.5));
+}
+
+} // namespace detail
 
 inline int64_t round_to_i64(double value, int64_t scale) {
     if (!std::isfinite(value)) return 0;
-    const long double scaled = static_cast<long double>(value) * static_cast<long double>(scale);
-    if (scaled > static_cast<long double>(std::numeric_limits<int64_t>::max())) {
-        return std::numeric_limits<int64_t>::max();
+    const double scale_d = static_cast<double>(scale);
+    const double magnitude = std::fabs(value);
+    if (magnitude * scale_d >= detail::kTwo63) {
+        return value < 0.0 ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
     }
-    if (scaled < static_cast<long double>(std::numeric_limits<int64_t>::min())) {
-        return std::numeric_limits<int64_t>::min();
-    }
-    return static_cast<int64_t>(std::llround(scaled));
+    const int64_t rounded = detail::round_scaled_magnitude(magnitude, scale_d);
+    return value < 0.0 ? -rounded : rounded;
 }
 
 inline double to_double(int64_t value, int64_t scale) {
@@ -44,6 +72,68 @@ inline double from_quantity_lots(int64_t lots) {
     return to_double(lots, kQuantityScale);
 }
 
+/**
+ * @name Batch conversions
+ * Element-wise round_to_i64 / to_double over spans, bit-identical to the scalar
+ * functions above. AVX-512 (F+DQ) or AVX2+FMA kernels are picked once from
+ * cpu_features(); lanes outside the exact vector range (|x| >= 2^51 units,
+ * non-finite input) take the scalar path. Converts min(in.size(), out.size())
+ * elements.
+ * @{
+ */
+void round_to_i64_batch(std::span<const double> in, int64_t scale, std::span<int64_t> out);
+void to_double_batch(std::span<const int64_t> in, int64_t scale, std::span<double> out);
+
+inline void to_price_ticks_batch(std::span<const double> prices, std::span<int64_t> out) {
+    round_to_i64_batch(prices, kPriceScale, out);
+}
+
+inline void to_quantity_lots_batch(std::span<const double> quantities, std::span<int64_t> out) {
+    round_to_i64_batch(quantities, kQuantityScale, out);
+}
+
+inline void from_price_ticks_batch(std::span<const int64_t> ticks, std::span<double> out) {
+    to_double_batch(ticks, kPriceScale, out);
+}
+
+inline void from_quantity_lots_batch(std::span<const int64_t> lots, std::span<double> out) {
+    to_double_batch(lots, kQuantityScale, out);
+}
+/** @} */
+
+namespace detail {
+
+enum class FixedPointKernel : uint8_t { Scalar, Avx2, Avx512 };
+
+/** @brief Runs one kernel explicitly (scalar if the CPU lacks it); for tests and benchmarks. */
+void round_to_i64_batch_with(FixedPointKernel kernel, std::span<const double> in, int64_t scale, std::span<int64_t> out);
+void to_double_batch_with(FixedPointKernel kernel, std::span<const int64_t> in, int64_t scale, std::span<double> out);
+
+} // namespace detail
+
+/**
+ * @brief Parses all of `text` as a decimal into units of 10^-scale_digits (see core/decimal.h).
+ * Fails on empty input, trailing characters or overflow; `*out` is untouched on failure.
+ */
+inline bool parse_scaled(std::string_view text, int scale_digits, int64_t* out) {
+    const char* end = nullptr;
+    int64_t value = 0;
+    if (decimal_parse_scaled(text.data(), text.data() + text.size(), scale_digits, &value, &end) != ARGENTUM_OK ||
+        end != text.data() + text.size()) {
+        return false;
+    }
+    *out = value;
+    return true;
+}
+
+inline bool parse_price_ticks(std::string_view text, int64_t* out) {
+    return parse_scaled(text, kPriceScaleDigits, out);
+}
+
+inline bool parse_quantity_lots(std::string_view text, int64_t* out) {
+    return parse_scaled(text, kQuantityScaleDigits, out);
+}
+
 inline int64_t to_notional_units(int64_t price_ticks, int64_t quantity_lots) {
     const long double product = static_cast<long double>(price_ticks) * static_cast<long double>(quantity_lots);
     if (product > static_cast<long double>(std::numeric_limits<int64_t>::max())) {
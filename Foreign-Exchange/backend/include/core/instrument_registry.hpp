@@ -0,0 +1,82 @@
+#pragma once
+
+#include "core/types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace argentum::core {
+
+/**
+ * @class InstrumentRegistry
+ * @brief Interns short names (symbols, venues) to dense uint32 ids.
+ * Ids start at 1 and are assigned in first-seen order; 0 means "unknown". Id -> name is
+ * lock-free (entries are pre-allocated and never move); name -> id takes a shared lock.
+ * Ids are process-local: peers exchanging compact frames must intern in the same order
+ * (e.g. seed from config at startup) or exchange the table.
+ */
+class InstrumentRegistry {
+public:
+    static constexpr uint32_t kInvalidId = 0;
+    static constexpr size_t kMaxNameLength = SYMBOL_LEN - 1;
+
+    explicit InstrumentRegistry(size_t capacity = 16384);
+
+    InstrumentRegistry(const InstrumentRegistry&) = delete;
+    InstrumentRegistry& operator=(const InstrumentRegistry&) = delete;
+
+    /**
+     * @brief Id for `name`, assigning the next id on first sight.
+     * @return kInvalidId if the name is empty, longer than kMaxNameLength, or the table is full.
+     */
+    uint32_t intern(std::string_view name);
+
+    /**
+     * @brief Id for an already-interned name, or kInvalidId.
+     */
+    uint32_t find(std::string_view name) const;
+
+    /**
+     * @brief Name for `id`; empty if the id was never assigned.
+     */
+    std::string_view name(uint32_t id) const;
+
+    size_t size() const {
+        return count_.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const {
+        return entries_.size();
+    }
+
+private:
+    struct Entry {
+        char name[SYMBOL_LEN];
+    };
+
+    struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::vector<Entry> entries_;
+    std::atomic<uint32_t> count_{0};
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, uint32_t, NameHash, std::equal_to<>> ids_;
+};
+
+/**
+ * @brief Process-wide tables used by the compact (V3) wire format.
+ */
+InstrumentRegistry& instrument_registry();
+InstrumentRegistry& venue_registry();
+
+} // namespace argentum::core
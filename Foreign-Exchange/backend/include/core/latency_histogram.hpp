@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace argentum::core {
+
+struct LatencyPercentiles {
+    uint64_t count = 0;
+    uint64_t p50_ns = 0;
+    uint64_t p99_ns = 0;
+    uint64_t p999_ns = 0;
+    uint64_t max_ns = 0;
+};
+
+/**
+ * @class LatencyHistogram
+ * @brief Lock-free, log-bucketed (HDR-style) latency histogram.
+ * Values below 16 are exact; above that each power of two is split into
+ * 16 linear sub-buckets, bounding the relative error at ~6%. Recording is a
+ * single relaxed fetch_add plus a max CAS, so it is safe on hot paths and in
+ * shared memory (an all-zero object is a valid empty histogram).
+ */
+class LatencyHistogram {
+public:
+    static constexpr uint32_t kSubBucketBits = 4;
+    static constexpr uint32_t kSubBuckets = 1U << kSubBucketBits;
+    static constexpr uint32_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    void record(uint64_t value_ns) {
+        buckets_[bucket_index(value_ns)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        uint64_t prev = max_.load(std::memory_order_relaxed);
+        while (value_ns > prev &&
+               !max_.compare_exchange_weak(prev, value_ns, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t count() const {
+        return count_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t max() const {
+        return max_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Snapshot p50/p99/p99.9/max. Concurrent records may be partially visible;
+     * percentiles are reported as bucket upper bounds clamped to the observed max.
+     */
+    LatencyPercentiles percentiles() const {
+        LatencyPercentiles out;
+        uint64_t total = 0;
+        for (const auto& bucket : buckets_) {
+            total += bucket.load(std::memory_order_relaxed);
+        }
+        out.count = total;
+        out.max_ns = max();
+        if (total == 0) return out;
+
+        const uint64_t rank50 = rank_for(total, 500);
+        const uint64_t rank99 = rank_for(total, 990);
+        const uint64_t rank999 = rank_for(total, 999);
+        uint64_t seen = 0;
+        bool have50 = false;
+        bool have99 = false;
+        for (uint32_t i = 0; i < kBucketCount; ++i) {
+            seen += buckets_[i].load(std::memory_order_relaxed);
+            if (seen == 0) continue;
+            const uint64_t upper = bucket_upper(i) < out.max_ns ? bucket_upper(i) : out.max_ns;
+            if (!have50 && seen >= rank50) {
+                out.p50_ns = upper;
+                have50 = true;
+            }
+            if (!have99 && seen >= rank99) {
+                out.p99_ns = upper;
+                have99 = true;
+            }
+            if (seen >= rank999) {
+                out.p999_ns = upper;
+                break;
+            }
+        }
+        return out;
+    }
+
+    void reset() {
+        for (auto& bucket : buckets_) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+    }
+
+    static uint32_t bucket_index(uint64_t value) {
+        if (value < kSubBuckets) return static_cast<uint32_t>(value);
+        const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - 1 - kSubBucketBits;
+        const uint32_t sub = static_cast<uint32_t>(value >> shift) - kSubBuckets;
+        return (shift + 1) * kSubBuckets + sub;
+    }
+
+    static uint64_t bucket_upper(uint32_t index) {
+        if (index < kSubBuckets) return index;
+        const uint32_t shift = index / kSubBuckets - 1;
+        const uint64_t sub = index % kSubBuckets;
+        return ((static_cast<uint64_t>(kSubBuckets) + sub + 1) << shift) - 1;
+    }
+
+private:
+    // Smallest rank r (1-based) such that r >= total * permille / 1000.
+    static uint64_t rank_for(uint64_t total, uint64_t permille) {
+        const uint64_t rank = (total * permille + 999) / 1000;
+        return rank == 0 ? 1 : rank;
+    }
+
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+} // namespace argentum::core
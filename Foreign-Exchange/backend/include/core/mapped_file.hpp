@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace argentum::core {
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a whole file (mmap / MapViewOfFile).
+ * An empty file opens successfully with size() == 0 and data() == nullptr.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * @brief Maps `path`, replacing any current mapping.
+     * @param sequential Hint the kernel to read ahead aggressively.
+     */
+    bool open(const std::string& path, bool sequential = true);
+    void close();
+
+    bool is_open() const {
+        return open_;
+    }
+    const char* data() const {
+        return data_;
+    }
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    bool open_ = false;
+#if defined(_WIN32)
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace argentum::core
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+namespace argentum::core {
+
+/**
+ * @class MpscRing
+ * @brief Bounded multi-producer / single-consumer ring of trivially copyable values.
+ * Producers claim a slot with one CAS on the head and publish it through a per-slot
+ * sequence word; they never take a lock. Values and sequence words live in separate
+ * arrays, so the consumer can claim() a run of published values and process them in
+ * place as one contiguous span before release()-ing the slots back to producers.
+ *
+ * `capacity` bounds the values queued (published but not yet claimed). The ring holds
+ * more than `capacity + max_claim` slots (the next power of two above it), so the slot
+ * at the head never still belongs to a claimed run: a claimed run being processed does
+ * not eat into the producers' capacity, and push_evict only ever finds the ring full
+ * because of queued values it can discard.
+ */
+template <typename T>
+class MpscRing {
+public:
+    MpscRing(size_t capacity, size_t max_claim)
+        : capacity_(capacity == 0 ? 1 : capacity), max_claim_(max_claim == 0 ? 1 : max_claim) {
+        size_t slots = 1;
+        while (slots <= capacity_ + max_claim_) slots <<= 1;
+        mask_ = slots - 1;
+        values_ = std::make_unique<T[]>(slots);
+        seqs_ = std::make_unique<std::atomic<uint64_t>[]>(slots);
+        for (size_t i = 0; i < slots; ++i) seqs_[i].store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t capacity() const {
+        return capacity_;
+    }
+    size_t slot_count() const {
+        return mask_ + 1;
+    }
+
+    /** @brief Values published or being published and not yet claimed (approximate). */
+    size_t size() const {
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        return head > tail ? static_cast<size_t>(head - tail) : 0;
+    }
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /** @return false if the ring is full. Any thread. */
+    bool try_push(const T& value) {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            const SlotState state = slot_state(pos);
+            if (state == SlotState::Full) return false;
+            if (state == SlotState::Free && head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            if (state == SlotState::Stale) pos = head_.load(std::memory_order_relaxed);
+        }
+        publish(pos, value);
+        return true;
+    }
+
+    /**
+     * @brief Pushes `value`, discarding the oldest unclaimed value if the ring is full.
+     * @param evicted incremented for each value discarded.
+     * @return false only if every queued value is already claimed by the consumer.
+     */
+    bool push_evict(const T& value, uint64_t* evicted) {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            const SlotState state = slot_state(pos);
+            if (state == SlotState::Free) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                continue;
+            }
+            if (state == SlotState::Full) {
+                const uint64_t tail = tail_.load(std::memory_order_acquire);
+                if (tail >= pos) return false;
+                // Only a published value can be evicted; if its producer is still writing
+                // it, retry until it is published.
+                if (seqs_[tail & mask_].load(std::memory_order_acquire) == tail + 1) {
+                    uint64_t expected = tail;
+                    if (tail_.compare_exchange_strong(expected, tail + 1, std::memory_order_acq_rel)) {
+                        seqs_[tail & mask_].store(tail + mask_ + 1, std::memory_order_release);
+                        if (evicted) ++*evicted;
+                    }
+                }
+            }
+            pos = head_.load(std::memory_order_relaxed);
+        }
+        publish(pos, value);
+        return true;
+    }
+
+    /**
+     * @brief Claims up to `max` (at most max_claim) published values in order, as one
+     * contiguous span (a run stops at the end of the array). Consumer thread only; the
+     * values stay valid until release().
+     */
+    std::span<T> claim(size_t max) {
+        if (max > max_claim_) max = max_claim_;
+        for (;;) {
+            const uint64_t tail = tail_.load(std::memory_order_acquire);
+            const size_t contiguous = slot_count() - static_cast<size_t>(tail & mask_);
+            const size_t limit = max < contiguous ? max : contiguous;
+            size_t count = 0;
+            while (count < limit && seqs_[(tail + count) & mask_].load(std::memory_order_acquire) == tail + count + 1) {
+                ++count;
+            }
+            if (count == 0) return {};
+            uint64_t expected = tail;
+            // Fails only if a DropOldest producer evicted the oldest value meanwhile.
+            if (tail_.compare_exchange_strong(expected, tail + count, std::memory_order_acq_rel)) {
+                claimed_ = tail;
+                return {&values_[tail & mask_], count};
+            }
+        }
+    }
+
+    /** @brief Hands the `count` values returned by the last claim() back to producers. */
+    void release(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t pos = claimed_ + i;
+            seqs_[pos & mask_].store(pos + mask_ + 1, std::memory_order_release);
+        }
+        claimed_ += count;
+    }
+
+private:
+    enum class SlotState { Free, Full, Stale };
+
+    // Free: the slot's previous occupant was released and `pos` stays within `capacity`
+    // of the oldest unclaimed value. Stale: another producer already took `pos`.
+    SlotState slot_state(uint64_t pos) const {
+        const int64_t lap = static_cast<int64_t>(seqs_[pos & mask_].load(std::memory_order_acquire) - pos);
+        if (lap > 0) return SlotState::Stale;
+        if (lap < 0) return SlotState::Full;
+        const int64_t queued = static_cast<int64_t>(pos - tail_.load(std::memory_order_acquire));
+        if (queued < 0) return SlotState::Stale;
+        return static_cast<size_t>(queued) < capacity_ ? SlotState::Free : SlotState::Full;
+    }
+
+    void publish(uint64_t pos, const T& value) {
+        values_[pos & mask_] = value;
+        seqs_[pos & mask_].store(pos + 1, std::memory_order_release);
+    }
+
+    size_t capacity_;
+    size_t max_claim_;
+    size_t mask_ = 0;
+    std::unique_ptr<T[]> values_;
+    std::unique_ptr<std::atomic<uint64_t>[]> seqs_;
+    alignas(64) std::atomic<uint64_t> head_{0}; // next position to claim (producers)
+    alignas(64) std::atomic<uint64_t> tail_{0}; // oldest unclaimed position
+    uint64_t claimed_ = 0;                      // consumer-private: start of the claimed run
+};
+
+} // namespace argentum::core
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "core/instrument_registry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace argentum::core {
+
+/**
+ * @class SymbolAliasTable
+ * @brief Static perfect hash from raw venue symbol spellings to instrument ids.
+ * Spellings are registered at startup and build() lays them out with hash-and-displace:
+ * a lookup is one displacement read, one slot read and a 16-byte compare, with no
+ * locks, normalization or allocation. Ids come from the backing InstrumentRegistry, so
+ * canonical_name(id) and the compact (V3) wire format agree on them.
+ *
+ * add_*() and build() are not thread-safe; finish them before feeds start. find() is
+ * safe to call concurrently once built.
+ */
+class SymbolAliasTable {
+public:
+    static constexpr size_t kMaxSpellingLength = SYMBOL_LEN - 1;
+
+    explicit SymbolAliasTable(InstrumentRegistry& registry);
+
+    SymbolAliasTable(const SymbolAliasTable&) = delete;
+    SymbolAliasTable& operator=(const SymbolAliasTable&) = delete;
+
+    /**
+     * @brief Registers a canonical "BASE/QUOTE" name plus its common spellings: no separator
+     * or one of "/-_. ", each in upper and lower case.
+     * @return The instrument id, or InstrumentRegistry::kInvalidId if the name is unusable.
+     */
+    uint32_t add_instrument(std::string_view canonical);
+
+    /**
+     * @brief Registers one extra spelling (e.g. "XBTUSD") for `canonical`.
+     */
+    bool add_alias(std::string_view raw, std::string_view canonical);
+
+    /**
+     * @brief Lays out the perfect hash over everything added so far.
+     * @return false if one spelling was registered for two different instruments.
+     */
+    bool build();
+
+    /**
+     * @brief Instrument id for an exact raw spelling, or InstrumentRegistry::kInvalidId.
+     */
+    uint32_t find(std::string_view raw) const;
+
+    std::string_view canonical_name(uint32_t id) const {
+        return registry_.name(id);
+    }
+
+    /** @brief Number of spellings in the built table. */
+    size_t size() const {
+        return built_count_;
+    }
+
+private:
+    struct Key {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        bool operator==(const Key&) const = default;
+    };
+
+    struct Slot {
+        Key key;
+        uint32_t id = InstrumentRegistry::kInvalidId;
+    };
+
+    static bool make_key(std::string_view raw, Key* out);
+    static uint64_t hash(const Key& key, uint64_t seed);
+    static uint64_t slot_hash(uint64_t h, uint32_t displacement);
+    bool try_build(uint64_t seed, const std::vector<std::pair<Key, uint32_t>>& keys);
+
+    InstrumentRegistry& registry_;
+    std::vector<std::pair<Key, uint32_t>> pending_;
+    std::vector<uint32_t> displacements_;
+    std::vector<Slot> slots_;
+    uint64_t seed_ = 0;
+    uint32_t bucket_shift_ = 63;
+    uint64_t slot_mask_ = 0;
+    size_t built_count_ = 0;
+};
+
+/**
+ * @brief Process-wide alias table over instrument_registry().
+ */
+SymbolAliasTable& symbol_aliases();
+
+} // namespace argentum::core
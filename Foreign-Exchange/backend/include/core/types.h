@@ -49,7 +49,7 @@ typedef enum {
 #endif
 /**
  * @brief Represents a single tick from the market.
- * Optimized size: 8 (ts) + 8 (px) + 8 (qty) + 16 (sym) + 8 (src) + 1 (side) + 7 (pad) = 56 bytes data + align.
+ * Layout: 8 (ts) + 8 (px) + 8 (qty) + 16 (sym) + 8 (src) + 1 (side) + 3 (pad) + 4 (instrument) = 64 bytes.
  * Fits within a single 64-byte cache line.
  */
 typedef struct ARGENTUM_ALIGNAS_64 {
@@ -59,7 +59,8 @@ typedef struct ARGENTUM_ALIGNAS_64 {
     char symbol[SYMBOL_LEN];
     char source[SOURCE_LEN]; // e.g., "BINANCE", "BYMA"
     uint8_t side;           // 1=Buy, 2=Sell
-    uint8_t _padding[7];    // Align to 64 bytes (optional but good for cache)
+    uint8_t _padding[3];
+    uint32_t instrument_id; // core::instrument_registry() id; 0 = not resolved
 } MarketTick;
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -80,7 +81,8 @@ typedef struct {
     uint8_t side;
     uint8_t type;
     uint8_t tif;
-    uint8_t _padding[3];
+    uint8_t _padding;
+    uint32_t instrument_id;   // core::instrument_registry() id; 0 = not resolved
 } Order;
 
 /**
@@ -101,9 +103,11 @@ typedef struct {
 
 #ifdef __cplusplus
 static_assert(sizeof(MarketTick) == 64, "MarketTick must be exactly 64 bytes.");
+static_assert(sizeof(Order) == 80, "Order layout is part of the V1 wire format.");
 static_assert(alignof(MarketTick) == 64, "MarketTick must be 64-byte aligned.");
 #else
 _Static_assert(sizeof(MarketTick) == 64, "MarketTick must be exactly 64 bytes.");
+_Static_assert(sizeof(Order) == 80, "Order layout is part of the V1 wire format.");
 _Static_assert(_Alignof(MarketTick) == 64, "MarketTick must be 64-byte aligned.");
 #endif
 
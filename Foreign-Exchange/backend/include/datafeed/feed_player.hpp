@@ -2,23 +2,62 @@
 
 #include "bus/message_bus.hpp"
 #include "bus/message_protocol.hpp"
+#include "codec/market_tick_codec.hpp"
 #include "core/types.h"
+#include "datafeed/line_arbitrator.hpp"
 #include "datafeed/market_parser.h"
+#include "datafeed/replay_clock.hpp"
 
 #include <memory>
 #include <string>
 
 namespace argentum::datafeed {
 
+/**
+ * @brief Tuning for FeedPlayer::play_file_parallel.
+ */
+struct ParallelPlayOptions {
+    size_t workers = 0;              // parser threads; 0 = hardware_concurrency - 1 (at least 1)
+    size_t chunk_bytes = 1U << 20;   // target chunk size; chunks always end on a newline
+    size_t max_chunks_in_flight = 0; // reorder window; 0 = 4 * workers. Bounds memory.
+};
+
 class FeedPlayer {
 public:
     FeedPlayer(std::shared_ptr<bus::MessageBus> bus, std::string topic);
 
     size_t play_file(const std::string& path, FeedFormat format, uint32_t throttle_us);
 
+    /**
+     * @brief Replays a file on its recorded timeline: each tick is published when
+     * `clock` says its timestamp_ns is due (see ReplayClock for speed and pacing).
+     * The clock is re-anchored on the first tick; its lag statistics accumulate.
+     */
+    size_t play_file_paced(const std::string& path, FeedFormat format, ReplayClock* clock);
+
+    /**
+     * @brief Replays a line-oriented file with parsing spread over worker threads.
+     * The file is memory-mapped and split into newline-aligned chunks; workers parse
+     * chunks into reusable tick buffers and the calling thread publishes them in file
+     * order through a bounded reorder window. No pacing: use play_file for throttled
+     * replay. Returns the number of ticks published.
+     */
+    size_t play_file_parallel(const std::string& path, FeedFormat format, const ParallelPlayOptions& options = {});
+
+    /**
+     * @brief Replays two captures of the same sequenced feed (A and B lines) through
+     * `arbitrator`: lines are merged on timestamp_ns, the first copy of each sequence
+     * (JSON "seq", FIX 34) is published and duplicates are dropped. Lines without a
+     * sequence are skipped. Calls arbitrator->finish() at the end so trailing gaps are
+     * reported. Returns the number of ticks published.
+     */
+    size_t play_arbitrated(const std::string& path_a,
+                           const std::string& path_b,
+                           FeedFormat format,
+                           LineArbitrator* arbitrator);
+
 private:
-    std::shared_ptr<bus::MessageBus> bus_;
-    std::string topic_;
+    bus::MarketTickTopic ticks_;
 };
 
 } // namespace argentum::datafeed
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "datafeed/sbe_decoder.h"
+#include "gateway/venue.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace argentum::datafeed {
+
+/** @brief Level action; values match SbeUpdateAction. */
+enum class L2Action : uint8_t { New = 0, Change = 1, Delete = 2 };
+
+/**
+ * @brief One price-level change. `level` is 1-based (1 = best); New inserts at that
+ * level and shifts the rest down, Delete removes it and shifts the rest up.
+ */
+struct L2LevelUpdate {
+    int64_t price_ticks = 0;
+    int64_t size_lots = 0;
+    uint8_t side = SIDE_BUY; // SIDE_BUY = bid, SIDE_SELL = ask
+    L2Action action = L2Action::New;
+    uint8_t level = 1;
+};
+
+enum class L2ApplyResult : uint8_t {
+    Applied,
+    Duplicate, // sequence already applied
+    Gap,       // sequence skipped ahead; book cleared and waiting for a snapshot
+    Stale,     // book is waiting for a snapshot; update dropped
+    Invalid,   // level outside the book; book cleared and waiting for a snapshot
+    UnknownBook
+};
+
+/**
+ * @class L2Book
+ * @brief Fixed-depth price-level book for one (venue, instrument).
+ * Levels live inline, so updates never allocate. One feed thread writes; any thread
+ * may call snapshot_into(), which copies under a sequence lock and retries if a write
+ * raced it. A new book is empty at sequence 0, so a session starting at sequence 1
+ * needs no snapshot; any other start is reported as a gap.
+ *
+ * Only the best kMaxDepth levels per side are held; updates to deeper levels are
+ * counted and ignored. If the venue's side is known to be deeper (a snapshot or an
+ * update said so, or an insert pushed a level out), a Delete leaves the held side one
+ * level short of the venue's. The held levels stay exact, so the book stays synced,
+ * but needs_snapshot() is set until the next apply_snapshot().
+ */
+class L2Book {
+public:
+    static constexpr size_t kMaxDepth = 32;
+
+    L2Book(uint32_t venue_id, uint32_t instrument_id);
+
+    L2Book(const L2Book&) = delete;
+    L2Book& operator=(const L2Book&) = delete;
+
+    /** @brief Applies all level updates of one message. Feed thread only. */
+    L2ApplyResult apply(uint32_t sequence, uint64_t timestamp_ns, std::span<const L2LevelUpdate> updates);
+
+    /** @brief Replaces the book (best level first) and resumes after `sequence`. Feed thread only. */
+    void apply_snapshot(uint32_t sequence,
+                        uint64_t timestamp_ns,
+                        std::span<const gateway::QuoteLevel> bids,
+                        std::span<const gateway::QuoteLevel> asks);
+
+    /**
+     * @brief Copies up to `max_depth` levels per side into `out`, reusing its storage.
+     * @return false (and leaves `out` untouched) while the book waits for a snapshot.
+     */
+    bool snapshot_into(gateway::VenueOrderBookSnapshot* out, size_t max_depth = kMaxDepth) const;
+
+    /** @brief Best-first levels; feed thread only. */
+    std::span<const gateway::QuoteLevel> bids() const {
+        return {state_.bids.data(), state_.bid_depth};
+    }
+    std::span<const gateway::QuoteLevel> asks() const {
+        return {state_.asks.data(), state_.ask_depth};
+    }
+
+    uint32_t sequence() const {
+        return state_.sequence;
+    }
+    bool synced() const {
+        return state_.synced;
+    }
+    /** @brief A side holds fewer levels than the venue shows; feed thread only. */
+    bool needs_snapshot() const {
+        return state_.needs_snapshot;
+    }
+    /** @brief Updates ignored because their level is past kMaxDepth; feed thread only. */
+    uint64_t truncated_updates() const {
+        return truncated_updates_;
+    }
+    uint32_t venue_id() const {
+        return venue_id_;
+    }
+    uint32_t instrument_id() const {
+        return instrument_id_;
+    }
+
+private:
+    struct State {
+        std::array<gateway::QuoteLevel, kMaxDepth> bids{};
+        std::array<gateway::QuoteLevel, kMaxDepth> asks{};
+        uint32_t bid_depth = 0;
+        uint32_t ask_depth = 0;
+        uint32_t sequence = 0;
+        bool synced = true;
+        bool bid_deeper = false; // the venue has bid levels past kMaxDepth
+        bool ask_deeper = false;
+        bool needs_snapshot = false;
+        uint64_t timestamp_ns = 0;
+    };
+
+    static bool apply_level(State& state, const L2LevelUpdate& update, uint64_t* truncated);
+    void begin_write();
+    void end_write();
+    void desync();
+
+    uint32_t venue_id_;
+    uint32_t instrument_id_;
+    std::string venue_name_;
+    std::string symbol_;
+    std::atomic<uint64_t> version_{0}; // odd while a write is in progress
+    State state_;
+    uint64_t truncated_updates_ = 0;
+};
+
+struct L2FeedStats {
+    uint64_t messages = 0;
+    uint64_t applied = 0;
+    uint64_t duplicates = 0;
+    uint64_t gaps = 0;
+    uint64_t stale = 0;
+    uint64_t invalid = 0;
+    uint64_t unknown_book = 0;
+    uint64_t truncated = 0;   // level updates past L2Book::kMaxDepth, ignored
+    uint64_t short_books = 0; // books flagged needs_snapshot() by a Delete
+};
+
+/**
+ * @class L2FeedHandler
+ * @brief Routes incremental depth messages to per-venue, per-instrument L2Books.
+ * Books are registered with add_book() before the feed starts; the lookup path after
+ * that is a hash probe plus the in-place level update. Sequence numbers are per book
+ * (SBE rpt_seq). On a gap or an out-of-range level the book is cleared and the gap
+ * handler fires so the caller can request a snapshot; updates are dropped until
+ * apply_snapshot() resyncs it. When a book turns needs_snapshot() the gap handler also
+ * fires, with expected == received, but the book keeps applying updates.
+ *
+ * collect_snapshots() fills the vector SmartOrderRouter::route_l2 takes, reusing the
+ * caller's snapshots, so routing reads live depth without rebuilding books per order.
+ */
+class L2FeedHandler {
+public:
+    using GapHandler = std::function<void(const L2Book& book, uint32_t expected, uint32_t received)>;
+
+    L2FeedHandler() = default;
+
+    L2FeedHandler(const L2FeedHandler&) = delete;
+    L2FeedHandler& operator=(const L2FeedHandler&) = delete;
+
+    /** @brief Registers (or returns) the book for a venue/instrument id pair. Setup only. */
+    L2Book* add_book(uint32_t venue_id, uint32_t instrument_id);
+
+    L2Book* find(uint32_t venue_id, uint32_t instrument_id) const;
+
+    void set_gap_handler(GapHandler handler) {
+        gap_handler_ = std::move(handler);
+    }
+
+    L2ApplyResult apply(uint32_t venue_id,
+                        uint32_t instrument_id,
+                        uint32_t sequence,
+                        uint64_t timestamp_ns,
+                        std::span<const L2LevelUpdate> updates);
+
+    /**
+     * @brief Applies the BookUpdate events of a decoded SBE packet; consecutive
+     * entries with the same security and rpt_seq form one message. Instruments are
+     * resolved from the event symbol through the alias table. Other templates are ignored.
+     * @return Number of book messages applied.
+     */
+    size_t apply_sbe_events(uint32_t venue_id, std::span<const SbeMarketEvent> events);
+
+    /**
+     * @brief One snapshot per synced venue book of `instrument_id`, written into `*out`
+     * (resized to the count, existing elements reused).
+     */
+    size_t collect_snapshots(uint32_t instrument_id,
+                             std::vector<gateway::VenueOrderBookSnapshot>* out,
+                             size_t max_depth = L2Book::kMaxDepth) const;
+
+    /** @brief Counters; read from the feed thread. */
+    const L2FeedStats& stats() const {
+        return stats_;
+    }
+
+private:
+    static uint64_t book_key(uint32_t venue_id, uint32_t instrument_id) {
+        return (static_cast<uint64_t>(venue_id) << 32) | instrument_id;
+    }
+
+    std::vector<std::unique_ptr<L2Book>> books_;
+    std::unordered_map<uint64_t, L2Book*> index_;
+    GapHandler gap_handler_;
+    L2FeedStats stats_;
+};
+
+} // namespace argentum::datafeed
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace argentum::datafeed {
+
+/** @brief Which of the two redundant copies of a feed a message arrived on. */
+enum class FeedLine : uint8_t { A = 0, B = 1 };
+
+enum class ArbitrationResult : uint8_t {
+    Accepted,  // first arrival, at or beyond the highest sequence seen so far
+    Recovered, // first arrival of a sequence that was skipped earlier (fills a hole)
+    Duplicate, // already delivered from either line
+    Stale      // older than the window (or the session start); cannot be told apart from a duplicate
+};
+
+/** @brief Sequences [first_seq, last_seq] that neither line delivered. */
+struct LineGap {
+    uint64_t first_seq = 0;
+    uint64_t last_seq = 0;
+};
+
+struct ArbitrationStats {
+    uint64_t accepted = 0;
+    uint64_t recovered = 0;
+    uint64_t duplicates = 0;
+    uint64_t stale = 0;
+    uint64_t lost = 0;          // sequences reported in gaps
+    uint64_t gaps = 0;          // LineGap ranges reported
+    uint64_t won[2] = {0, 0};   // first arrivals per FeedLine (accepted + recovered)
+};
+
+/**
+ * @class LineArbitrator
+ * @brief A/B arbitration of one sequenced feed: the first copy of each sequence number
+ * wins, whichever line it came from, and later copies are dropped.
+ * Delivery state is a ring bitmap over the last `window` sequences, so every check is
+ * one bit test. Nothing is buffered: in-order and ahead-of-order messages are accepted
+ * immediately, and a skipped sequence stays open until the other line fills it
+ * (Recovered) or it slides out of the window, at which point it is reported as a gap.
+ * finish() reports the holes still open at the end of a session.
+ * Not thread-safe; feed both lines from one thread (e.g. one poll loop).
+ */
+class LineArbitrator {
+public:
+    using GapHandler = std::function<void(const LineGap& gap)>;
+
+    static constexpr size_t kDefaultWindow = 4096;
+
+    /** @param window sequences remembered; rounded up to a power of two, at least 64. */
+    explicit LineArbitrator(size_t window = kDefaultWindow);
+
+    void set_gap_handler(GapHandler handler) {
+        gap_handler_ = std::move(handler);
+    }
+
+    ArbitrationResult on_message(FeedLine line, uint64_t seq);
+
+    /** @brief True if the message should be forwarded (Accepted or Recovered). */
+    static bool forward(ArbitrationResult result) {
+        return result == ArbitrationResult::Accepted || result == ArbitrationResult::Recovered;
+    }
+
+    /** @brief Reports every hole still inside the window and starts a new session. */
+    void finish();
+
+    /** @brief Highest sequence delivered so far (0 before the first message). */
+    uint64_t highest_seq() const {
+        return highest_;
+    }
+
+    size_t window() const {
+        return mask_ + 1;
+    }
+
+    const ArbitrationStats& stats() const {
+        return stats_;
+    }
+
+private:
+    bool seen(uint64_t seq) const {
+        return (bits_[(seq & mask_) >> 6] >> (seq & 63)) & 1u;
+    }
+    void mark(uint64_t seq) {
+        bits_[(seq & mask_) >> 6] |= uint64_t{1} << (seq & 63);
+    }
+    void clear(uint64_t seq) {
+        bits_[(seq & mask_) >> 6] &= ~(uint64_t{1} << (seq & 63));
+    }
+
+    void advance_to(uint64_t seq);
+    void report_lost(uint64_t first, uint64_t last);
+    void flush_gap();
+
+    std::vector<uint64_t> bits_;
+    uint64_t mask_ = 0;
+    bool started_ = false;
+    uint64_t first_ = 0;   // first sequence of the session; older ones are Stale
+    uint64_t highest_ = 0;
+    bool gap_open_ = false;
+    LineGap pending_gap_;
+    GapHandler gap_handler_;
+    ArbitrationStats stats_;
+};
+
+} // namespace argentum::datafeed
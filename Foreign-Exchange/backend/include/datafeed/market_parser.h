@@ -2,6 +2,7 @@
 #define ARGENTUM_DATAFEED_MARKET_PARSER_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include "core/types.h"
 #include "core/errors.h"
 
@@ -17,10 +18,22 @@ typedef enum {
 
 /**
  * @brief Parse a raw feed message into a MarketTick.
+ * For FEED_FORMAT_SBE, `data` is one Trade message (see datafeed/sbe_decoder.h);
+ * use sbe_decode_packet() for packets and book updates.
  * @return ARGENTUM_OK on success, error code on failure.
  */
 ArgentumStatus parse_market_message(FeedFormat format, const char* data, size_t len, MarketTick* out);
 
+/**
+ * @brief parse_market_message that also reports the feed sequence number:
+ * JSON "seq", FIX MsgSeqNum (34). `*out_seq` is 0 when the message carries none.
+ */
+ArgentumStatus parse_market_message_seq(FeedFormat format,
+                                        const char* data,
+                                        size_t len,
+                                        MarketTick* out,
+                                        uint64_t* out_seq);
+
 #ifdef __cplusplus
 }
 #endif
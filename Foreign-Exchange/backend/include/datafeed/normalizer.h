@@ -2,6 +2,7 @@
 #define ARGENTUM_DATAFEED_NORMALIZER_H
 
 #include <stddef.h>
+#include <stdint.h>
 #include "core/errors.h"
 
 #ifdef __cplusplus
@@ -14,6 +15,25 @@ extern "C" {
  */
 ArgentumStatus normalize_symbol(const char* in, char* out, size_t out_len);
 
+/**
+ * @brief Canonical name and instrument id for a raw (not NUL-terminated) venue spelling.
+ * Known spellings resolve with one probe of core::symbol_aliases(); anything else goes
+ * through normalize_symbol and an instrument_registry() lookup, leaving *out_id = 0 for
+ * instruments nobody registered.
+ * @return ARGENTUM_OK, ARGENTUM_ERR_PARSE if `raw` is too long to normalize, or the
+ * normalize_symbol error.
+ */
+ArgentumStatus resolve_symbol(const char* raw, size_t raw_len, char* out, size_t out_len, uint32_t* out_id);
+
+/**
+ * @brief Instrument id for any spelling of a symbol, for keying per-instrument state.
+ * The resolve_symbol canonical name is looked up in instrument_registry() (registered
+ * there first when `intern` is nonzero); spellings normalize_symbol rejects ("AAPL")
+ * use their upper-case form with separators stripped instead.
+ * @return The id, or 0 if the spelling is empty, too long, or unknown and not interned.
+ */
+uint32_t instrument_id_for_symbol(const char* raw, size_t raw_len, int intern);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "core/latency_histogram.hpp"
+
+#include <cstdint>
+
+namespace argentum::datafeed {
+
+struct ReplayClockConfig {
+    double speed = 1.0;                   // 1 = recorded pace, 10 = ten times faster; <= 0 = as fast as possible
+    uint64_t spin_threshold_ns = 200'000; // sleep until this close to a deadline, then spin
+};
+
+struct ReplayLagStats {
+    uint64_t events = 0;
+    uint64_t late_events = 0;      // released more than late_tolerance_ns after their deadline
+    core::LatencyPercentiles lag;  // release time - scheduled time
+};
+
+/**
+ * @class ReplayClock
+ * @brief Releases recorded events at their original spacing, optionally sped up.
+ * The first event with a nonzero timestamp anchors the schedule: event t is due at
+ * anchor_wall + (t - anchor_ts) / speed on the monotonic clock. Waiting sleeps
+ * while the deadline is far away and spins the final spin_threshold_ns, because
+ * sleep granularity alone cannot hold sub-millisecond gaps. Timestamps that go
+ * backwards (or are 0) are treated as simultaneous with the previous event; events
+ * without a timestamp before the anchor are released immediately.
+ * Not thread-safe; one clock per replay loop.
+ */
+class ReplayClock {
+public:
+    static constexpr uint64_t kLateToleranceNs = 10'000;
+
+    explicit ReplayClock(ReplayClockConfig config = {});
+
+    /** @brief Forgets the anchor; the next event starts a new schedule. Lag statistics are kept. */
+    void rearm();
+
+    /**
+     * @brief Blocks until `event_ts_ns` is due and returns how late the release was (ns).
+     */
+    uint64_t wait_for_event(uint64_t event_ts_ns);
+
+    ReplayLagStats stats() const;
+
+    const ReplayClockConfig& config() const {
+        return config_;
+    }
+
+private:
+    ReplayClockConfig config_;
+    bool anchored_ = false;
+    uint64_t anchor_ts_ns_ = 0;
+    uint64_t anchor_wall_ns_ = 0;
+    uint64_t last_ts_ns_ = 0;
+    uint64_t events_ = 0;
+    uint64_t late_events_ = 0;
+    core::LatencyHistogram lag_;
+};
+
+} // namespace argentum::datafeed
@@ -0,0 +1,140 @@
+#ifndef ARGENTUM_DATAFEED_SBE_DECODER_H
+#define ARGENTUM_DATAFEED_SBE_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "core/types.h"
+#include "core/errors.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * SBE-style binary market data (schema ARGENTUM_SBE_SCHEMA_ID, version 1).
+ * All integers are little-endian at fixed offsets. Prices and quantities are
+ * int64 mantissas with exponent -6, i.e. core::kPriceScale / kQuantityScale.
+ *
+ * Packet:   PacketHeader, then messages back to back.
+ * Message:  uint16 msg_size (includes itself) | MessageHeader | root block [| groups]
+ * Decoders read the root block through the header's block_length, so newer schema
+ * versions that append fields remain decodable; unknown templates are skipped.
+ */
+
+#define ARGENTUM_SBE_SCHEMA_ID 0x4147
+#define ARGENTUM_SBE_SCHEMA_VERSION 1
+
+/* PacketHeader: uint32 sequence_number, uint64 sending_time_ns. */
+#define SBE_PACKET_HEADER_SIZE 12
+#define SBE_PACKET_OFF_SEQUENCE 0
+#define SBE_PACKET_OFF_SENDING_TIME 4
+
+#define SBE_MSG_SIZE_FIELD 2
+
+/* MessageHeader: uint16 block_length, template_id, schema_id, version. */
+#define SBE_MESSAGE_HEADER_SIZE 8
+#define SBE_HDR_OFF_BLOCK_LENGTH 0
+#define SBE_HDR_OFF_TEMPLATE_ID 2
+#define SBE_HDR_OFF_SCHEMA_ID 4
+#define SBE_HDR_OFF_VERSION 6
+
+/* Repeating group dimension: uint16 block_length, uint8 num_in_group. */
+#define SBE_GROUP_HEADER_SIZE 3
+
+typedef enum {
+    SBE_TEMPLATE_TRADE = 1,
+    SBE_TEMPLATE_TOP_OF_BOOK = 2,
+    SBE_TEMPLATE_BOOK_UPDATE = 3
+} SbeTemplateId;
+
+/* Trade (template 1). */
+#define SBE_TRADE_BLOCK_LENGTH 48
+#define SBE_TRADE_OFF_TIME 0
+#define SBE_TRADE_OFF_PRICE 8
+#define SBE_TRADE_OFF_QUANTITY 16
+#define SBE_TRADE_OFF_SECURITY_ID 24
+#define SBE_TRADE_OFF_AGGRESSOR 28
+#define SBE_TRADE_OFF_SYMBOL 32
+
+/* TopOfBook (template 2). */
+#define SBE_TOB_BLOCK_LENGTH 64
+#define SBE_TOB_OFF_TIME 0
+#define SBE_TOB_OFF_BID_PRICE 8
+#define SBE_TOB_OFF_BID_QUANTITY 16
+#define SBE_TOB_OFF_ASK_PRICE 24
+#define SBE_TOB_OFF_ASK_QUANTITY 32
+#define SBE_TOB_OFF_SECURITY_ID 40
+#define SBE_TOB_OFF_RPT_SEQ 44
+#define SBE_TOB_OFF_SYMBOL 48
+
+/* BookUpdate (template 3): root block, then one group of level entries. */
+#define SBE_BOOK_BLOCK_LENGTH 32
+#define SBE_BOOK_OFF_TIME 0
+#define SBE_BOOK_OFF_SECURITY_ID 8
+#define SBE_BOOK_OFF_RPT_SEQ 12
+#define SBE_BOOK_OFF_SYMBOL 16
+#define SBE_BOOK_ENTRY_LENGTH 24
+#define SBE_ENTRY_OFF_PRICE 0
+#define SBE_ENTRY_OFF_QUANTITY 8
+#define SBE_ENTRY_OFF_ACTION 16
+#define SBE_ENTRY_OFF_SIDE 17
+#define SBE_ENTRY_OFF_LEVEL 18
+
+#define SBE_SYMBOL_LENGTH 16
+
+typedef enum {
+    SBE_ACTION_NEW = 0,
+    SBE_ACTION_CHANGE = 1,
+    SBE_ACTION_DELETE = 2
+} SbeUpdateAction;
+
+/**
+ * @brief One decoded market data event. BookUpdate messages yield one event per
+ * group entry; TopOfBook fills both the bid (price/quantity) and ask_* fields.
+ */
+typedef struct {
+    uint64_t transact_time_ns;
+    int64_t price_ticks;
+    int64_t quantity_lots;
+    int64_t ask_price_ticks;
+    int64_t ask_quantity_lots;
+    uint32_t security_id;
+    uint32_t rpt_seq;
+    uint16_t template_id;
+    uint8_t side;          /* trade aggressor / book side: SIDE_BUY (bid) or SIDE_SELL (ask) */
+    uint8_t update_action; /* SbeUpdateAction, book updates only */
+    uint8_t price_level;   /* book updates only, 1-based */
+    char symbol[SBE_SYMBOL_LENGTH + 1];
+} SbeMarketEvent;
+
+typedef struct {
+    uint32_t sequence_number;
+    uint64_t sending_time_ns;
+    size_t messages;         /* messages walked, including skipped ones */
+    size_t skipped_messages; /* unknown template or foreign schema */
+} SbePacketInfo;
+
+/**
+ * @brief Decode every message of one packet into `events`.
+ * @return ARGENTUM_ERR_PROTO on a malformed packet (nothing past the bad message is
+ * decoded), ARGENTUM_ERR_RANGE if `events` filled up; `*out_count` is always the
+ * number of events written.
+ */
+ArgentumStatus sbe_decode_packet(const uint8_t* data,
+                                 size_t len,
+                                 SbePacketInfo* info,
+                                 SbeMarketEvent* events,
+                                 size_t max_events,
+                                 size_t* out_count);
+
+/**
+ * @brief Decode a single Trade message (MessageHeader + block, no msg_size prefix)
+ * into a MarketTick; backs parse_market_message(FEED_FORMAT_SBE, ...).
+ */
+ArgentumStatus sbe_decode_trade_tick(const uint8_t* data, size_t len, MarketTick* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ARGENTUM_DATAFEED_SBE_DECODER_H
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace argentum::persist {
+
+enum class AsyncFileBackend : uint8_t {
+    IoUring = 0, // writes and fsyncs queued on an io_uring, many in flight
+    Pwritev = 1  // full buffers gathered into one pwritev; sync() is a blocking fdatasync
+};
+
+struct AsyncFileConfig {
+    size_t buffer_bytes = 256 * 1024; // size of each registered buffer (rounded up to 4 KiB)
+    size_t buffer_count = 8;          // buffers, so at most this many writes in flight
+    bool use_io_uring = true;         // false forces the pwritev backend
+};
+
+struct AsyncFileStats {
+    uint64_t bytes_written = 0; // completed
+    uint64_t writes = 0;        // write operations issued
+    uint64_t syncs = 0;         // fdatasyncs completed
+    uint64_t failed = 0;        // writes or syncs that failed or came back short
+    uint64_t buffer_waits = 0;  // times write() had to wait for a buffer to come back
+};
+
+/**
+ * @class AsyncFile
+ * @brief Append-only file writer that keeps the caller off the disk. write() copies into
+ * one of a fixed set of buffers; a full buffer is submitted as one write at its file
+ * offset and the caller moves on to the next buffer, so up to buffer_count writes and
+ * any number of syncs are in flight together. The caller only blocks when every buffer
+ * is still in flight.
+ *
+ * With io_uring (Linux, built with ARGENTUM_USE_IO_URING) the buffers are registered
+ * with the ring once and written with WRITE_FIXED. sync() links the last partial write
+ * to an fdatasync and drains earlier writes first, so the sync only completes once
+ * everything written before it is on disk, and a failed write cancels it. When the
+ * ring cannot be created (old kernel, seccomp, memlock limits) the same API runs on
+ * pwritev.
+ * Not thread-safe; one owner thread per file.
+ */
+class AsyncFile {
+public:
+    explicit AsyncFile(AsyncFileConfig config = {});
+    ~AsyncFile();
+
+    AsyncFile(const AsyncFile&) = delete;
+    AsyncFile& operator=(const AsyncFile&) = delete;
+
+    /** @brief Opens `path` for appending (or truncates it); closes any open file first. */
+    bool open(const std::string& path, bool truncate = false);
+    bool is_open() const {
+        return fd_ >= 0;
+    }
+
+    /** @return false if no file is open or a buffer could not be obtained. */
+    bool write(const void* data, size_t size);
+
+    /** @brief Submits the partly filled buffer. Does not wait. */
+    void flush();
+
+    /** @brief flush() plus an fdatasync ordered after every earlier write. */
+    void sync();
+
+    /** @brief Waits for every submitted operation; false if any failed since the last wait. */
+    bool wait();
+
+    /** @brief flush(), wait() and close the descriptor. Returns wait()'s result. */
+    bool close();
+
+    /** @brief Logical file size: everything written so far, submitted or not. */
+    uint64_t size() const {
+        return offset_ + fill_;
+    }
+
+    AsyncFileBackend backend() const {
+        return backend_;
+    }
+
+    const AsyncFileStats& stats() const {
+        return stats_;
+    }
+
+private:
+    struct Uring;
+
+    bool ensure_buffers();
+    uint8_t* buffer(uint32_t index) const {
+        return buffers_ + static_cast<size_t>(index) * buffer_bytes_;
+    }
+    bool acquire_buffer();
+    bool reap(bool block);
+    void submit_current(bool link_sync);
+    void write_pending();
+    void complete_write(uint32_t index, int64_t result);
+
+    AsyncFileConfig config_;
+    AsyncFileBackend backend_ = AsyncFileBackend::Pwritev;
+    std::unique_ptr<Uring> uring_;
+    bool uring_tried_ = false;
+
+    int fd_ = -1;
+    uint8_t* buffers_ = nullptr;
+    size_t buffer_bytes_ = 0;
+    std::vector<uint32_t> free_;
+    std::vector<uint32_t> lengths_; // bytes submitted per buffer while it is in flight
+    int64_t current_ = -1;          // buffer being filled
+    size_t fill_ = 0;
+    uint64_t offset_ = 0;           // file offset where the current buffer's data starts
+
+    // pwritev backend: full buffers waiting to be written, in file order.
+    std::vector<std::pair<uint32_t, uint32_t>> pending_;
+    uint64_t pending_offset_ = 0;
+
+    AsyncFileStats stats_;
+    uint64_t failed_reported_ = 0;
+};
+
+} // namespace argentum::persist
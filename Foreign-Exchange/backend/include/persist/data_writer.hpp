@@ -1,23 +1,50 @@
 #pragma once
 
+#include "core/mpsc_ring.hpp"
 #include "core/types.h"
+#include "persist/async_file.hpp"
+#include "persist/pg_copy_encoder.hpp"
+#include "persist/tick_store.hpp"
 
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <cstdint>
-#include <deque>
+#include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
 
-namespace argentum::persist {
-
 #ifdef ARGENTUM_USE_LIBPQ
-struct PGconn;
+// Same declaration as libpq-fe.h, which must not leak into this header.
+typedef struct pg_conn PGconn;
 #endif
 
+namespace argentum::persist {
+
+struct DataWriterShardStats {
+    uint64_t queued = 0;         // ticks waiting in the shard's ring
+    uint64_t written = 0;        // ticks handed to the database or local output
+    uint64_t dropped = 0;
+    uint64_t failed_flushes = 0;
+};
+
+/**
+ * @class DataWriterService
+ * @brief Batches market ticks to TimescaleDB, or to local files when there is no database.
+ * enqueue() is lock-free on the fast path: ticks go into a bounded MPSC ring and the
+ * worker flushes them straight from the ring slots. Only Block producers facing a full
+ * ring, after spinning, and an idle worker ever touch a mutex.
+ *
+ * With set_shard_count(n) ticks are split across n shards by a hash of the symbol's
+ * tick store directory name, so one symbol always lands on the same shard. Each shard
+ * has its own ring, worker thread, flush timer, database connection and files; tick
+ * store shards share the root, and symbols that map to the same directory
+ * ("EUR/USD", "EUR-USD", "EUR_USD") go to the same shard, so each directory has a
+ * single writer.
+ */
 class DataWriterService {
 public:
     enum class OverflowPolicy {
@@ -26,6 +53,12 @@ public:
         Block = 2
     };
 
+    /** @brief Where batches go when there is no database (or it fails). */
+    enum class LocalFormat {
+        TickStore = 0, // columnar segments, see persist/tick_store.hpp
+        Csv = 1
+    };
+
     explicit DataWriterService(std::string connection_string = {});
     ~DataWriterService();
 
@@ -35,44 +68,105 @@ public:
     void enqueue(const MarketTick& tick);
     void enqueue_batch(const MarketTick* ticks, size_t count);
 
+    /** @brief Queue sizing and shard count; take effect at the first start(). */
+    void set_shard_count(size_t shards);
     void set_max_batch(size_t max_batch);
     void set_flush_interval_ms(uint32_t ms);
     void set_queue_capacity(size_t capacity);
     void set_overflow_policy(OverflowPolicy policy);
+    /** @brief Block policy: pause iterations on a full queue before parking the producer. */
+    void set_block_spin_budget(uint32_t spins);
+
+    void set_local_format(LocalFormat format);
+    void set_tick_store_path(std::string root);
+    void set_tick_store_config(const TickStoreConfig& config);
 
+    /** @brief With more than one shard, shard k writes <stem>.<k><extension>. */
     void set_csv_path(std::string path);
     void set_csv_max_bytes(uint64_t max_bytes);
+    /** @brief With fsync on, each batch is followed by an fdatasync queued behind it. */
     void set_csv_fsync(bool enabled);
+    /** @brief Buffers and backend (io_uring or pwritev) for the CSV files. */
+    void set_file_config(const AsyncFileConfig& config);
+
+    size_t shard_count() const;
+    /** @brief Shard that persists `tick`, stable for a given symbol directory and shard count. */
+    size_t shard_for(const MarketTick& tick) const;
+    DataWriterShardStats shard_stats(size_t shard) const;
+    /** @brief Sum over all shards. */
+    DataWriterShardStats stats() const;
 
     uint64_t dropped_count() const;
     uint64_t failed_flush_count() const;
+    uint64_t dropped_count(size_t shard) const;
+    uint64_t failed_flush_count(size_t shard) const;
 
 private:
-    void worker_loop();
-    void flush_batch(std::vector<MarketTick>& batch);
-    void flush_csv(std::vector<MarketTick>& batch);
+    struct Shard {
+        size_t index = 0;
+        std::unique_ptr<core::MpscRing<MarketTick>> ring;
+        std::mutex wake_mutex;
+        std::condition_variable cv;       // worker: ring became non-empty
+        std::condition_variable cv_space; // Block producers: slots were released
+        std::atomic<bool> worker_waiting{false};
+        std::atomic<uint32_t> space_waiters{0};
+        std::atomic<uint64_t> written{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> failed_flushes{0};
+        std::unique_ptr<TickStoreWriter> tick_store;
+        std::string csv_path;
+        std::unique_ptr<AsyncFile> csv;
+        std::thread worker;
+#ifdef ARGENTUM_USE_LIBPQ
+        PGconn* pg_conn = nullptr;
+        uint64_t reconnect_backoff_ms = 250;
+        PgTickCopyEncoder copy;
+        // Ticks of the COPY whose result has not been read yet, kept for the local
+        // fallback because their ring slots are already released.
+        std::vector<MarketTick> copy_in_flight;
+        bool copy_pending = false;
+        bool copy_failed = false; // a result read so far for the pending COPY was an error
+#endif
+    };
+
+    bool push(Shard& shard, const MarketTick& tick);
+    bool push_blocking(Shard& shard, const MarketTick& tick);
+    void wake_worker(Shard& shard);
+    void worker_loop(Shard& shard);
+    void flush_batch(Shard& shard, std::span<const MarketTick> batch);
+    void flush_local(Shard& shard, std::span<const MarketTick> batch);
+    void flush_tick_store(Shard& shard, std::span<const MarketTick> batch);
+    void flush_csv(Shard& shard, std::span<const MarketTick> batch);
+    bool open_csv(Shard& shard);
+    void close_local(Shard& shard);
+#ifdef ARGENTUM_USE_LIBPQ
+    bool ensure_pg(Shard& shard);
+    bool send_copy(Shard& shard);
+    void finish_pending_copy(Shard& shard, bool wait);
+#endif
 
     std::string connection_string_;
-    std::mutex mutex_;
-    std::condition_variable cv_;
-    std::condition_variable cv_space_;
-    std::deque<MarketTick> queue_;
+    // Created at the first start() and kept until destruction, so a producer racing
+    // with stop() never touches freed slots.
+    std::vector<std::unique_ptr<Shard>> shards_;
+    size_t shard_count_ = 1;
     size_t max_batch_ = 1024;
     uint32_t flush_interval_ms_ = 100;
     size_t queue_capacity_ = 8192;
     OverflowPolicy overflow_policy_ = OverflowPolicy::DropNewest;
-    std::atomic<uint64_t> dropped_{0};
-    std::atomic<uint64_t> failed_flushes_{0};
+    uint32_t block_spin_budget_ = 4096;
+
+    LocalFormat local_format_ = LocalFormat::TickStore;
+    std::string tick_store_path_ = "data/ticks";
+    TickStoreConfig tick_store_config_{};
 
     std::string csv_path_ = "data/market_ticks.csv";
     uint64_t csv_max_bytes_ = 64ULL * 1024ULL * 1024ULL;
     bool csv_fsync_ = false;
+    AsyncFileConfig file_config_{};
     std::atomic<bool> running_{false};
-    std::thread worker_;
 
 #ifdef ARGENTUM_USE_LIBPQ
-    struct PGconn* pg_conn_ = nullptr;
-    uint64_t reconnect_backoff_ms_ = 250;
     uint64_t reconnect_backoff_max_ms_ = 5000;
 #endif
 };
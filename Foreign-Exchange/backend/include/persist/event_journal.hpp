@@ -1,9 +1,9 @@
 #pragma once
 
 #include "core/types.h"
+#include "persist/async_file.hpp"
 
 #include <cstdint>
-#include <fstream>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -37,20 +37,32 @@ struct JournalEvent {
     bool resting = false;
 };
 
+inline constexpr AsyncFileConfig kJournalFileConfig{64 * 1024, 4, true};
+
+/**
+ * @class EventJournal
+ * @brief Append-only JSONL order event log. append() only copies the line into the
+ * file's write buffers (see AsyncFile); disk writes happen in the background.
+ */
 class EventJournal {
 public:
-    explicit EventJournal(std::string path = "data/order_events.jsonl");
+    explicit EventJournal(std::string path = "data/order_events.jsonl",
+                          AsyncFileConfig file_config = kJournalFileConfig);
     ~EventJournal();
 
     bool append(const JournalEvent& event);
+    /** @brief Returns once every appended line has been written to the file. */
     void flush();
+    /** @brief Queues an fdatasync after everything appended so far; does not wait. */
+    void sync();
     const std::string& path() const;
 
 private:
     std::string path_;
     uint64_t next_seq_ = 1;
     uint64_t last_timestamp_ns_ = 0;
-    std::ofstream file_;
+    AsyncFile file_;
+    std::string line_;
     mutable std::mutex mutex_;
 };
 
@@ -71,6 +83,7 @@ struct ReplaySummary {
     uint64_t trades = 0;
     uint64_t canceled = 0;
     uint64_t replaced = 0;
+    uint64_t checksummed_events = 0; // lines whose crc32c verified; a mismatch fails the replay
     bool monotonic_seq = true;
     bool monotonic_time = true;
     int64_t committed_exposure_units = 0;
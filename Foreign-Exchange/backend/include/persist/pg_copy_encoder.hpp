@@ -0,0 +1,52 @@
+#pragma once
+
+#include "core/types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace argentum::persist {
+
+/** @brief Microseconds between the Unix epoch and PostgreSQL's (2000-01-01 UTC). */
+inline constexpr int64_t kPgEpochOffsetUs = 946'684'800'000'000LL;
+
+/** @brief Unix nanoseconds as a PostgreSQL timestamptz (microseconds since 2000-01-01). */
+inline int64_t pg_timestamp_us(uint64_t unix_ns) {
+    return static_cast<int64_t>(unix_ns / 1000) - kPgEpochOffsetUs;
+}
+
+/**
+ * @class PgTickCopyEncoder
+ * @brief Encodes market ticks as a PostgreSQL binary COPY stream for
+ * `market_ticks (time, symbol, price, volume, side, source)` (infra/db/init.sql):
+ * timestamptz as int64 microseconds, price and volume as big-endian float8 taken
+ * straight from the double's bits, side as a one-byte bpchar. Nothing is formatted as
+ * text; each field is a few byte stores into a buffer sized once per batch.
+ * The buffer is reused across batches: begin(), append()..., finish(), then data().
+ */
+class PgTickCopyEncoder {
+public:
+    static constexpr int16_t kColumnCount = 6;
+
+    /** @brief Starts a new stream (header only). */
+    void begin();
+    void append(const MarketTick& tick);
+    void append_batch(std::span<const MarketTick> ticks);
+    /** @brief Writes the end-of-data trailer. */
+    void finish();
+
+    std::span<const uint8_t> data() const {
+        return {buffer_.data(), buffer_.size()};
+    }
+    size_t rows() const {
+        return rows_;
+    }
+
+private:
+    std::vector<uint8_t> buffer_;
+    size_t rows_ = 0;
+};
+
+} // namespace argentum::persist
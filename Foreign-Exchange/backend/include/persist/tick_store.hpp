@@ -0,0 +1,199 @@
+#pragma once
+
+#include "core/mapped_file.hpp"
+#include "core/types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace argentum::persist {
+
+/*
+ * Segment file (little-endian, one symbol, one time partition):
+ *   timestamp_ns  u64[n]
+ *   price_ticks   i64[n]   (core::kPriceScale)
+ *   quantity_lots i64[n]   (core::kQuantityScale)
+ *   venue         u16[n]   index into the venue table
+ *   side          u8[n]
+ *   venue table   char[16] * venue_count
+ *   TickSegmentFooter
+ * Every column starts on an 8-byte boundary, so a mapped segment is read in place.
+ * Layout: <root>/<symbol dir>/<partition start ns>-<seq>.ats
+ */
+
+inline constexpr uint64_t kTickSegmentMagic = 0x31304745534B5441ULL; // "ATKSEG01"
+inline constexpr uint32_t kTickSegmentVersion = 1;
+inline constexpr size_t kTickSegmentNameLength = 16;
+
+struct TickSegmentFooter {
+    uint64_t magic = kTickSegmentMagic;
+    uint32_t version = kTickSegmentVersion;
+    uint32_t venue_count = 0;
+    uint64_t row_count = 0;
+    uint64_t min_timestamp_ns = 0;
+    uint64_t max_timestamp_ns = 0;
+    uint64_t timestamp_offset = 0;
+    uint64_t price_offset = 0;
+    uint64_t quantity_offset = 0;
+    uint64_t venue_offset = 0;
+    uint64_t side_offset = 0;
+    uint64_t venue_table_offset = 0;
+    char symbol[kTickSegmentNameLength] = {};
+};
+static_assert(sizeof(TickSegmentFooter) == 104, "TickSegmentFooter is part of the file format");
+
+struct TickStoreConfig {
+    uint64_t partition_ns = 3'600'000'000'000ULL; // one partition per symbol per hour
+    size_t rows_per_segment = 1U << 16;           // seal a segment once it holds this many ticks
+    uint64_t max_open_ns = 300'000'000'000ULL;    // seal_expired(): longest a segment may stay buffered (5 min)
+};
+
+/**
+ * @class TickStoreWriter
+ * @brief Append-only columnar tick store. Ticks are buffered per symbol as columns and
+ * sealed into an immutable segment file when the buffer fills, the tick's time partition
+ * changes, or the buffer has been open longer than max_open_ns (seal_expired()). Prices
+ * and quantities are converted to fixed point in bulk at seal time. A segment is written
+ * to a temporary name, fsynced and renamed into place, then its directory is fsynced, so
+ * readers only ever see complete files and a sealed segment survives a crash.
+ * Not thread-safe; one writer per root.
+ */
+class TickStoreWriter {
+public:
+    explicit TickStoreWriter(std::string root, TickStoreConfig config = {});
+    ~TickStoreWriter();
+
+    TickStoreWriter(const TickStoreWriter&) = delete;
+    TickStoreWriter& operator=(const TickStoreWriter&) = delete;
+
+    /** @return false if the tick has no symbol or a segment could not be written. */
+    bool append(const MarketTick& tick);
+    size_t append_batch(std::span<const MarketTick> ticks);
+
+    /** @brief Seals buffers opened before now_ns - max_open_ns; returns segments written. */
+    size_t seal_expired(uint64_t now_ns);
+
+    /** @brief Seals every buffer. */
+    bool flush();
+
+    const std::string& root() const {
+        return root_;
+    }
+    uint64_t segments_written() const {
+        return segments_written_;
+    }
+    uint64_t failed_writes() const {
+        return failed_writes_;
+    }
+
+private:
+    struct OpenSegment {
+        std::string symbol;
+        std::string directory;
+        bool directory_ready = false;
+        uint64_t partition = 0;
+        uint64_t opened_ns = 0;
+        uint32_t next_seq = 0;
+        std::vector<uint64_t> timestamps;
+        std::vector<double> prices;
+        std::vector<double> quantities;
+        std::vector<uint16_t> venues;
+        std::vector<uint8_t> sides;
+        std::vector<std::string> venue_names;
+        uint16_t last_venue = 0;
+    };
+
+    OpenSegment* segment_for(const MarketTick& tick);
+    static uint16_t venue_index(OpenSegment& segment, const char* source);
+    bool seal(OpenSegment& segment);
+
+    std::string root_;
+    TickStoreConfig config_;
+    std::unordered_map<std::string, OpenSegment> open_;
+    OpenSegment* last_ = nullptr;
+    std::vector<int64_t> scratch_;
+    uint64_t segments_written_ = 0;
+    uint64_t failed_writes_ = 0;
+};
+
+/**
+ * @class TickSegment
+ * @brief A mapped segment file. Columns are spans straight into the mapping: no parsing,
+ * no copies. Valid until close() or destruction.
+ */
+class TickSegment {
+public:
+    /** @return false if the file is missing, truncated, or not a version-1 segment. */
+    bool open(const std::string& path);
+    void close();
+
+    size_t size() const {
+        return static_cast<size_t>(footer_.row_count);
+    }
+    std::string_view symbol() const;
+    uint64_t min_timestamp_ns() const {
+        return footer_.min_timestamp_ns;
+    }
+    uint64_t max_timestamp_ns() const {
+        return footer_.max_timestamp_ns;
+    }
+
+    std::span<const uint64_t> timestamps() const {
+        return column<uint64_t>(footer_.timestamp_offset);
+    }
+    std::span<const int64_t> price_ticks() const {
+        return column<int64_t>(footer_.price_offset);
+    }
+    std::span<const int64_t> quantity_lots() const {
+        return column<int64_t>(footer_.quantity_offset);
+    }
+    std::span<const uint16_t> venues() const {
+        return column<uint16_t>(footer_.venue_offset);
+    }
+    std::span<const uint8_t> sides() const {
+        return column<uint8_t>(footer_.side_offset);
+    }
+    std::string_view venue_name(uint16_t index) const;
+
+    /** @brief Row `i` as a MarketTick (symbol and source filled in). */
+    void read_tick(size_t i, MarketTick* out) const;
+
+private:
+    template <typename T>
+    std::span<const T> column(uint64_t offset) const {
+        if (!file_.data()) return {};
+        return {reinterpret_cast<const T*>(file_.data() + offset), size()};
+    }
+
+    core::MappedFile file_;
+    TickSegmentFooter footer_{};
+};
+
+/** @brief How a symbol character appears in its directory name: alphanumerics kept, anything else '_'. */
+inline char tick_store_dir_char(char c) {
+    const bool alnum = (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+    return alnum ? c : '_';
+}
+
+/**
+ * @brief Directory name used for `symbol` under the store root ("BTC/USDT" -> "BTC_USDT").
+ * Distinct symbols can share a directory ("EUR/USD", "EUR-USD"); writers must not split them.
+ */
+std::string tick_store_symbol_dir(std::string_view symbol);
+
+/**
+ * @brief Segment files of `symbol` (every symbol if empty) whose [min, max] timestamps
+ * overlap [from_ns, to_ns], ordered by min timestamp. Only footers are read.
+ */
+std::vector<std::string> list_tick_segments(const std::string& root,
+                                            std::string_view symbol,
+                                            uint64_t from_ns = 0,
+                                            uint64_t to_ns = std::numeric_limits<uint64_t>::max());
+
+} // namespace argentum::persist
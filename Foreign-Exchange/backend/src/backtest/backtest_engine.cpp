@@ -1,15 +1,18 @@
 #include "backtest/backtest_engine.hpp"
 
 #include "core/fixed_point.hpp"
+#include "core/instrument_registry.hpp"
+#include "datafeed/normalizer.h"
+#include "persist/tick_store.hpp"
 
 #include <algorithm>
-#include <cctype>
 #include <cmath>
 #include <cstring>
 #include <fstream>
 #include <iostream>
 #include <numeric>
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 namespace argentum::backtest {
@@ -31,14 +34,10 @@ bool parse_i64_json_field(const std::string& json, const std::string& key, int64
     return true;
 }
 
-std::string to_compact_symbol(const std::string& raw) {
-    std::string out;
-    out.reserve(raw.size());
-    for (char c : raw) {
-        if (c == '/' || c == '-' || c == '_' || c == ' ' || c == '.') continue;
-        out.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
-    }
-    return out;
+// Instruments are matched by registry id, however the data spelled the symbol. Only the
+// requested symbol is registered; symbols read from data are looked up, never interned.
+uint32_t symbol_id(std::string_view symbol, int intern) {
+    return instrument_id_for_symbol(symbol.data(), symbol.size(), intern);
 }
 } // namespace
 
@@ -48,13 +47,14 @@ void BacktestEngine::load_data(const std::string& symbol, const std::string& sta
 
     history_.clear();
     trades_.clear();
+    unknown_symbol_ticks_ = 0;
 
     std::cout << "[Backtest] Loading persisted dataset for " << symbol << "..." << std::endl;
-    const bool ticks_ok = load_ticks_from_csv("data/market_ticks.csv", symbol);
+    const bool ticks_ok = load_ticks_from_store("data/ticks", symbol) || load_ticks_from_csv("data/market_ticks.csv", symbol);
     const bool trades_ok = load_trades_from_journal("data/order_events.jsonl");
 
     if (!ticks_ok) {
-        std::cout << "[Backtest] Warning: no tick CSV found; continuing with execution events only." << std::endl;
+        std::cout << "[Backtest] Warning: no tick store or CSV found; continuing with execution events only." << std::endl;
     }
     if (!trades_ok) {
         std::cout << "[Backtest] Warning: no event journal found; running with tick-only replay." << std::endl;
@@ -68,8 +68,11 @@ bool BacktestEngine::load_ticks_from_csv(const std::string& csv_path, const std:
     std::ifstream in(csv_path);
     if (!in.is_open()) return false;
 
-    const std::string symbol_filter = to_compact_symbol(symbol);
+    const uint32_t symbol_filter = symbol.empty() ? core::InstrumentRegistry::kInvalidId : symbol_id(symbol, 1);
+    if (!symbol.empty() && symbol_filter == core::InstrumentRegistry::kInvalidId) return false;
     std::string line;
+    std::string last_symbol;
+    uint32_t last_id = core::InstrumentRegistry::kInvalidId;
     bool loaded = false;
 
     while (std::getline(in, line)) {
@@ -91,22 +94,34 @@ bool BacktestEngine::load_ticks_from_csv(const std::string& csv_path, const std:
         if (!std::getline(ss, side_s, ',')) continue;
         if (!std::getline(ss, source_s, ',')) source_s.clear();
 
-        if (!symbol_filter.empty() && to_compact_symbol(symbol_s) != symbol_filter) {
+        if (symbol_s != last_symbol) {
+            last_symbol = symbol_s;
+            last_id = symbol_id(symbol_s, 0);
+        }
+        if (symbol_filter != core::InstrumentRegistry::kInvalidId && last_id != symbol_filter) {
+            continue;
+        }
+
+        int64_t price_ticks = 0;
+        int64_t quantity_lots = 0;
+        if (!core::parse_price_ticks(price_s, &price_ticks) || !core::parse_quantity_lots(qty_s, &quantity_lots)) {
             continue;
         }
 
         MarketTick tick{};
         tick.timestamp_ns = static_cast<uint64_t>(std::strtoull(ts_s.c_str(), nullptr, 10));
-        tick.price = std::strtod(price_s.c_str(), nullptr);
-        tick.quantity = std::strtod(qty_s.c_str(), nullptr);
+        tick.price = core::from_price_ticks(price_ticks);
+        tick.quantity = core::from_quantity_lots(quantity_lots);
         tick.side = static_cast<uint8_t>(
             (!side_s.empty() && (side_s[0] == 'B' || side_s[0] == 'b')) ? SIDE_BUY : SIDE_SELL);
         std::strncpy(tick.symbol, symbol_s.c_str(), sizeof(tick.symbol) - 1);
         std::strncpy(tick.source, source_s.c_str(), sizeof(tick.source) - 1);
+        tick.instrument_id = last_id;
 
         if (tick.timestamp_ns == 0 || tick.price <= 0.0 || tick.quantity <= 0.0) {
             continue;
         }
+        if (last_id == core::InstrumentRegistry::kInvalidId) ++unknown_symbol_ticks_;
 
         history_.push_back(tick);
         loaded = true;
@@ -119,6 +134,53 @@ bool BacktestEngine::load_ticks_from_csv(const std::string& csv_path, const std:
     return loaded;
 }
 
+bool BacktestEngine::load_ticks_from_store(const std::string& root, const std::string& symbol) {
+    const uint32_t symbol_filter = symbol.empty() ? core::InstrumentRegistry::kInvalidId : symbol_id(symbol, 1);
+    if (!symbol.empty() && symbol_filter == core::InstrumentRegistry::kInvalidId) return false;
+    bool loaded = false;
+    persist::TickSegment segment;
+    std::vector<double> prices;
+    std::vector<double> quantities;
+
+    for (const std::string& path : persist::list_tick_segments(root, "")) {
+        if (!segment.open(path)) continue;
+        const std::string segment_symbol(segment.symbol());
+        const uint32_t segment_id = symbol_id(segment_symbol, 0);
+        if (symbol_filter != core::InstrumentRegistry::kInvalidId && segment_id != symbol_filter) continue;
+
+        const size_t rows = segment.size();
+        prices.resize(rows);
+        quantities.resize(rows);
+        core::from_price_ticks_batch(segment.price_ticks(), prices);
+        core::from_quantity_lots_batch(segment.quantity_lots(), quantities);
+        const auto timestamps = segment.timestamps();
+        const auto sides = segment.sides();
+        const auto venues = segment.venues();
+
+        history_.reserve(history_.size() + rows);
+        for (size_t i = 0; i < rows; ++i) {
+            if (timestamps[i] == 0 || prices[i] <= 0.0 || quantities[i] <= 0.0) continue;
+            MarketTick tick{};
+            tick.timestamp_ns = timestamps[i];
+            tick.price = prices[i];
+            tick.quantity = quantities[i];
+            tick.side = sides[i];
+            std::strncpy(tick.symbol, segment_symbol.c_str(), sizeof(tick.symbol) - 1);
+            tick.instrument_id = segment_id;
+            if (segment_id == core::InstrumentRegistry::kInvalidId) ++unknown_symbol_ticks_;
+            const std::string_view venue = segment.venue_name(venues[i]);
+            std::memcpy(tick.source, venue.data(), std::min(venue.size(), sizeof(tick.source) - 1));
+            history_.push_back(tick);
+            loaded = true;
+        }
+    }
+
+    std::sort(history_.begin(), history_.end(), [](const MarketTick& a, const MarketTick& b) {
+        return a.timestamp_ns < b.timestamp_ns;
+    });
+    return loaded;
+}
+
 bool BacktestEngine::load_trades_from_journal(const std::string& journal_path) {
     std::ifstream in(journal_path);
     if (!in.is_open()) return false;
@@ -3,6 +3,7 @@
 #include "persist/data_writer.hpp"
 #include "core/time_utils.hpp"
 
+#include <array>
 #include <atomic>
 #include <iostream>
 #include <thread>
@@ -18,6 +19,7 @@ int main() {
     config.queue_capacity = 8192;
     config.policy = argentum::bus::BackpressurePolicy::DropNewest;
     config.consumer_threads = 1;
+    config.topic_wait["market.ticks"] = {argentum::bus::WaitStrategy::SpinPark, 4096};
 
     auto bus = argentum::bus::create_inproc_bus(config);
 
@@ -59,7 +61,7 @@ int main() {
         }
     });
 
-    std::vector<uint8_t> payload;
+    std::array<uint8_t, argentum::codec::kMarketTickMaxEncodedBytes> payload{};
     auto start_ns = argentum::core::now_ns();
 
     for (size_t i = 0; i < total; ++i) {
@@ -71,14 +73,14 @@ int main() {
         std::strncpy(tick.source, "SIM", sizeof(tick.source) - 1);
         tick.side = SIDE_BUY;
 
-#ifdef ARGENTUM_USE_FLATBUFFERS
-        if (argentum::codec::encode_market_tick_flatbuffers(tick, &payload, false) == ARGENTUM_OK) {
+        size_t payload_size = 0;
+        if (argentum::codec::encode_market_tick_into(tick, payload, &payload_size) == ARGENTUM_OK) {
             uint64_t send_ns = argentum::core::now_ns();
             {
                 std::lock_guard<std::mutex> lock(times_mtx);
                 send_times.push_back(send_ns);
             }
-            if (bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK) {
+            if (bus->publish("market.ticks", payload.data(), payload_size) == ARGENTUM_OK) {
                 published.fetch_add(1, std::memory_order_relaxed);
             } else {
                 dropped.fetch_add(1, std::memory_order_relaxed);
@@ -86,22 +88,6 @@ int main() {
                 if (!send_times.empty()) send_times.pop_back();
             }
         }
-#else
-        if (argentum::codec::encode_market_tick_legacy(tick, &payload) == ARGENTUM_OK) {
-            uint64_t send_ns = argentum::core::now_ns();
-            {
-                std::lock_guard<std::mutex> lock(times_mtx);
-                send_times.push_back(send_ns);
-            }
-            if (bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK) {
-                published.fetch_add(1, std::memory_order_relaxed);
-            } else {
-                dropped.fetch_add(1, std::memory_order_relaxed);
-                std::lock_guard<std::mutex> lock(times_mtx);
-                if (!send_times.empty()) send_times.pop_back();
-            }
-        }
-#endif
     }
 
     auto publish_end_ns = argentum::core::now_ns();
@@ -147,6 +133,12 @@ int main() {
     std::cout << "[Benchmark] Published: " << published.load() << "\n";
     std::cout << "[Benchmark] Dropped (publish): " << dropped.load() << "\n";
     std::cout << "[Benchmark] Bus drops: " << metrics.drops << "\n";
+    std::cout << "[Benchmark] Consumer spins/yields/parks: " << metrics.wait_spins << "/"
+              << metrics.wait_yields << "/" << metrics.wait_parks << "\n";
+    std::cout << "[Benchmark] Bus dwell p50/p99/p99.9/max: " << metrics.dwell.p50_ns << "/"
+              << metrics.dwell.p99_ns << "/" << metrics.dwell.p999_ns << "/" << metrics.dwell.max_ns << " ns\n";
+    std::cout << "[Benchmark] Callback p50/p99/p99.9/max: " << metrics.callback.p50_ns << "/"
+              << metrics.callback.p99_ns << "/" << metrics.callback.p999_ns << "/" << metrics.callback.max_ns << " ns\n";
     std::cout << "[Benchmark] Latency p50: " << p50_us << " us\n";
     std::cout << "[Benchmark] Latency p95: " << p95_us << " us\n";
     std::cout << "[Benchmark] Latency p99: " << p99_us << " us\n";
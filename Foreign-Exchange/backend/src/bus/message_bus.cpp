@@ -1,5 +1,6 @@
 #include "bus/message_bus.hpp"
 
+#include "subscriber_dispatch.hpp"
 #include "core/time_utils.hpp"
 
 #include <unordered_map>
@@ -38,12 +39,158 @@ public:
         uint64_t start_ns = argentum::core::now_ns();
         TopicState* state = get_or_create_topic(topic);
         if (!state) return ARGENTUM_ERR_NOMEM;
+        return enqueue(state, data, size, nullptr, start_ns);
+    }
+
+    ArgentumStatus publish_typed(const std::string& topic, const TypedCodecOps& ops, const void* value) override {
+        if (!value || ops.value_size == 0 || ops.value_size > kMaxTypedValueBytes) return ARGENTUM_ERR_INVALID;
+
+        uint64_t start_ns = argentum::core::now_ns();
+        TopicState* state = get_or_create_topic(topic);
+        if (!state) return ARGENTUM_ERR_NOMEM;
+        if (state->conflation_key) {
+            // Conflation keys are computed on wire bytes.
+            return MessageBus::publish_typed(topic, ops, value);
+        }
+        // Same address space: queue the struct itself; bytes are produced only for raw subscribers.
+        return enqueue(state, value, ops.value_size, &ops, start_ns);
+    }
+
+    SubscriptionId subscribe(const std::string& topic, MessageCallback callback) override {
+        if (!callback) return kInvalidSubscription;
+        detail::Subscriber sub;
+        sub.raw = std::move(callback);
+        return add_subscriber(topic, std::move(sub));
+    }
+
+    SubscriptionId subscribe_typed(const std::string& topic,
+                                   const TypedCodecOps& ops,
+                                   TypedCallback callback,
+                                   DecodeErrorCallback on_error) override {
+        if (!callback) return kInvalidSubscription;
+        return add_subscriber(topic, detail::make_typed_subscriber(kInvalidSubscription, ops, std::move(callback), std::move(on_error)));
+    }
+
+    bool unsubscribe(const std::string& topic, SubscriptionId id) override {
+        TopicState* state = find_topic(topic);
+        if (!state) return false;
+        uint64_t version = 0;
+        {
+            std::unique_lock lock(state->mutex);
+            const SubscriberList& current = *state->subscribers;
+            auto next = std::make_shared<SubscriberList>();
+            next->reserve(current.size());
+            for (const Subscriber& sub : current) {
+                if (sub.id != id) next->push_back(sub);
+            }
+            if (next->size() == current.size()) return false;
+            version = publish_subscribers(state, std::move(next));
+        }
+        wait_for_dispatchers(state, version);
+        return true;
+    }
+
+    bool get_metrics(const std::string& topic, TopicMetrics* out) const override {
+        if (!out) return false;
+        std::shared_lock lock(mutex_);
+        auto it = topics_.find(topic);
+        if (it == topics_.end()) return false;
+        const TopicMetricsInternal& metrics = it->second->metrics;
+        uint64_t published = metrics.published.load(std::memory_order_relaxed);
+        uint64_t total_latency = metrics.publish_latency_ns_total.load(std::memory_order_relaxed);
+        out->queue_depth = metrics.queue_depth.load(std::memory_order_relaxed);
+        out->drops = metrics.drops.load(std::memory_order_relaxed);
+        out->backpressure_hits = metrics.backpressure_hits.load(std::memory_order_relaxed);
+        out->published = published;
+        out->conflated = metrics.conflated.load(std::memory_order_relaxed);
+        out->publish_latency_ns_avg = (published == 0) ? 0 : (total_latency / published);
+        out->publish_latency_ns_max = metrics.publish_latency_ns_max.load(std::memory_order_relaxed);
+        out->wait_spins = metrics.wait_spins.load(std::memory_order_relaxed);
+        out->wait_yields = metrics.wait_yields.load(std::memory_order_relaxed);
+        out->wait_parks = metrics.wait_parks.load(std::memory_order_relaxed);
+        out->publish_latency = metrics.publish_hist.percentiles();
+        out->dwell = metrics.dwell_hist.percentiles();
+        out->callback = metrics.callback_hist.percentiles();
+        return true;
+    }
+
+private:
+    using Subscriber = detail::Subscriber;
+    using SubscriberList = detail::SubscriberList;
+
+    struct ConflationKeyHash {
+        size_t operator()(const ConflationKey& key) const {
+            return static_cast<size_t>((key.lo ^ (key.hi * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL);
+        }
+    };
+
+    struct Message {
+        std::vector<uint8_t> data;
+        uint64_t enqueue_ns = 0;
+        ConflationKey key{};
+        bool keyed = false;
+        const TypedCodecOps* value_ops = nullptr; // set when `data` holds a typed value, not wire bytes
+    };
+
+    struct TopicMetricsInternal {
+        std::atomic<uint64_t> queue_depth{0};
+        std::atomic<uint64_t> drops{0};
+        std::atomic<uint64_t> backpressure_hits{0};
+        std::atomic<uint64_t> published{0};
+        std::atomic<uint64_t> conflated{0};
+        std::atomic<uint64_t> publish_latency_ns_total{0};
+        std::atomic<uint64_t> publish_latency_ns_max{0};
+        std::atomic<uint64_t> wait_spins{0};
+        std::atomic<uint64_t> wait_yields{0};
+        std::atomic<uint64_t> wait_parks{0};
+        argentum::core::LatencyHistogram publish_hist;
+        argentum::core::LatencyHistogram dwell_hist;
+        argentum::core::LatencyHistogram callback_hist;
+    };
+
+    struct TopicState {
+        std::mutex mutex;
+        std::condition_variable cv_data;
+        std::condition_variable cv_space;
+        std::deque<Message> queue;
+        ConflationKeyFn conflation_key;                      // empty = not conflated
+        std::unordered_map<ConflationKey, Message*, ConflationKeyHash> pending_by_key; // queued keyed messages (guarded by mutex)
+        std::shared_ptr<const SubscriberList> subscribers = std::make_shared<const SubscriberList>(); // guarded by mutex; replaced, never mutated
+        std::atomic<uint64_t> subscribers_version{0};
+        std::unique_ptr<std::atomic<uint64_t>[]> dispatching; // per worker: snapshot version being dispatched, 0 = idle
+        std::vector<std::thread> workers;
+        TopicMetricsInternal metrics;
+        ConsumerWaitConfig wait{};
+        uint32_t parked_consumers = 0; // guarded by mutex
+        uint32_t space_waiters = 0;    // guarded by mutex
+        std::atomic<bool> running{false}; // written under mutex, polled lock-free by spinning consumers
+        bool consumers_started = false;
+    };
+
+    ArgentumStatus enqueue(TopicState* state, const void* data, size_t size, const TypedCodecOps* value_ops, uint64_t start_ns) {
+        ConflationKey key{};
+        const bool keyed = !value_ops && state->conflation_key && state->conflation_key(data, size, &key);
 
         std::unique_lock lock(state->mutex);
         if (!state->running) {
             return ARGENTUM_ERR_INVALID;
         }
 
+        if (keyed) {
+            auto pending = state->pending_by_key.find(key);
+            if (pending != state->pending_by_key.end()) {
+                // Last-value semantics: overwrite the queued message, keeping its queue position.
+                Message* queued = pending->second;
+                queued->data.assign(static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+                queued->enqueue_ns = argentum::core::now_ns();
+                queued->value_ops = nullptr;
+                state->metrics.conflated.fetch_add(1, std::memory_order_relaxed);
+                state->metrics.published.fetch_add(1, std::memory_order_relaxed);
+                update_publish_latency(state, start_ns);
+                return ARGENTUM_OK;
+            }
+        }
+
         if (state->queue.size() >= config_.queue_capacity) {
             state->metrics.backpressure_hits.fetch_add(1, std::memory_order_relaxed);
             switch (config_.policy) {
@@ -54,6 +201,7 @@ public:
                 }
                 case BackpressurePolicy::DropOldest: {
                     if (!state->queue.empty()) {
+                        forget_key(state, state->queue.front());
                         state->queue.pop_front();
                         state->metrics.drops.fetch_add(1, std::memory_order_relaxed);
                         state->metrics.queue_depth.fetch_sub(1, std::memory_order_relaxed);
@@ -66,6 +214,7 @@ public:
                         update_publish_latency(state, start_ns);
                         return ARGENTUM_ERR_TIMEOUT;
                     }
+                    ++state->space_waiters;
                     if (config_.block_timeout_ms == 0) {
                         state->cv_space.wait(lock, [&] {
                             return !state->running || state->queue.size() < config_.queue_capacity;
@@ -75,6 +224,7 @@ public:
                             std::chrono::milliseconds(config_.block_timeout_ms),
                             [&] { return !state->running || state->queue.size() < config_.queue_capacity; });
                     }
+                    --state->space_waiters;
                     if (!state->running || state->queue.size() >= config_.queue_capacity) {
                         update_publish_latency(state, start_ns);
                         return ARGENTUM_ERR_TIMEOUT;
@@ -85,69 +235,48 @@ public:
         }
 
         Message msg;
+        msg.enqueue_ns = argentum::core::now_ns();
+        msg.key = key;
+        msg.keyed = keyed;
+        msg.value_ops = value_ops;
         msg.data.resize(size);
         std::memcpy(msg.data.data(), data, size);
         state->queue.push_back(std::move(msg));
+        if (keyed) {
+            // std::deque keeps element addresses stable across push_back/pop_front.
+            state->pending_by_key[key] = &state->queue.back();
+        }
         state->metrics.queue_depth.fetch_add(1, std::memory_order_relaxed);
         state->metrics.published.fetch_add(1, std::memory_order_relaxed);
-        state->cv_data.notify_one();
+        if (state->parked_consumers > 0) {
+            // Spinning consumers observe queue_depth directly; only parked ones need a wake-up.
+            state->cv_data.notify_one();
+        }
         update_publish_latency(state, start_ns);
         return ARGENTUM_OK;
     }
 
-    void subscribe(const std::string& topic, std::function<void(const void* data, size_t size)> callback) override {
+    SubscriptionId add_subscriber(const std::string& topic, Subscriber sub) {
         TopicState* state = get_or_create_topic(topic);
-        if (!state) return;
+        if (!state) return kInvalidSubscription;
+        sub.id = next_subscription_id_.fetch_add(1, std::memory_order_relaxed);
+        const SubscriptionId id = sub.id;
         std::unique_lock lock(state->mutex);
-        state->subscribers.push_back(std::move(callback));
+        auto next = std::make_shared<SubscriberList>(*state->subscribers);
+        next->push_back(std::move(sub));
+        publish_subscribers(state, std::move(next));
         if (state->running && !state->consumers_started) {
             start_consumers(state);
         }
+        return id;
     }
 
-    bool get_metrics(const std::string& topic, TopicMetrics* out) const override {
-        if (!out) return false;
+    TopicState* find_topic(const std::string& topic) const {
         std::shared_lock lock(mutex_);
         auto it = topics_.find(topic);
-        if (it == topics_.end()) return false;
-        const TopicMetricsInternal& metrics = it->second->metrics;
-        uint64_t published = metrics.published.load(std::memory_order_relaxed);
-        uint64_t total_latency = metrics.publish_latency_ns_total.load(std::memory_order_relaxed);
-        out->queue_depth = metrics.queue_depth.load(std::memory_order_relaxed);
-        out->drops = metrics.drops.load(std::memory_order_relaxed);
-        out->backpressure_hits = metrics.backpressure_hits.load(std::memory_order_relaxed);
-        out->published = published;
-        out->publish_latency_ns_avg = (published == 0) ? 0 : (total_latency / published);
-        out->publish_latency_ns_max = metrics.publish_latency_ns_max.load(std::memory_order_relaxed);
-        return true;
+        return (it == topics_.end()) ? nullptr : it->second.get();
     }
 
-private:
-    struct Message {
-        std::vector<uint8_t> data;
-    };
-
-    struct TopicMetricsInternal {
-        std::atomic<uint64_t> queue_depth{0};
-        std::atomic<uint64_t> drops{0};
-        std::atomic<uint64_t> backpressure_hits{0};
-        std::atomic<uint64_t> published{0};
-        std::atomic<uint64_t> publish_latency_ns_total{0};
-        std::atomic<uint64_t> publish_latency_ns_max{0};
-    };
-
-    struct TopicState {
-        std::mutex mutex;
-        std::condition_variable cv_data;
-        std::condition_variable cv_space;
-        std::deque<Message> queue;
-        std::vector<std::function<void(const void*, size_t)>> subscribers;
-        std::vector<std::thread> workers;
-        TopicMetricsInternal metrics;
-        bool running = false;
-        bool consumers_started = false;
-    };
-
     TopicState* get_or_create_topic(const std::string& topic) {
         {
             std::shared_lock lock(mutex_);
@@ -163,6 +292,12 @@ private:
         }
         auto state = std::make_unique<TopicState>();
         state->running = true;
+        auto wait_it = config_.topic_wait.find(topic);
+        state->wait = (wait_it != config_.topic_wait.end()) ? wait_it->second : config_.wait;
+        auto conflation_it = config_.topic_conflation.find(topic);
+        if (conflation_it != config_.topic_conflation.end()) {
+            state->conflation_key = conflation_it->second;
+        }
         TopicState* ptr = state.get();
         topics_[topic] = std::move(state);
         return ptr;
@@ -171,44 +306,140 @@ private:
     void start_consumers(TopicState* state) {
         if (!state) return;
         if (config_.consumer_threads == 0) return;
-        if (state->subscribers.empty()) return;
+        if (state->subscribers->empty()) return;
         if (!state->consumers_started) {
             uint32_t threads = config_.consumer_threads;
+            state->dispatching = std::make_unique<std::atomic<uint64_t>[]>(threads);
             for (uint32_t i = 0; i < threads; ++i) {
-                state->workers.emplace_back([this, state] { consumer_loop(state); });
+                state->dispatching[i].store(0, std::memory_order_relaxed);
+                state->workers.emplace_back([this, state, i] { consumer_loop(state, i); });
             }
             state->consumers_started = true;
         }
     }
 
-    void consumer_loop(TopicState* state) {
+    void consumer_loop(TopicState* state, uint32_t worker_index) {
+        std::atomic<uint64_t>& dispatching = state->dispatching[worker_index];
+        std::shared_ptr<const SubscriberList> snapshot;
+        uint64_t seen_version = 0;
+        detail::MessageDispatch dispatch;
+        const ConsumerWaitConfig wait = state->wait;
+        const bool may_park = wait_strategy_parks(wait.strategy);
         for (;;) {
+            if (wait.strategy != WaitStrategy::Block) {
+                spin_for_data(state, wait);
+            }
+
             Message msg;
-            std::vector<std::function<void(const void*, size_t)>> callbacks;
             {
                 std::unique_lock lock(state->mutex);
-                state->cv_data.wait(lock, [&] {
-                    return !state->running || !state->queue.empty();
-                });
+                if (state->queue.empty() && state->running) {
+                    if (!may_park) {
+                        continue; // another consumer won the race; resume spinning
+                    }
+                    ++state->parked_consumers;
+                    state->metrics.wait_parks.fetch_add(1, std::memory_order_relaxed);
+                    state->cv_data.wait(lock, [&] {
+                        return !state->running || !state->queue.empty();
+                    });
+                    --state->parked_consumers;
+                }
                 if (!state->running && state->queue.empty()) {
                     break;
                 }
+                forget_key(state, state->queue.front());
                 msg = std::move(state->queue.front());
                 state->queue.pop_front();
+                state->metrics.dwell_hist.record(argentum::core::now_ns() - msg.enqueue_ns);
                 state->metrics.queue_depth.fetch_sub(1, std::memory_order_relaxed);
-                state->cv_space.notify_one();
-                callbacks = state->subscribers;
+                if (state->space_waiters > 0) {
+                    state->cv_space.notify_one();
+                }
+                // Refresh the cached snapshot only when subscribe/unsubscribe published a new one.
+                const uint64_t version = state->subscribers_version.load(std::memory_order_relaxed);
+                if (version != seen_version) {
+                    snapshot = state->subscribers;
+                    seen_version = version;
+                }
+                dispatching.store(seen_version, std::memory_order_relaxed);
+            }
+
+            dispatch.reset(msg.data.data(), msg.data.size(), msg.value_ops);
+            for (const Subscriber& sub : *snapshot) {
+                const uint64_t cb_start_ns = argentum::core::now_ns();
+                dispatch.deliver(sub);
+                state->metrics.callback_hist.record(argentum::core::now_ns() - cb_start_ns);
+            }
+            dispatching.store(0, std::memory_order_release);
+        }
+    }
+
+    // Caller holds state->mutex; `msg` is about to leave the queue.
+    static void forget_key(TopicState* state, const Message& msg) {
+        if (!msg.keyed) return;
+        auto it = state->pending_by_key.find(msg.key);
+        if (it != state->pending_by_key.end() && it->second == &msg) {
+            state->pending_by_key.erase(it);
+        }
+    }
+
+    // Caller holds state->mutex. Returns the version of the newly published snapshot.
+    uint64_t publish_subscribers(TopicState* state, std::shared_ptr<const SubscriberList> next) {
+        state->subscribers = std::move(next);
+        return state->subscribers_version.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    // Grace period: wait until no worker is still dispatching a snapshot older than `version`.
+    // Workers record their snapshot version under the topic mutex, so any worker that starts
+    // dispatching after publish_subscribers() already sees the new list. A callback that
+    // unsubscribes from its own consumer thread does not wait on itself.
+    void wait_for_dispatchers(TopicState* state, uint64_t version) {
+        std::vector<std::thread::id> worker_ids;
+        {
+            std::unique_lock lock(state->mutex);
+            if (!state->dispatching) return;
+            for (const auto& worker : state->workers) {
+                worker_ids.push_back(worker.get_id());
+            }
+        }
+        const std::thread::id self = std::this_thread::get_id();
+        for (size_t i = 0; i < worker_ids.size(); ++i) {
+            if (worker_ids[i] == self) continue;
+            for (;;) {
+                const uint64_t active = state->dispatching[i].load(std::memory_order_acquire);
+                if (active == 0 || active >= version) break;
+                std::this_thread::yield();
             }
+        }
+    }
 
-            for (auto& cb : callbacks) {
-                cb(msg.data.data(), msg.data.size());
+    // Polls queue_depth without taking the topic mutex. Returns when data is likely available,
+    // the topic stops, or (SpinPark) the spin budget is exhausted.
+    void spin_for_data(TopicState* state, const ConsumerWaitConfig& wait) {
+        uint64_t spins = 0;
+        uint64_t yields = 0;
+        for (;;) {
+            if (state->metrics.queue_depth.load(std::memory_order_acquire) > 0 ||
+                !state->running.load(std::memory_order_acquire)) {
+                break;
             }
+            if (wait.strategy != WaitStrategy::BusySpin && spins >= wait.spin_budget) {
+                if (wait.strategy == WaitStrategy::SpinPark) break;
+                std::this_thread::yield();
+                ++yields;
+                continue;
+            }
+            cpu_relax();
+            ++spins;
         }
+        if (spins > 0) state->metrics.wait_spins.fetch_add(spins, std::memory_order_relaxed);
+        if (yields > 0) state->metrics.wait_yields.fetch_add(yields, std::memory_order_relaxed);
     }
 
     void update_publish_latency(TopicState* state, uint64_t start_ns) {
         if (!state) return;
         uint64_t elapsed = argentum::core::now_ns() - start_ns;
+        state->metrics.publish_hist.record(elapsed);
         state->metrics.publish_latency_ns_total.fetch_add(elapsed, std::memory_order_relaxed);
         uint64_t prev = state->metrics.publish_latency_ns_max.load(std::memory_order_relaxed);
         while (elapsed > prev &&
@@ -238,9 +469,37 @@ private:
     bool is_publisher_ = false;
     InprocBusConfig config_;
     std::unordered_map<std::string, std::unique_ptr<TopicState>> topics_;
+    std::atomic<SubscriptionId> next_subscription_id_{1};
     mutable std::shared_mutex mutex_;
 };
 
+ArgentumStatus MessageBus::publish_typed(const std::string& topic, const TypedCodecOps& ops, const void* value) {
+    if (!value) return ARGENTUM_ERR_INVALID;
+    // Reused per thread so steady-state publishes do not allocate; publish() copies the bytes.
+    thread_local std::vector<uint8_t> bytes;
+    const ArgentumStatus status = ops.encode(value, &bytes);
+    if (status != ARGENTUM_OK) return status;
+    return publish(topic, bytes.data(), bytes.size());
+}
+
+SubscriptionId MessageBus::subscribe_typed(const std::string& topic,
+                                           const TypedCodecOps& ops,
+                                           TypedCallback callback,
+                                           DecodeErrorCallback on_error) {
+    if (!callback) return kInvalidSubscription;
+    // Fallback for transports without native typed dispatch: decode per subscriber.
+    const TypedCodecOps* codec = &ops;
+    return subscribe(topic, [codec, callback = std::move(callback), on_error = std::move(on_error)](const void* data, size_t size) {
+        alignas(kMaxTypedValueAlign) unsigned char value[kMaxTypedValueBytes];
+        const ArgentumStatus status = codec->decode(data, size, value);
+        if (status == ARGENTUM_OK) {
+            callback(value);
+        } else if (on_error) {
+            on_error(status);
+        }
+    });
+}
+
 std::shared_ptr<MessageBus> create_inproc_bus(const InprocBusConfig& config) {
     return std::make_shared<InprocMessageBus>(config);
 }
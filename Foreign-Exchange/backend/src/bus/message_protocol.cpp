@@ -1,60 +1,73 @@
 #include "bus/message_protocol.hpp"
 
 #include <cstring>
-#include <mutex>
 
 namespace argentum::bus {
 
-static uint32_t crc32_table[256];
-static std::once_flag crc32_once;
+uint32_t compute_crc32(const uint8_t* data, size_t size) {
+    return core::crc32(data, size);
+}
 
-static void init_crc32_table() {
-    for (uint32_t i = 0; i < 256; ++i) {
-        uint32_t c = i;
-        for (uint32_t j = 0; j < 8; ++j) {
-            c = (c & 1) ? (0xEDB88320U ^ (c >> 1)) : (c >> 1);
-        }
-        crc32_table[i] = c;
-    }
+uint32_t compute_payload_checksum(uint32_t flags, const uint8_t* data, size_t size) {
+    return core::compute_checksum(checksum_kind_from_flags(flags), data, size);
 }
 
-uint32_t compute_crc32(const uint8_t* data, size_t size) {
-    if (!data || size == 0) return 0;
-    std::call_once(crc32_once, init_crc32_table);
-    uint32_t c = 0xFFFFFFFFU;
-    for (size_t i = 0; i < size; ++i) {
-        c = crc32_table[(c ^ data[i]) & 0xFFU] ^ (c >> 8);
-    }
-    return c ^ 0xFFFFFFFFU;
+void write_header_v2(MessageType type, const void* payload, size_t size, uint64_t timestamp_ns, uint32_t flags,
+                     std::span<uint8_t, sizeof(MessageHeaderV2)> out) {
+    MessageHeaderV2 header{};
+    header.version = kMessageProtocolVersionV2;
+    header.type = static_cast<uint16_t>(type);
+    header.size = static_cast<uint32_t>(size);
+    header.timestamp_ns = timestamp_ns;
+    header.flags = flags;
+    header.crc32 = (flags & static_cast<uint32_t>(MessageFlags::HasCrc32)) ? compute_payload_checksum(flags, static_cast<const uint8_t*>(payload), size) : 0;
+    std::memcpy(out.data(), &header, sizeof(header));
 }
 
-std::vector<uint8_t> encode_message(MessageType type, const void* data, size_t size, uint64_t timestamp_ns) {
-    std::vector<uint8_t> buffer(sizeof(MessageHeaderV1) + size);
+ArgentumStatus encode_message_into(MessageType type, const void* data, size_t size, uint64_t timestamp_ns,
+                                   std::span<uint8_t> out, size_t* out_written) {
+    if (!out_written) return ARGENTUM_ERR_INVALID;
+    const size_t total = sizeof(MessageHeaderV1) + size;
+    *out_written = total;
+    if (out.size() < total) return ARGENTUM_ERR_RANGE;
+
     MessageHeaderV1 header{};
     header.version = kMessageProtocolVersionV1;
     header.type = static_cast<uint16_t>(type);
     header.size = static_cast<uint32_t>(size);
     header.timestamp_ns = timestamp_ns;
-    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::memcpy(out.data(), &header, sizeof(header));
     if (size > 0 && data) {
-        std::memcpy(buffer.data() + sizeof(header), data, size);
+        std::memcpy(out.data() + sizeof(header), data, size);
     }
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus encode_message_v2_into(MessageType type, const void* data, size_t size, uint64_t timestamp_ns,
+                                      uint32_t flags, std::span<uint8_t> out, size_t* out_written) {
+    if (!out_written) return ARGENTUM_ERR_INVALID;
+    const size_t total = sizeof(MessageHeaderV2) + size;
+    *out_written = total;
+    if (out.size() < total) return ARGENTUM_ERR_RANGE;
+
+    write_header_v2(type, data, size, timestamp_ns, flags, out.first<sizeof(MessageHeaderV2)>());
+    if (size > 0 && data) {
+        std::memcpy(out.data() + sizeof(MessageHeaderV2), data, size);
+    }
+    return ARGENTUM_OK;
+}
+
+std::vector<uint8_t> encode_message(MessageType type, const void* data, size_t size, uint64_t timestamp_ns) {
+    std::vector<uint8_t> buffer(sizeof(MessageHeaderV1) + size);
+    size_t written = 0;
+    (void)encode_message_into(type, data, size, timestamp_ns, buffer, &written);
     return buffer;
 }
 
 std::vector<uint8_t> encode_message_v2(MessageType type, const void* data, size_t size, uint64_t timestamp_ns, uint32_t flags) {
     std::vector<uint8_t> buffer(sizeof(MessageHeaderV2) + size);
-    MessageHeaderV2 header{};
-    header.version = kMessageProtocolVersionV2;
-    header.type = static_cast<uint16_t>(type);
-    header.size = static_cast<uint32_t>(size);
-    header.timestamp_ns = timestamp_ns;
-    header.flags = flags;
-    header.crc32 = (flags & static_cast<uint32_t>(MessageFlags::HasCrc32)) ? compute_crc32(static_cast<const uint8_t*>(data), size) : 0;
-    std::memcpy(buffer.data(), &header, sizeof(header));
-    if (size > 0 && data) {
-        std::memcpy(buffer.data() + sizeof(header), data, size);
-    }
+    size_t written = 0;
+    (void)encode_message_v2_into(type, data, size, timestamp_ns, flags, buffer, &written);
     return buffer;
 }
 
@@ -78,7 +91,7 @@ ArgentumStatus decode_header(const void* data, size_t size, DecodedHeader* out_h
             0
         };
         out_header->header_size = sizeof(MessageHeaderV1);
-    } else if (version == kMessageProtocolVersionV2) {
+    } else if (version == kMessageProtocolVersionV2 || version == kMessageProtocolVersionV3) {
         if (size < sizeof(MessageHeaderV2)) return ARGENTUM_ERR_PROTO;
         MessageHeaderV2 header{};
         std::memcpy(&header, data, sizeof(header));
@@ -98,8 +111,11 @@ ArgentumStatus decode_header(const void* data, size_t size, DecodedHeader* out_h
     if (out_header->header.size > size - out_header->header_size) return ARGENTUM_ERR_PROTO;
 
     if (out_header->header.flags & static_cast<uint32_t>(MessageFlags::HasCrc32)) {
+        if (static_cast<uint8_t>(checksum_kind_from_flags(out_header->header.flags)) >= core::kChecksumKindCount) {
+            return ARGENTUM_ERR_PROTO;
+        }
         const uint8_t* payload = static_cast<const uint8_t*>(data) + out_header->header_size;
-        uint32_t crc = compute_crc32(payload, out_header->header.size);
+        uint32_t crc = compute_payload_checksum(out_header->header.flags, payload, out_header->header.size);
         if (crc != out_header->header.crc32) return ARGENTUM_ERR_PROTO;
     }
 
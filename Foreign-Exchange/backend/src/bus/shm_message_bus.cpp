@@ -0,0 +1,799 @@
+#include "bus/message_bus.hpp"
+
+#include "subscriber_dispatch.hpp"
+#include "core/time_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ARGENTUM_SHM_BUS_POSIX 1
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+namespace argentum::bus {
+
+#ifdef ARGENTUM_SHM_BUS_POSIX
+
+namespace {
+
+constexpr uint32_t kShmMagic = 0x41524742U; // "ARGB"
+constexpr uint32_t kShmLayoutVersion = 2;
+constexpr size_t kCacheLine = 64;
+constexpr size_t kTopicNameLen = 64;
+constexpr uint32_t kTopicFree = 0;
+constexpr uint32_t kTopicReady = 2;
+constexpr uint32_t kConsumerFree = 0;
+constexpr uint32_t kConsumerActive = 1;   // cursor is valid; publishers respect it
+constexpr uint32_t kConsumerClaimed = 2;  // slot taken, cursor not yet stored
+constexpr uint64_t kSlotBusy = ~0ULL;
+constexpr uint32_t kParkTimeoutMs = 50;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shm cursors require lock-free 64-bit atomics.");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "shm futex words require lock-free 32-bit atomics.");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer.");
+
+// Region layout (all offsets derived from the header written by the creator):
+//   [ShmRegionHeader][topic 0][topic 1]...[topic max_topics-1]
+// Each topic block:
+//   [ShmTopicHeader][ShmConsumerCursor x max_consumers][slot x slot_count]
+struct alignas(kCacheLine) ShmRegionHeader {
+    std::atomic<uint32_t> magic;
+    uint32_t layout_version;
+    uint32_t max_topics;
+    uint32_t slot_count;
+    uint32_t slot_payload_bytes;
+    uint32_t max_consumers;
+    uint32_t policy;
+    std::atomic<uint32_t> topic_lock;
+    uint64_t region_bytes;
+};
+
+struct alignas(kCacheLine) ShmTopicHeader {
+    std::atomic<uint32_t> state;
+    char name[kTopicNameLen];
+
+    alignas(kCacheLine) std::atomic<uint64_t> head; // next sequence to claim
+
+    alignas(kCacheLine) std::atomic<uint32_t> data_word; // futex: bumped on publish
+    std::atomic<uint32_t> data_waiters;
+
+    alignas(kCacheLine) std::atomic<uint32_t> space_word; // futex: bumped on consume
+    std::atomic<uint32_t> space_waiters;
+
+    alignas(kCacheLine) std::atomic<uint64_t> published;
+    std::atomic<uint64_t> drops;
+    std::atomic<uint64_t> backpressure_hits;
+    std::atomic<uint64_t> publish_latency_ns_total;
+    std::atomic<uint64_t> publish_latency_ns_max;
+
+    argentum::core::LatencyHistogram publish_hist;
+    argentum::core::LatencyHistogram dwell_hist;    // slot publish_ns -> consumer pickup (all processes)
+    argentum::core::LatencyHistogram callback_hist; // subscriber callbacks (all processes)
+};
+
+struct alignas(kCacheLine) ShmConsumerCursor {
+    std::atomic<uint32_t> active;
+    std::atomic<uint64_t> cursor; // next sequence this consumer will read
+};
+
+// seq == s + 1 once the slot holds sequence s; kSlotBusy while a publisher writes it.
+struct ShmSlotHeader {
+    std::atomic<uint64_t> seq;
+    uint64_t publish_ns;
+    uint32_t size;
+    uint32_t reserved;
+};
+
+struct ShmLayout {
+    uint32_t max_topics = 0;
+    uint32_t slot_count = 0;
+    uint32_t slot_payload_bytes = 0;
+    uint32_t max_consumers = 0;
+    size_t slot_stride = 0;
+    size_t topic_header_bytes = 0;
+    size_t topic_stride = 0;
+    size_t region_bytes = 0;
+};
+
+size_t round_up(size_t value, size_t align) {
+    return (value + align - 1) / align * align;
+}
+
+uint32_t next_pow2(uint32_t value) {
+    uint32_t out = 1;
+    while (out < value && out < (1U << 30)) out <<= 1;
+    return out;
+}
+
+ShmLayout make_layout(uint32_t max_topics, uint32_t slot_count, uint32_t slot_payload_bytes, uint32_t max_consumers) {
+    ShmLayout layout;
+    layout.max_topics = (max_topics == 0) ? 1 : max_topics;
+    layout.slot_count = next_pow2((slot_count < 2) ? 2 : slot_count);
+    layout.slot_payload_bytes = (slot_payload_bytes == 0) ? 1 : slot_payload_bytes;
+    layout.max_consumers = (max_consumers == 0) ? 1 : max_consumers;
+    layout.slot_stride = round_up(sizeof(ShmSlotHeader) + layout.slot_payload_bytes, kCacheLine);
+    layout.topic_header_bytes = round_up(
+        sizeof(ShmTopicHeader) + layout.max_consumers * sizeof(ShmConsumerCursor), kCacheLine);
+    layout.topic_stride = layout.topic_header_bytes + layout.slot_count * layout.slot_stride;
+    layout.region_bytes = round_up(sizeof(ShmRegionHeader), kCacheLine) + layout.max_topics * layout.topic_stride;
+    return layout;
+}
+
+void futex_wait(std::atomic<uint32_t>* word, uint32_t expected, uint32_t timeout_ms) {
+#if defined(__linux__)
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(timeout_ms / 1000U);
+    ts.tv_nsec = static_cast<long>(timeout_ms % 1000U) * 1'000'000L;
+    // Shared (non-private) futex: waiters and wakers live in different processes.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, &ts, nullptr, 0);
+#else
+    if (word->load(std::memory_order_acquire) == expected) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    (void)timeout_ms;
+#endif
+}
+
+void futex_wake_all(std::atomic<uint32_t>* word) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+std::string region_name_from_endpoint(const std::string& endpoint) {
+    static const char* kPrefixes[] = {"shm://", "ipc://"};
+    for (const char* prefix : kPrefixes) {
+        const size_t len = std::strlen(prefix);
+        if (endpoint.compare(0, len, prefix) == 0) {
+            return endpoint.substr(len);
+        }
+    }
+    return endpoint;
+}
+
+} // namespace
+
+class ShmMessageBus final : public MessageBus {
+public:
+    explicit ShmMessageBus(ShmBusConfig config)
+        : config_(std::move(config)) {}
+
+    ~ShmMessageBus() override {
+        shutdown();
+        unmap_region();
+    }
+
+    bool map_region(const std::string& raw_name) {
+        if (raw_name.empty() || base_) return base_ != nullptr;
+        const std::string name = (raw_name[0] == '/') ? raw_name : ("/" + raw_name);
+
+        if (config_.reset_existing) {
+            shm_unlink(name.c_str());
+        }
+
+        const ShmLayout desired = make_layout(config_.max_topics,
+                                              config_.slots_per_topic,
+                                              config_.slot_payload_bytes,
+                                              config_.max_consumers_per_topic);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        const bool creator = (fd >= 0);
+        if (!creator) {
+            if (errno != EEXIST) return false;
+            fd = shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd < 0) return false;
+        } else if (ftruncate(fd, static_cast<off_t>(desired.region_bytes)) != 0) {
+            close(fd);
+            shm_unlink(name.c_str());
+            return false;
+        }
+
+        size_t bytes = creator ? desired.region_bytes : 0;
+        for (int attempt = 0; !creator && attempt < 1000; ++attempt) {
+            struct stat st{};
+            if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) >= sizeof(ShmRegionHeader)) {
+                bytes = static_cast<size_t>(st.st_size);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (bytes == 0) {
+            close(fd);
+            return false;
+        }
+
+        void* mem = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mem == MAP_FAILED) {
+            close(fd);
+            if (creator) shm_unlink(name.c_str());
+            return false;
+        }
+
+        auto* header = static_cast<ShmRegionHeader*>(mem);
+        if (creator) {
+            header->layout_version = kShmLayoutVersion;
+            header->max_topics = desired.max_topics;
+            header->slot_count = desired.slot_count;
+            header->slot_payload_bytes = desired.slot_payload_bytes;
+            header->max_consumers = desired.max_consumers;
+            header->policy = static_cast<uint32_t>(config_.policy);
+            header->region_bytes = desired.region_bytes;
+            header->magic.store(kShmMagic, std::memory_order_release);
+            layout_ = desired;
+        } else {
+            bool ready = false;
+            for (int attempt = 0; attempt < 1000; ++attempt) {
+                if (header->magic.load(std::memory_order_acquire) == kShmMagic) {
+                    ready = true;
+                    break;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            // The creator fixes the layout; openers adopt it instead of their own config.
+            layout_ = make_layout(header->max_topics,
+                                  header->slot_count,
+                                  header->slot_payload_bytes,
+                                  header->max_consumers);
+            if (!ready || header->layout_version != kShmLayoutVersion ||
+                layout_.region_bytes != header->region_bytes || layout_.region_bytes > bytes) {
+                munmap(mem, bytes);
+                close(fd);
+                return false;
+            }
+        }
+
+        region_policy_ = static_cast<BackpressurePolicy>(header->policy);
+        base_ = static_cast<uint8_t*>(mem);
+        mapped_bytes_ = bytes;
+        fd_ = fd;
+        shm_name_ = name;
+        return true;
+    }
+
+    bool mapped() const {
+        return base_ != nullptr;
+    }
+
+    void connect(const std::string& endpoint, bool is_publisher) override {
+        (void)is_publisher;
+        if (!base_) {
+            map_region(region_name_from_endpoint(endpoint));
+        }
+    }
+
+    ArgentumStatus publish(const std::string& topic, const void* data, size_t size) override {
+        if (!data || size == 0) return ARGENTUM_ERR_INVALID;
+        if (!base_) return ARGENTUM_ERR_INVALID;
+        if (size > layout_.slot_payload_bytes) return ARGENTUM_ERR_RANGE;
+
+        const uint64_t start_ns = argentum::core::now_ns();
+        LocalTopic* local = get_or_attach_topic(topic);
+        if (!local) return ARGENTUM_ERR_NOMEM;
+        ShmTopicHeader* shm = local->shm;
+
+        uint64_t seq = 0;
+        if (!claim_sequence(shm, &seq)) {
+            update_publish_latency(shm, start_ns);
+            return ARGENTUM_ERR_TIMEOUT;
+        }
+
+        ShmSlotHeader* slot = slot_at(shm, seq);
+        slot->seq.store(kSlotBusy, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->size = static_cast<uint32_t>(size);
+        slot->publish_ns = argentum::core::now_ns();
+        std::memcpy(slot_payload(slot), data, size);
+        slot->seq.store(seq + 1, std::memory_order_release);
+
+        shm->published.fetch_add(1, std::memory_order_relaxed);
+        shm->data_word.fetch_add(1, std::memory_order_seq_cst);
+        if (shm->data_waiters.load(std::memory_order_seq_cst) > 0) {
+            futex_wake_all(&shm->data_word);
+        }
+        update_publish_latency(shm, start_ns);
+        return ARGENTUM_OK;
+    }
+
+    SubscriptionId subscribe(const std::string& topic, MessageCallback callback) override {
+        if (!callback) return kInvalidSubscription;
+        detail::Subscriber sub;
+        sub.raw = std::move(callback);
+        return add_subscriber(topic, std::move(sub));
+    }
+
+    SubscriptionId subscribe_typed(const std::string& topic,
+                                   const TypedCodecOps& ops,
+                                   TypedCallback callback,
+                                   DecodeErrorCallback on_error) override {
+        if (!callback) return kInvalidSubscription;
+        // Payloads cross the process boundary as bytes; the consumer decodes once per type.
+        return add_subscriber(topic, detail::make_typed_subscriber(kInvalidSubscription, ops, std::move(callback), std::move(on_error)));
+    }
+
+    bool unsubscribe(const std::string& topic, SubscriptionId id) override {
+        LocalTopic* local = nullptr;
+        {
+            std::shared_lock lock(mutex_);
+            auto it = topics_.find(topic);
+            if (it == topics_.end()) return false;
+            local = it->second.get();
+        }
+        uint64_t version = 0;
+        std::thread::id worker_id;
+        {
+            std::unique_lock lock(local->mutex);
+            const SubscriberList& current = *local->subscribers;
+            auto next = std::make_shared<SubscriberList>();
+            next->reserve(current.size());
+            for (const Subscriber& sub : current) {
+                if (sub.id != id) next->push_back(sub);
+            }
+            if (next->size() == current.size()) return false;
+            local->subscribers = std::move(next);
+            version = local->subscribers_version.fetch_add(1, std::memory_order_seq_cst) + 1;
+            worker_id = local->worker.get_id();
+        }
+        // Grace period: the consumer announces the snapshot version it dispatches and re-checks
+        // the published version (seq_cst), so once this loop exits no older snapshot is in use.
+        if (worker_id != std::this_thread::get_id()) {
+            for (;;) {
+                const uint64_t active = local->dispatching.load(std::memory_order_seq_cst);
+                if (active == 0 || active >= version) break;
+                std::this_thread::yield();
+            }
+        }
+        return true;
+    }
+
+    bool get_metrics(const std::string& topic, TopicMetrics* out) const override {
+        if (!out || !base_) return false;
+        const ShmTopicHeader* shm = find_topic(topic);
+        if (!shm) return false;
+        const uint64_t head = shm->head.load(std::memory_order_acquire);
+        const uint64_t published = shm->published.load(std::memory_order_relaxed);
+        const uint64_t total_latency = shm->publish_latency_ns_total.load(std::memory_order_relaxed);
+        out->queue_depth = head - min_consumer_cursor(shm, head);
+        out->drops = shm->drops.load(std::memory_order_relaxed);
+        out->backpressure_hits = shm->backpressure_hits.load(std::memory_order_relaxed);
+        out->published = published;
+        out->publish_latency_ns_avg = (published == 0) ? 0 : (total_latency / published);
+        out->publish_latency_ns_max = shm->publish_latency_ns_max.load(std::memory_order_relaxed);
+        out->publish_latency = shm->publish_hist.percentiles();
+        out->dwell = shm->dwell_hist.percentiles();
+        out->callback = shm->callback_hist.percentiles();
+        // Wait counters describe this process's consumer thread, not the whole region.
+        std::shared_lock lock(mutex_);
+        auto it = topics_.find(topic);
+        if (it != topics_.end()) {
+            out->wait_spins = it->second->wait_spins.load(std::memory_order_relaxed);
+            out->wait_yields = it->second->wait_yields.load(std::memory_order_relaxed);
+            out->wait_parks = it->second->wait_parks.load(std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+private:
+    using Subscriber = detail::Subscriber;
+    using SubscriberList = detail::SubscriberList;
+
+    struct LocalTopic {
+        ShmTopicHeader* shm = nullptr;
+        std::mutex mutex;
+        std::shared_ptr<const SubscriberList> subscribers = std::make_shared<const SubscriberList>(); // guarded by mutex; replaced, never mutated
+        std::atomic<uint64_t> subscribers_version{0};
+        std::atomic<uint64_t> dispatching{0}; // snapshot version being dispatched, 0 = idle
+        std::thread worker;
+        std::atomic<bool> running{false};
+        ConsumerWaitConfig wait{};
+        std::atomic<uint64_t> wait_spins{0};
+        std::atomic<uint64_t> wait_yields{0};
+        std::atomic<uint64_t> wait_parks{0};
+        uint32_t consumer_index = 0;
+        bool consumer_started = false;
+    };
+
+    SubscriptionId add_subscriber(const std::string& topic, Subscriber sub) {
+        if (!base_) return kInvalidSubscription;
+        LocalTopic* local = get_or_attach_topic(topic);
+        if (!local) return kInvalidSubscription;
+        sub.id = next_subscription_id_.fetch_add(1, std::memory_order_relaxed);
+        const SubscriptionId id = sub.id;
+        std::unique_lock lock(local->mutex);
+        std::shared_ptr<const SubscriberList> previous = local->subscribers;
+        auto next = std::make_shared<SubscriberList>(*previous);
+        next->push_back(std::move(sub));
+        local->subscribers = std::move(next);
+        local->subscribers_version.fetch_add(1, std::memory_order_seq_cst);
+        if (!local->consumer_started && !stopping_ && !start_consumer(local)) {
+            // Every cursor slot is claimed by other processes; nothing would ever deliver.
+            local->subscribers = std::move(previous);
+            local->subscribers_version.fetch_add(1, std::memory_order_seq_cst);
+            return kInvalidSubscription;
+        }
+        return id;
+    }
+
+    uint8_t* topic_base(uint32_t index) const {
+        return base_ + round_up(sizeof(ShmRegionHeader), kCacheLine) + static_cast<size_t>(index) * layout_.topic_stride;
+    }
+
+    ShmTopicHeader* topic_at(uint32_t index) const {
+        return reinterpret_cast<ShmTopicHeader*>(topic_base(index));
+    }
+
+    ShmConsumerCursor* consumer_at(const ShmTopicHeader* shm, uint32_t index) const {
+        auto* first = reinterpret_cast<uint8_t*>(const_cast<ShmTopicHeader*>(shm)) + sizeof(ShmTopicHeader);
+        return reinterpret_cast<ShmConsumerCursor*>(first) + index;
+    }
+
+    ShmSlotHeader* slot_at(ShmTopicHeader* shm, uint64_t seq) const {
+        const size_t index = static_cast<size_t>(seq & (layout_.slot_count - 1));
+        auto* slots = reinterpret_cast<uint8_t*>(shm) + layout_.topic_header_bytes;
+        return reinterpret_cast<ShmSlotHeader*>(slots + index * layout_.slot_stride);
+    }
+
+    static uint8_t* slot_payload(ShmSlotHeader* slot) {
+        return reinterpret_cast<uint8_t*>(slot) + sizeof(ShmSlotHeader);
+    }
+
+    ShmRegionHeader* region_header() const {
+        return reinterpret_cast<ShmRegionHeader*>(base_);
+    }
+
+    const ShmTopicHeader* find_topic(const std::string& topic) const {
+        for (uint32_t i = 0; i < layout_.max_topics; ++i) {
+            const ShmTopicHeader* shm = topic_at(i);
+            if (shm->state.load(std::memory_order_acquire) != kTopicReady) continue;
+            if (std::strncmp(shm->name, topic.c_str(), kTopicNameLen) == 0) return shm;
+        }
+        return nullptr;
+    }
+
+    ShmTopicHeader* find_or_create_topic(const std::string& topic) {
+        if (topic.empty() || topic.size() >= kTopicNameLen) return nullptr;
+        if (const ShmTopicHeader* existing = find_topic(topic)) {
+            return const_cast<ShmTopicHeader*>(existing);
+        }
+
+        // Topic creation is rare; serialize it across processes with a region-wide spinlock
+        // so two processes cannot register the same name in different slots.
+        ShmRegionHeader* header = region_header();
+        uint32_t expected = 0;
+        while (!header->topic_lock.compare_exchange_weak(expected, 1, std::memory_order_acquire)) {
+            expected = 0;
+            cpu_relax();
+        }
+
+        ShmTopicHeader* result = const_cast<ShmTopicHeader*>(find_topic(topic));
+        for (uint32_t i = 0; !result && i < layout_.max_topics; ++i) {
+            ShmTopicHeader* shm = topic_at(i);
+            if (shm->state.load(std::memory_order_acquire) != kTopicFree) continue;
+            std::memset(shm->name, 0, sizeof(shm->name));
+            std::memcpy(shm->name, topic.data(), topic.size());
+            shm->state.store(kTopicReady, std::memory_order_release);
+            result = shm;
+        }
+
+        header->topic_lock.store(0, std::memory_order_release);
+        return result;
+    }
+
+    LocalTopic* get_or_attach_topic(const std::string& topic) {
+        {
+            std::shared_lock lock(mutex_);
+            auto it = topics_.find(topic);
+            if (it != topics_.end()) {
+                return it->second.get();
+            }
+        }
+        std::unique_lock lock(mutex_);
+        auto it = topics_.find(topic);
+        if (it != topics_.end()) {
+            return it->second.get();
+        }
+        ShmTopicHeader* shm = find_or_create_topic(topic);
+        if (!shm) return nullptr;
+        auto local = std::make_unique<LocalTopic>();
+        local->shm = shm;
+        auto wait_it = config_.topic_wait.find(topic);
+        local->wait = (wait_it != config_.topic_wait.end()) ? wait_it->second : config_.wait;
+        LocalTopic* ptr = local.get();
+        topics_[topic] = std::move(local);
+        return ptr;
+    }
+
+    uint64_t min_consumer_cursor(const ShmTopicHeader* shm, uint64_t head) const {
+        uint64_t min_cursor = head;
+        for (uint32_t i = 0; i < layout_.max_consumers; ++i) {
+            const ShmConsumerCursor* consumer = consumer_at(shm, i);
+            if (consumer->active.load(std::memory_order_acquire) != kConsumerActive) continue;
+            const uint64_t cursor = consumer->cursor.load(std::memory_order_acquire);
+            if (cursor < min_cursor) min_cursor = cursor;
+        }
+        return min_cursor;
+    }
+
+    bool claim_sequence(ShmTopicHeader* shm, uint64_t* out_seq) {
+        const uint64_t capacity = layout_.slot_count;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(config_.block_timeout_ms);
+        bool counted = false;
+        uint64_t head = shm->head.load(std::memory_order_acquire);
+
+        for (;;) {
+            const bool full = (head - min_consumer_cursor(shm, head)) >= capacity;
+            if (full && !counted) {
+                counted = true;
+                shm->backpressure_hits.fetch_add(1, std::memory_order_relaxed);
+                if (region_policy_ != BackpressurePolicy::Block) {
+                    // DropNewest rejects this message; DropOldest overwrites the oldest unread one.
+                    shm->drops.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (full && region_policy_ == BackpressurePolicy::DropNewest) {
+                return false;
+            }
+            if (full && region_policy_ == BackpressurePolicy::Block) {
+                if (!wait_for_space(shm, deadline)) return false;
+                head = shm->head.load(std::memory_order_acquire);
+                continue;
+            }
+            if (shm->head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                *out_seq = head;
+                return true;
+            }
+        }
+    }
+
+    bool wait_for_space(ShmTopicHeader* shm, std::chrono::steady_clock::time_point deadline) {
+        const uint64_t capacity = layout_.slot_count;
+        for (;;) {
+            const uint32_t observed = shm->space_word.load(std::memory_order_seq_cst);
+            shm->space_waiters.fetch_add(1, std::memory_order_seq_cst);
+            const uint64_t head = shm->head.load(std::memory_order_acquire);
+            const bool has_space = (head - min_consumer_cursor(shm, head)) < capacity;
+            if (!has_space && !stopping_) {
+                futex_wait(&shm->space_word, observed, kParkTimeoutMs);
+            }
+            shm->space_waiters.fetch_sub(1, std::memory_order_seq_cst);
+            if (has_space) return true;
+            if (stopping_) return false;
+            if (config_.block_timeout_ms != 0 && std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            const uint64_t latest = shm->head.load(std::memory_order_acquire);
+            if ((latest - min_consumer_cursor(shm, latest)) < capacity) return true;
+        }
+    }
+
+    // Claims a consumer cursor slot and starts the worker. Returns false if all
+    // max_consumers slots are taken.
+    bool start_consumer(LocalTopic* local) {
+        ShmTopicHeader* shm = local->shm;
+        for (uint32_t i = 0; i < layout_.max_consumers; ++i) {
+            ShmConsumerCursor* consumer = consumer_at(shm, i);
+            uint32_t expected = kConsumerFree;
+            if (!consumer->active.compare_exchange_strong(expected, kConsumerClaimed, std::memory_order_acq_rel)) continue;
+            // New subscribers start at the current head; history is not replayed. The cursor
+            // is stored before the slot turns active, so publishers never see a stale one.
+            consumer->cursor.store(shm->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+            consumer->active.store(kConsumerActive, std::memory_order_release);
+            local->consumer_index = i;
+            local->running.store(true, std::memory_order_release);
+            local->worker = std::thread([this, local] { consumer_loop(local); });
+            local->consumer_started = true;
+            return true;
+        }
+        return false;
+    }
+
+    void consumer_loop(LocalTopic* local) {
+        ShmTopicHeader* shm = local->shm;
+        ShmConsumerCursor* consumer = consumer_at(shm, local->consumer_index);
+        const uint64_t capacity = layout_.slot_count;
+        const bool may_overwrite = (region_policy_ == BackpressurePolicy::DropOldest);
+        std::vector<uint8_t> scratch(may_overwrite ? layout_.slot_payload_bytes : 0);
+        uint64_t next = consumer->cursor.load(std::memory_order_acquire);
+        std::shared_ptr<const SubscriberList> snapshot;
+        uint64_t seen_version = 0;
+        detail::MessageDispatch dispatch;
+        const ConsumerWaitConfig wait = local->wait;
+        const uint32_t spin_budget = (wait.strategy == WaitStrategy::Block) ? 0 : wait.spin_budget;
+        uint32_t idle_spins = 0;
+        uint64_t spins = 0;
+        auto flush_spins = [&] {
+            if (spins > 0) {
+                local->wait_spins.fetch_add(spins, std::memory_order_relaxed);
+                spins = 0;
+            }
+        };
+
+        while (local->running.load(std::memory_order_acquire)) {
+            ShmSlotHeader* slot = slot_at(shm, next);
+            const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+
+            if (seq == next + 1) {
+                idle_spins = 0;
+                flush_spins();
+                const uint32_t size = slot->size;
+                const uint64_t publish_ns = slot->publish_ns;
+                const uint8_t* payload = slot_payload(slot);
+                bool lapped = (size > layout_.slot_payload_bytes);
+                if (!lapped && may_overwrite) {
+                    // Seqlock read: copy out, then confirm the slot was not rewritten meanwhile.
+                    std::memcpy(scratch.data(), payload, size);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    lapped = (slot->seq.load(std::memory_order_relaxed) != seq);
+                    payload = scratch.data();
+                }
+                if (!lapped) {
+                    shm->dwell_hist.record(argentum::core::now_ns() - publish_ns);
+                    // Announce the snapshot before re-checking the version so unsubscribe()
+                    // either sees this dispatch or we pick up its newer list.
+                    for (;;) {
+                        if (local->subscribers_version.load(std::memory_order_seq_cst) != seen_version) {
+                            std::unique_lock lock(local->mutex);
+                            snapshot = local->subscribers;
+                            seen_version = local->subscribers_version.load(std::memory_order_relaxed);
+                        }
+                        local->dispatching.store(seen_version, std::memory_order_seq_cst);
+                        if (local->subscribers_version.load(std::memory_order_seq_cst) == seen_version) break;
+                    }
+                    dispatch.reset(payload, size, nullptr);
+                    for (const Subscriber& sub : *snapshot) {
+                        const uint64_t cb_start_ns = argentum::core::now_ns();
+                        dispatch.deliver(sub);
+                        shm->callback_hist.record(argentum::core::now_ns() - cb_start_ns);
+                    }
+                    local->dispatching.store(0, std::memory_order_release);
+                    ++next;
+                } else {
+                    const uint64_t head = shm->head.load(std::memory_order_acquire);
+                    next = (head > capacity) ? std::max(next + 1, head - capacity) : next + 1;
+                }
+                consumer->cursor.store(next, std::memory_order_release);
+                if (shm->space_waiters.load(std::memory_order_seq_cst) > 0) {
+                    shm->space_word.fetch_add(1, std::memory_order_seq_cst);
+                    futex_wake_all(&shm->space_word);
+                }
+                continue;
+            }
+
+            if (seq != kSlotBusy && seq > next + 1) {
+                // Lapped by DropOldest publishers: skip to the oldest sequence still retained.
+                const uint64_t head = shm->head.load(std::memory_order_acquire);
+                next = (head > capacity) ? std::max(next + 1, head - capacity) : next + 1;
+                consumer->cursor.store(next, std::memory_order_release);
+                continue;
+            }
+
+            if (wait.strategy == WaitStrategy::BusySpin || idle_spins < spin_budget) {
+                ++idle_spins;
+                ++spins;
+                cpu_relax();
+                continue;
+            }
+            flush_spins();
+            if (wait.strategy == WaitStrategy::SpinYield) {
+                local->wait_yields.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::yield();
+                continue;
+            }
+
+            local->wait_parks.fetch_add(1, std::memory_order_relaxed);
+            const uint32_t observed = shm->data_word.load(std::memory_order_seq_cst);
+            shm->data_waiters.fetch_add(1, std::memory_order_seq_cst);
+            if (slot->seq.load(std::memory_order_acquire) != next + 1 &&
+                local->running.load(std::memory_order_acquire)) {
+                futex_wait(&shm->data_word, observed, kParkTimeoutMs);
+            }
+            shm->data_waiters.fetch_sub(1, std::memory_order_seq_cst);
+        }
+        flush_spins();
+    }
+
+    void update_publish_latency(ShmTopicHeader* shm, uint64_t start_ns) {
+        const uint64_t elapsed = argentum::core::now_ns() - start_ns;
+        shm->publish_hist.record(elapsed);
+        shm->publish_latency_ns_total.fetch_add(elapsed, std::memory_order_relaxed);
+        uint64_t prev = shm->publish_latency_ns_max.load(std::memory_order_relaxed);
+        while (elapsed > prev &&
+               !shm->publish_latency_ns_max.compare_exchange_weak(prev, elapsed, std::memory_order_relaxed)) {
+        }
+    }
+
+    void shutdown() {
+        // Workers are joined without mutex_ held: a callback still in flight may publish,
+        // read metrics or unsubscribe, all of which take mutex_ shared.
+        std::vector<LocalTopic*> locals;
+        {
+            std::unique_lock lock(mutex_);
+            stopping_ = true;
+            locals.reserve(topics_.size());
+            for (auto& [_, local] : topics_) locals.push_back(local.get());
+        }
+        for (LocalTopic* local : locals) {
+            std::thread worker;
+            {
+                // add_subscriber checks stopping_ under this mutex, so no consumer starts after it.
+                std::lock_guard topic_lock(local->mutex);
+                if (!local->consumer_started) continue;
+                local->consumer_started = false;
+                local->running.store(false, std::memory_order_release);
+                worker = std::move(local->worker);
+            }
+            local->shm->data_word.fetch_add(1, std::memory_order_seq_cst);
+            futex_wake_all(&local->shm->data_word);
+            if (worker.joinable()) worker.join();
+            consumer_at(local->shm, local->consumer_index)->active.store(kConsumerFree, std::memory_order_release);
+            local->shm->space_word.fetch_add(1, std::memory_order_seq_cst);
+            futex_wake_all(&local->shm->space_word);
+        }
+    }
+
+    void unmap_region() {
+        if (base_) {
+            munmap(base_, mapped_bytes_);
+            base_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+        if (config_.unlink_on_close && !shm_name_.empty()) {
+            shm_unlink(shm_name_.c_str());
+        }
+    }
+
+private:
+    ShmBusConfig config_;
+    ShmLayout layout_{};
+    BackpressurePolicy region_policy_ = BackpressurePolicy::DropNewest;
+    std::atomic<bool> stopping_{false};
+    uint8_t* base_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    int fd_ = -1;
+    std::string shm_name_;
+    std::unordered_map<std::string, std::unique_ptr<LocalTopic>> topics_;
+    std::atomic<SubscriptionId> next_subscription_id_{1};
+    mutable std::shared_mutex mutex_;
+};
+
+std::shared_ptr<MessageBus> create_shm_bus(const ShmBusConfig& config) {
+    auto bus = std::make_shared<ShmMessageBus>(config);
+    if (!config.region_name.empty() && !bus->map_region(config.region_name)) {
+        return nullptr;
+    }
+    return bus;
+}
+
+#else
+
+std::shared_ptr<MessageBus> create_shm_bus(const ShmBusConfig& config) {
+    (void)config;
+    return nullptr; // Shared-memory transport is POSIX-only for now.
+}
+
+#endif
+
+} // namespace argentum::bus
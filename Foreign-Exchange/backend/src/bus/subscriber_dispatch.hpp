@@ -0,0 +1,115 @@
+#pragma once
+
+// Internal to argentum_bus: subscriber entries and per-message fan-out shared by the
+// in-process and shared-memory buses.
+
+#include "bus/message_bus.hpp"
+
+#include <cstring>
+#include <vector>
+
+namespace argentum::bus::detail {
+
+struct Subscriber {
+    SubscriptionId id = kInvalidSubscription;
+    MessageCallback raw;                // set for byte subscribers
+    const TypedCodecOps* ops = nullptr; // set for typed subscribers
+    TypedCallback typed;
+    DecodeErrorCallback on_error;
+};
+using SubscriberList = std::vector<Subscriber>;
+
+/**
+ * @brief Fans one message out to a subscriber snapshot.
+ * A message arrives either as encoded bytes or as a typed value. Bytes are decoded at
+ * most once per value type (for up to kDecodeSlots types per topic, in any subscriber
+ * order) and values are encoded at most once, only if a byte subscriber needs them.
+ * One instance lives on each consumer thread so the scratch buffers are reused across
+ * messages.
+ */
+class MessageDispatch {
+public:
+    void reset(const void* data, size_t size, const TypedCodecOps* value_ops) {
+        data_ = static_cast<const uint8_t*>(data);
+        size_ = size;
+        value_ops_ = value_ops;
+        bytes_ready_ = (value_ops == nullptr);
+        decoded_count_ = 0;
+        if (value_ops) {
+            // Queued values are byte copies; realign before handing out const T&.
+            std::memcpy(value_, data, value_ops->value_size);
+        }
+    }
+
+    void deliver(const Subscriber& sub) {
+        if (sub.raw) {
+            if (ensure_bytes()) sub.raw(data_, size_);
+            return;
+        }
+        if (!sub.ops || !sub.typed) return;
+        if (sub.ops == value_ops_) {
+            sub.typed(value_);
+            return;
+        }
+        const Decoded& decoded = decode(sub.ops);
+        if (decoded.status == ARGENTUM_OK) {
+            sub.typed(decoded.value);
+        } else if (sub.on_error) {
+            sub.on_error(decoded.status);
+        }
+    }
+
+private:
+    static constexpr size_t kDecodeSlots = 4;
+
+    struct Decoded {
+        const TypedCodecOps* ops = nullptr;
+        ArgentumStatus status = ARGENTUM_OK;
+        alignas(kMaxTypedValueAlign) unsigned char value[kMaxTypedValueBytes];
+    };
+
+    // Subscribers of one topic rarely use more than a couple of value types, so a linear
+    // scan beats hashing. Past kDecodeSlots types the slots are reused round-robin.
+    const Decoded& decode(const TypedCodecOps* ops) {
+        for (size_t i = 0; i < decoded_count_; ++i) {
+            if (decoded_[i].ops == ops) return decoded_[i];
+        }
+        Decoded& slot = decoded_count_ < kDecodeSlots ? decoded_[decoded_count_++] : decoded_[next_evict_++ % kDecodeSlots];
+        slot.ops = ops;
+        slot.status = ensure_bytes() ? ops->decode(data_, size_, slot.value) : ARGENTUM_ERR_PROTO;
+        return slot;
+    }
+
+    bool ensure_bytes() {
+        if (bytes_ready_) return true;
+        if (value_ops_->encode(value_, &encoded_) != ARGENTUM_OK) return false;
+        data_ = encoded_.data();
+        size_ = encoded_.size();
+        bytes_ready_ = true;
+        return true;
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    const TypedCodecOps* value_ops_ = nullptr;
+    bool bytes_ready_ = true;
+    size_t decoded_count_ = 0;
+    size_t next_evict_ = 0;
+    std::vector<uint8_t> encoded_;
+    alignas(kMaxTypedValueAlign) unsigned char value_[kMaxTypedValueBytes];
+    Decoded decoded_[kDecodeSlots];
+};
+
+inline Subscriber make_typed_subscriber(SubscriptionId id,
+                                        const TypedCodecOps& ops,
+                                        TypedCallback callback,
+                                        DecodeErrorCallback on_error) {
+    Subscriber sub;
+    sub.id = id;
+    sub.ops = &ops;
+    sub.typed = std::move(callback);
+    sub.on_error = std::move(on_error);
+    return sub;
+}
+
+} // namespace argentum::bus::detail
@@ -0,0 +1,191 @@
+#include "codec/compact_tick_codec.hpp"
+
+#include "core/fixed_point.hpp"
+#include "core/instrument_registry.hpp"
+
+#include <cstring>
+#include <limits>
+#include <string_view>
+
+namespace argentum::codec {
+
+namespace {
+
+constexpr size_t kPayloadOffset = sizeof(bus::MessageHeaderV2);
+constexpr size_t kRecordsOffset = kPayloadOffset + sizeof(CompactTickBatchHeader);
+
+std::string_view bounded_name(const char* name, size_t capacity) {
+    const void* nul = std::memchr(name, '\0', capacity);
+    return std::string_view(name, nul ? static_cast<size_t>(static_cast<const char*>(nul) - name) : capacity);
+}
+
+void copy_name(std::string_view name, char* out, size_t capacity) {
+    std::memset(out, 0, capacity);
+    std::memcpy(out, name.data(), name.size() < capacity ? name.size() : capacity - 1);
+}
+
+} // namespace
+
+ArgentumStatus to_compact_tick(const MarketTick& tick, CompactTick* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    const std::string_view source = bounded_name(tick.source, sizeof(tick.source));
+    // Ticks resolved by the feed parsers already carry the registry id; skip the locked intern.
+    const uint32_t instrument = tick.instrument_id != core::InstrumentRegistry::kInvalidId
+                                    ? tick.instrument_id
+                                    : core::instrument_registry().intern(bounded_name(tick.symbol, sizeof(tick.symbol)));
+    const uint32_t venue = source.empty() ? 0 : core::venue_registry().intern(source);
+    if (instrument == core::InstrumentRegistry::kInvalidId) return ARGENTUM_ERR_RANGE;
+    if (venue == core::InstrumentRegistry::kInvalidId && !source.empty()) return ARGENTUM_ERR_RANGE;
+    if (venue > std::numeric_limits<uint16_t>::max()) return ARGENTUM_ERR_RANGE;
+
+    out->timestamp_ns = tick.timestamp_ns;
+    out->price_ticks = core::to_price_ticks(tick.price);
+    out->quantity_lots = core::to_quantity_lots(tick.quantity);
+    out->instrument_id = instrument;
+    out->venue_id = static_cast<uint16_t>(venue);
+    out->side = tick.side;
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus from_compact_tick(const CompactTick& tick, MarketTick* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    const std::string_view symbol = core::instrument_registry().name(tick.instrument_id);
+    if (symbol.empty()) return ARGENTUM_ERR_PROTO;
+    const std::string_view source = core::venue_registry().name(tick.venue_id);
+    if (tick.venue_id != 0 && source.empty()) return ARGENTUM_ERR_PROTO;
+
+    *out = MarketTick{};
+    out->timestamp_ns = tick.timestamp_ns;
+    out->price = core::from_price_ticks(tick.price_ticks);
+    out->quantity = core::from_quantity_lots(tick.quantity_lots);
+    copy_name(symbol, out->symbol, sizeof(out->symbol));
+    copy_name(source, out->source, sizeof(out->source));
+    out->side = tick.side;
+    out->instrument_id = tick.instrument_id;
+    return ARGENTUM_OK;
+}
+
+CompactTickFrameWriter::CompactTickFrameWriter(std::span<uint8_t> out, uint32_t flags)
+    : out_(out), flags_(flags) {}
+
+size_t CompactTickFrameWriter::capacity() const {
+    if (out_.size() < kRecordsOffset) return 0;
+    return (out_.size() - kRecordsOffset) / sizeof(CompactTickRecord);
+}
+
+ArgentumStatus CompactTickFrameWriter::add(const CompactTick& tick) {
+    if (count_ >= capacity()) return ARGENTUM_ERR_RANGE;
+    if (count_ == 0) {
+        base_ns_ = tick.timestamp_ns;
+    } else if (tick.timestamp_ns < base_ns_ ||
+               tick.timestamp_ns - base_ns_ > std::numeric_limits<uint32_t>::max()) {
+        return ARGENTUM_ERR_RANGE;
+    }
+
+    CompactTickRecord record{};
+    record.price_ticks = tick.price_ticks;
+    record.quantity_lots = tick.quantity_lots;
+    record.instrument_id = tick.instrument_id;
+    record.ts_delta_ns = static_cast<uint32_t>(tick.timestamp_ns - base_ns_);
+    record.venue_id = tick.venue_id;
+    record.side = tick.side;
+    std::memcpy(out_.data() + kRecordsOffset + count_ * sizeof(CompactTickRecord), &record, sizeof(record));
+    ++count_;
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus CompactTickFrameWriter::finish(size_t* out_written) {
+    if (!out_written) return ARGENTUM_ERR_INVALID;
+    const size_t total = compact_tick_frame_size(count_);
+    *out_written = total;
+    if (out_.size() < total) return ARGENTUM_ERR_RANGE;
+
+    CompactTickBatchHeader batch{};
+    batch.count = static_cast<uint32_t>(count_);
+    std::memcpy(out_.data() + kPayloadOffset, &batch, sizeof(batch));
+
+    const size_t payload_size = total - kPayloadOffset;
+    bus::MessageHeaderV2 header{};
+    header.version = bus::kMessageProtocolVersionV3;
+    header.type = static_cast<uint16_t>(bus::MessageType::MarketTick);
+    header.size = static_cast<uint32_t>(payload_size);
+    header.timestamp_ns = base_ns_;
+    header.flags = flags_;
+    header.crc32 = (flags_ & static_cast<uint32_t>(bus::MessageFlags::HasCrc32))
+                       ? bus::compute_payload_checksum(flags_, out_.data() + kPayloadOffset, payload_size)
+                       : 0;
+    std::memcpy(out_.data(), &header, sizeof(header));
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus encode_compact_tick_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written) {
+    if (!out_written) return ARGENTUM_ERR_INVALID;
+    CompactTick compact{};
+    const ArgentumStatus status = to_compact_tick(tick, &compact);
+    if (status != ARGENTUM_OK) return status;
+
+    *out_written = compact_tick_frame_size(1);
+    if (out.size() < *out_written) return ARGENTUM_ERR_RANGE;
+    CompactTickFrameWriter writer(out);
+    (void)writer.add(compact);
+    return writer.finish(out_written);
+}
+
+ArgentumStatus encode_compact_tick(const MarketTick& tick, std::vector<uint8_t>* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    out->resize(compact_tick_frame_size(1));
+    size_t written = 0;
+    return encode_compact_tick_into(tick, *out, &written);
+}
+
+ArgentumStatus decode_compact_ticks(const void* data, size_t size, std::span<CompactTick> out, size_t* out_count) {
+    if (!data || !out_count) return ARGENTUM_ERR_INVALID;
+    *out_count = 0;
+
+    bus::DecodedHeader decoded{};
+    const ArgentumStatus status = bus::decode_header(data, size, &decoded);
+    if (status != ARGENTUM_OK) return status;
+    if (decoded.header.version != bus::kMessageProtocolVersionV3 ||
+        decoded.header.type != static_cast<uint16_t>(bus::MessageType::MarketTick) ||
+        decoded.header.size < sizeof(CompactTickBatchHeader)) {
+        return ARGENTUM_ERR_PROTO;
+    }
+
+    const uint8_t* payload = static_cast<const uint8_t*>(data) + decoded.header_size;
+    CompactTickBatchHeader batch{};
+    std::memcpy(&batch, payload, sizeof(batch));
+    const size_t record_bytes = decoded.header.size - sizeof(batch);
+    if (record_bytes % sizeof(CompactTickRecord) != 0 || record_bytes / sizeof(CompactTickRecord) != batch.count) {
+        return ARGENTUM_ERR_PROTO;
+    }
+
+    *out_count = batch.count;
+    if (out.size() < batch.count) return ARGENTUM_ERR_RANGE;
+
+    const uint8_t* records = payload + sizeof(batch);
+    const uint64_t base_ns = decoded.header.timestamp_ns;
+    for (uint32_t i = 0; i < batch.count; ++i) {
+        CompactTickRecord record;
+        std::memcpy(&record, records + i * sizeof(CompactTickRecord), sizeof(record));
+        CompactTick& tick = out[i];
+        tick.timestamp_ns = base_ns + record.ts_delta_ns;
+        tick.price_ticks = record.price_ticks;
+        tick.quantity_lots = record.quantity_lots;
+        tick.instrument_id = record.instrument_id;
+        tick.venue_id = record.venue_id;
+        tick.side = record.side;
+    }
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus CompactMarketTickCodec::decode(const void* data, size_t size, MarketTick* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    CompactTick compact{};
+    size_t count = 0;
+    const ArgentumStatus status = decode_compact_ticks(data, size, std::span<CompactTick>(&compact, 1), &count);
+    if (status != ARGENTUM_OK) return status;
+    if (count != 1) return ARGENTUM_ERR_PROTO;
+    return from_compact_tick(compact, out);
+}
+
+} // namespace argentum::codec
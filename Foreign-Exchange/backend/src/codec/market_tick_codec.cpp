@@ -1,52 +1,119 @@
 #include "codec/market_tick_codec.hpp"
 
 #include "bus/message_protocol.hpp"
+#include "codec/compact_tick_codec.hpp"
 
+#include <cstddef>
 #include <cstring>
 
 #ifdef ARGENTUM_USE_FLATBUFFERS
-#include "argentum_generated.h"
-#include <flatbuffers/flatbuffers.h>
-#include <flatbuffers/verifier.h>
+#include "codec/flatbuffer_views.hpp"
 #endif
 
 namespace argentum::codec {
 
+ArgentumStatus encode_market_tick_legacy_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written) {
+    return bus::encode_message_into(bus::MessageType::MarketTick, &tick, sizeof(tick), tick.timestamp_ns, out, out_written);
+}
+
 ArgentumStatus encode_market_tick_legacy(const MarketTick& tick, std::vector<uint8_t>* out) {
     if (!out) return ARGENTUM_ERR_INVALID;
-    *out = bus::encode_message(bus::MessageType::MarketTick, &tick, sizeof(tick), tick.timestamp_ns);
-    return ARGENTUM_OK;
+    out->resize(sizeof(bus::MessageHeaderV1) + sizeof(tick));
+    size_t written = 0;
+    return encode_market_tick_legacy_into(tick, *out, &written);
 }
 
 #ifdef ARGENTUM_USE_FLATBUFFERS
-ArgentumStatus encode_market_tick_flatbuffers(const MarketTick& tick, std::vector<uint8_t>* out, bool with_crc) {
-    if (!out) return ARGENTUM_ERR_INVALID;
+namespace {
 
-    flatbuffers::FlatBufferBuilder builder(128);
+// One builder per thread; Clear() keeps its buffer, so steady-state encodes do not allocate.
+// The returned buffer stays valid until the next call on the same thread.
+const flatbuffers::FlatBufferBuilder& build_market_tick(const MarketTick& tick) {
+    thread_local flatbuffers::FlatBufferBuilder builder(128);
+    builder.Clear();
     auto symbol = builder.CreateString(tick.symbol);
     auto source = builder.CreateString(tick.source);
-    auto tick_fb = argentum::CreateMarketTick(builder,
-                                              tick.timestamp_ns,
-                                              tick.price,
-                                              tick.quantity,
-                                              symbol,
-                                              source,
-                                              static_cast<argentum::Side>(tick.side));
+    auto tick_fb = fb::CreateMarketTick(builder,
+                                        tick.timestamp_ns,
+                                        tick.price,
+                                        tick.quantity,
+                                        symbol,
+                                        source,
+                                        static_cast<fb::Side>(tick.side));
     builder.Finish(tick_fb);
+    return builder;
+}
 
-    uint32_t flags = with_crc ? static_cast<uint32_t>(bus::MessageFlags::HasCrc32) : 0;
-    *out = bus::encode_message_v2(bus::MessageType::MarketTick,
-                                  builder.GetBufferPointer(),
-                                  builder.GetSize(),
-                                  tick.timestamp_ns,
-                                  flags);
-    return ARGENTUM_OK;
+uint32_t market_tick_flags(bool with_crc) {
+    return with_crc ? static_cast<uint32_t>(bus::MessageFlags::HasCrc32) : 0;
+}
+
+} // namespace
+
+ArgentumStatus encode_market_tick_flatbuffers_into(const MarketTick& tick,
+                                                   std::span<uint8_t> out,
+                                                   bool with_crc,
+                                                   size_t* out_written) {
+    const auto& builder = build_market_tick(tick);
+    return bus::encode_message_v2_into(bus::MessageType::MarketTick,
+                                       builder.GetBufferPointer(),
+                                       builder.GetSize(),
+                                       tick.timestamp_ns,
+                                       market_tick_flags(with_crc),
+                                       out,
+                                       out_written);
+}
+
+ArgentumStatus encode_market_tick_flatbuffers(const MarketTick& tick, std::vector<uint8_t>* out, bool with_crc) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+
+    const auto& builder = build_market_tick(tick);
+    out->resize(sizeof(bus::MessageHeaderV2) + builder.GetSize());
+    size_t written = 0;
+    return bus::encode_message_v2_into(bus::MessageType::MarketTick,
+                                       builder.GetBufferPointer(),
+                                       builder.GetSize(),
+                                       tick.timestamp_ns,
+                                       market_tick_flags(with_crc),
+                                       *out,
+                                       &written);
+}
+#endif
+
+ArgentumStatus encode_market_tick_into(const MarketTick& tick, std::span<uint8_t> out, size_t* out_written) {
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    return encode_market_tick_flatbuffers_into(tick, out, false, out_written);
+#else
+    return encode_market_tick_legacy_into(tick, out, out_written);
+#endif
 }
+
+ArgentumStatus encode_market_tick(const MarketTick& tick, std::vector<uint8_t>* out) {
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    return encode_market_tick_flatbuffers(tick, out, false);
+#else
+    return encode_market_tick_legacy(tick, out);
 #endif
+}
 
 ArgentumStatus decode_market_tick(const void* data, size_t size, MarketTick* out) {
     if (!data || !out) return ARGENTUM_ERR_INVALID;
 
+    uint16_t version = 0;
+    if (size >= sizeof(version)) std::memcpy(&version, data, sizeof(version));
+    if (version == bus::kMessageProtocolVersionV3) {
+        return CompactMarketTickCodec::decode(data, size, out);
+    }
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    if (version == bus::kMessageProtocolVersionV2) {
+        MarketTickView view;
+        const ArgentumStatus status = MarketTickView::open(data, size, &view);
+        if (status != ARGENTUM_OK) return status;
+        view.copy_to(out);
+        return ARGENTUM_OK;
+    }
+#endif
+
     bus::DecodedHeader decoded{};
     ArgentumStatus status = bus::decode_header(data, size, &decoded);
     if (status != ARGENTUM_OK) return status;
@@ -58,32 +125,6 @@ ArgentumStatus decode_market_tick(const void* data, size_t size, MarketTick* out
     const uint8_t* payload = bus::payload_ptr(data, size, decoded.header_size);
     if (!payload) return ARGENTUM_ERR_PROTO;
 
-#ifdef ARGENTUM_USE_FLATBUFFERS
-    if (decoded.header.version == bus::kMessageProtocolVersionV2) {
-        flatbuffers::Verifier verifier(payload, decoded.header.size);
-        if (!verifier.VerifyBuffer<argentum::MarketTick>(nullptr)) return ARGENTUM_ERR_PROTO;
-        const auto* tick_fb = flatbuffers::GetRoot<argentum::MarketTick>(payload);
-        if (!tick_fb) return ARGENTUM_ERR_PROTO;
-
-        out->timestamp_ns = tick_fb->timestamp_ns();
-        out->price = tick_fb->price();
-        out->quantity = tick_fb->quantity();
-
-        std::memset(out->symbol, 0, sizeof(out->symbol));
-        std::memset(out->source, 0, sizeof(out->source));
-
-        if (const auto* symbol = tick_fb->symbol()) {
-            std::strncpy(out->symbol, symbol->c_str(), sizeof(out->symbol) - 1);
-        }
-        if (const auto* source = tick_fb->source()) {
-            std::strncpy(out->source, source->c_str(), sizeof(out->source) - 1);
-        }
-
-        out->side = static_cast<uint8_t>(tick_fb->side());
-        return ARGENTUM_OK;
-    }
-#endif
-
     if (decoded.header.version != bus::kMessageProtocolVersionV1) {
         return ARGENTUM_ERR_PROTO;
     }
@@ -96,4 +137,61 @@ ArgentumStatus decode_market_tick(const void* data, size_t size, MarketTick* out
     return ARGENTUM_OK;
 }
 
+namespace {
+
+// Symbol keys copy at most SYMBOL_LEN - 1 bytes, so the top byte of `hi` is always zero
+// and cannot match an id key.
+constexpr uint64_t kInstrumentIdKeyTag = ~0ULL;
+
+void symbol_key(const char* symbol, size_t length, bus::ConflationKey* out_key) {
+    char bytes[sizeof(bus::ConflationKey)] = {};
+    size_t n = 0;
+    while (n < length && n < SYMBOL_LEN - 1 && symbol[n] != '\0') ++n;
+    std::memcpy(bytes, symbol, n);
+    std::memcpy(&out_key->lo, bytes, sizeof(out_key->lo));
+    std::memcpy(&out_key->hi, bytes + sizeof(out_key->lo), sizeof(out_key->hi));
+}
+
+} // namespace
+
+bool market_tick_conflation_key(const void* data, size_t size, bus::ConflationKey* out_key) {
+    if (!data || !out_key || size < sizeof(bus::MessageHeaderV1)) return false;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    bus::MessageHeaderV1 header{};
+    std::memcpy(&header, bytes, sizeof(header));
+    if (header.type != static_cast<uint16_t>(bus::MessageType::MarketTick)) return false;
+
+    if (header.version == bus::kMessageProtocolVersionV1) {
+        if (header.size != sizeof(MarketTick) || size != sizeof(header) + sizeof(MarketTick)) return false;
+        symbol_key(reinterpret_cast<const char*>(bytes + sizeof(header) + offsetof(MarketTick, symbol)), SYMBOL_LEN, out_key);
+        return true;
+    }
+    if (header.version == bus::kMessageProtocolVersionV3) {
+        // Only single-tick batches have one key; ids come from this process's registry.
+        if (size != compact_tick_frame_size(1)) return false;
+        CompactTickBatchHeader batch{};
+        std::memcpy(&batch, bytes + sizeof(bus::MessageHeaderV2), sizeof(batch));
+        if (batch.count != 1) return false;
+        uint32_t instrument_id = 0;
+        std::memcpy(&instrument_id,
+                    bytes + sizeof(bus::MessageHeaderV2) + sizeof(batch) + offsetof(CompactTickRecord, instrument_id),
+                    sizeof(instrument_id));
+        out_key->lo = instrument_id;
+        out_key->hi = kInstrumentIdKeyTag;
+        return true;
+    }
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    if (header.version == bus::kMessageProtocolVersionV2) {
+        // The symbol is only reachable through the table, so the frame is verified but not copied out.
+        MarketTickView view;
+        if (MarketTickView::open(data, size, &view) != ARGENTUM_OK) return false;
+        const std::string_view symbol = view.symbol();
+        symbol_key(symbol.data(), symbol.size(), out_key);
+        return true;
+    }
+#endif
+    return false;
+}
+
 } // namespace argentum::codec
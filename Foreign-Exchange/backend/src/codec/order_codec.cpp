@@ -0,0 +1,165 @@
+#include "codec/order_codec.hpp"
+
+#include "bus/message_protocol.hpp"
+#include "core/fixed_point.hpp"
+
+#include <cstring>
+
+#ifdef ARGENTUM_USE_FLATBUFFERS
+#include "codec/flatbuffer_views.hpp"
+#endif
+
+namespace argentum::codec {
+
+namespace {
+
+// Shared V1 decode: the payload is the raw struct.
+template <typename T>
+ArgentumStatus decode_raw(const void* data, size_t size, bus::MessageType type, T* out) {
+    bus::DecodedHeader decoded{};
+    const ArgentumStatus status = bus::decode_header(data, size, &decoded);
+    if (status != ARGENTUM_OK) return status;
+    if (decoded.header.type != static_cast<uint16_t>(type) ||
+        decoded.header.version != bus::kMessageProtocolVersionV1 ||
+        decoded.header.size != sizeof(T)) {
+        return ARGENTUM_ERR_PROTO;
+    }
+    std::memcpy(out, static_cast<const uint8_t*>(data) + decoded.header_size, sizeof(T));
+    return ARGENTUM_OK;
+}
+
+uint16_t frame_version(const void* data, size_t size) {
+    uint16_t version = 0;
+    if (size >= sizeof(version)) std::memcpy(&version, data, sizeof(version));
+    return version;
+}
+
+#ifdef ARGENTUM_USE_FLATBUFFERS
+
+flatbuffers::FlatBufferBuilder& order_flow_builder() {
+    thread_local flatbuffers::FlatBufferBuilder builder(128);
+    builder.Clear();
+    return builder;
+}
+
+const flatbuffers::FlatBufferBuilder& build_order(const Order& order) {
+    auto& builder = order_flow_builder();
+    const void* nul = std::memchr(order.symbol, '\0', sizeof(order.symbol));
+    const size_t symbol_len = nul ? static_cast<size_t>(static_cast<const char*>(nul) - order.symbol) : sizeof(order.symbol);
+    auto symbol = builder.CreateString(order.symbol, symbol_len);
+    fb::OrderBuilder table(builder);
+    table.add_order_id(order.order_id);
+    table.add_client_id(order.client_id);
+    table.add_timestamp_ns(order.timestamp_ns);
+    table.add_price(order.price);
+    table.add_quantity(order.quantity);
+    table.add_symbol(symbol);
+    table.add_side(static_cast<fb::Side>(order.side));
+    table.add_type(order.type);
+    table.add_price_ticks(order.price_ticks);
+    table.add_quantity_lots(order.quantity_lots);
+    table.add_tif(order.tif);
+    builder.Finish(table.Finish());
+    return builder;
+}
+
+const flatbuffers::FlatBufferBuilder& build_trade(const Trade& trade) {
+    auto& builder = order_flow_builder();
+    fb::TradeBuilder table(builder);
+    table.add_trade_id(trade.trade_id);
+    table.add_maker_order_id(trade.maker_order_id);
+    table.add_taker_order_id(trade.taker_order_id);
+    table.add_timestamp_ns(trade.timestamp_ns);
+    table.add_price(trade.price);
+    table.add_quantity(trade.quantity);
+    table.add_side(static_cast<fb::Side>(trade.side));
+    table.add_price_ticks(trade.price_ticks);
+    table.add_quantity_lots(trade.quantity_lots);
+    builder.Finish(table.Finish());
+    return builder;
+}
+
+ArgentumStatus frame_builder(const flatbuffers::FlatBufferBuilder& builder,
+                             bus::MessageType type,
+                             uint64_t timestamp_ns,
+                             std::span<uint8_t> out,
+                             size_t* out_written) {
+    return bus::encode_message_v2_into(type, builder.GetBufferPointer(), builder.GetSize(), timestamp_ns, 0, out, out_written);
+}
+
+#endif
+
+} // namespace
+
+ArgentumStatus encode_order_into(const Order& order, std::span<uint8_t> out, size_t* out_written) {
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    return frame_builder(build_order(order), bus::MessageType::Order, order.timestamp_ns, out, out_written);
+#else
+    return bus::encode_message_into(bus::MessageType::Order, &order, sizeof(order), order.timestamp_ns, out, out_written);
+#endif
+}
+
+ArgentumStatus encode_order(const Order& order, std::vector<uint8_t>* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    out->resize(kOrderMaxEncodedBytes);
+    size_t written = 0;
+    const ArgentumStatus status = encode_order_into(order, *out, &written);
+    out->resize(status == ARGENTUM_OK ? written : 0);
+    return status;
+}
+
+ArgentumStatus decode_order(const void* data, size_t size, Order* out) {
+    if (!data || !out) return ARGENTUM_ERR_INVALID;
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    if (frame_version(data, size) == bus::kMessageProtocolVersionV2) {
+        OrderView view;
+        const ArgentumStatus status = OrderView::open(data, size, &view);
+        if (status != ARGENTUM_OK) return status;
+        view.copy_to(out);
+        return ARGENTUM_OK;
+    }
+#endif
+    if (frame_version(data, size) != bus::kMessageProtocolVersionV1) return ARGENTUM_ERR_PROTO;
+    const ArgentumStatus status = decode_raw(data, size, bus::MessageType::Order, out);
+    if (status == ARGENTUM_OK) core::normalize_order_scalars(out);
+    return status;
+}
+
+ArgentumStatus encode_trade_into(const Trade& trade, std::span<uint8_t> out, size_t* out_written) {
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    return frame_builder(build_trade(trade), bus::MessageType::Trade, trade.timestamp_ns, out, out_written);
+#else
+    return bus::encode_message_into(bus::MessageType::Trade, &trade, sizeof(trade), trade.timestamp_ns, out, out_written);
+#endif
+}
+
+ArgentumStatus encode_trade(const Trade& trade, std::vector<uint8_t>* out) {
+    if (!out) return ARGENTUM_ERR_INVALID;
+    out->resize(kTradeMaxEncodedBytes);
+    size_t written = 0;
+    const ArgentumStatus status = encode_trade_into(trade, *out, &written);
+    out->resize(status == ARGENTUM_OK ? written : 0);
+    return status;
+}
+
+ArgentumStatus decode_trade(const void* data, size_t size, Trade* out) {
+    if (!data || !out) return ARGENTUM_ERR_INVALID;
+#ifdef ARGENTUM_USE_FLATBUFFERS
+    if (frame_version(data, size) == bus::kMessageProtocolVersionV2) {
+        TradeView view;
+        const ArgentumStatus status = TradeView::open(data, size, &view);
+        if (status != ARGENTUM_OK) return status;
+        view.copy_to(out);
+        return ARGENTUM_OK;
+    }
+#endif
+    if (frame_version(data, size) != bus::kMessageProtocolVersionV1) return ARGENTUM_ERR_PROTO;
+    const ArgentumStatus status = decode_raw(data, size, bus::MessageType::Trade, out);
+    if (status == ARGENTUM_OK) {
+        if (out->price_ticks == 0 && out->price != 0.0) out->price_ticks = core::to_price_ticks(out->price);
+        if (out->quantity_lots == 0 && out->quantity != 0.0) out->quantity_lots = core::to_quantity_lots(out->quantity);
+    }
+    return status;
+}
+
+} // namespace argentum::codec
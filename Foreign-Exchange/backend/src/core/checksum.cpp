@@ -0,0 +1,300 @@
+#include "core/checksum.hpp"
+
+#include "core/cpu_features.hpp"
+
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(ARGENTUM_X86)
+#include <immintrin.h>
+#endif
+
+namespace argentum::core {
+
+namespace {
+
+using CrcTables = std::array<std::array<uint32_t, 256>, 8>;
+using CrcKernel = uint32_t (*)(uint32_t crc, const uint8_t* data, size_t size);
+
+// Table k maps a byte to its CRC contribution k positions ahead, so eight input
+// bytes are folded per iteration with independent lookups.
+constexpr CrcTables make_crc_tables(uint32_t reflected_poly) {
+    CrcTables tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int j = 0; j < 8; ++j) {
+            c = (c & 1U) ? (reflected_poly ^ (c >> 1)) : (c >> 1);
+        }
+        tables[0][i] = c;
+    }
+    for (size_t k = 1; k < tables.size(); ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            const uint32_t prev = tables[k - 1][i];
+            tables[k][i] = (prev >> 8) ^ tables[0][prev & 0xFFU];
+        }
+    }
+    return tables;
+}
+
+constexpr CrcTables kCrc32Tables = make_crc_tables(0xEDB88320U);
+constexpr CrcTables kCrc32cTables = make_crc_tables(0x82F63B78U);
+
+uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint32_t crc_slice8(const CrcTables& t, uint32_t crc, const uint8_t* p, size_t n) {
+    if constexpr (std::endian::native == std::endian::little) {
+        while (n >= 8) {
+            const uint32_t lo = load_u32(p) ^ crc;
+            const uint32_t hi = load_u32(p + 4);
+            crc = t[7][lo & 0xFFU] ^ t[6][(lo >> 8) & 0xFFU] ^ t[5][(lo >> 16) & 0xFFU] ^ t[4][lo >> 24] ^
+                  t[3][hi & 0xFFU] ^ t[2][(hi >> 8) & 0xFFU] ^ t[1][(hi >> 16) & 0xFFU] ^ t[0][hi >> 24];
+            p += 8;
+            n -= 8;
+        }
+    }
+    while (n-- > 0) {
+        crc = t[0][(crc ^ *p++) & 0xFFU] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t crc32_sw(uint32_t crc, const uint8_t* p, size_t n) {
+    return crc_slice8(kCrc32Tables, crc, p, n);
+}
+
+uint32_t crc32c_sw(uint32_t crc, const uint8_t* p, size_t n) {
+    return crc_slice8(kCrc32cTables, crc, p, n);
+}
+
+#if defined(ARGENTUM_X86)
+
+ARGENTUM_TARGET("sse4.2")
+uint32_t crc32c_sse42(uint32_t crc, const uint8_t* p, size_t n) {
+#if defined(_M_X64) || defined(__x86_64__)
+    uint64_t c = crc;
+    while (n >= 8) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        c = _mm_crc32_u64(c, v);
+        p += 8;
+        n -= 8;
+    }
+    crc = static_cast<uint32_t>(c);
+#endif
+    while (n >= 4) {
+        crc = _mm_crc32_u32(crc, load_u32(p));
+        p += 4;
+        n -= 4;
+    }
+    while (n-- > 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+
+// Carry-less multiply folding of CRC-32 (IEEE), after Gopal et al., "Fast CRC
+// Computation for Generic Polynomials Using PCLMULQDQ" (Intel, 2009). Four 128-bit
+// lanes are folded 64 bytes at a time, reduced to one lane, then Barrett-reduced.
+// Requires n >= 64 and n % 16 == 0; works on the raw (non-inverted) register.
+ARGENTUM_TARGET("sse4.2,pclmul")
+uint32_t crc32_fold_pclmul(uint32_t crc, const uint8_t* p, size_t n) {
+    alignas(16) static const uint64_t k1k2[2] = {0x0154442bd4ULL, 0x01c6e41596ULL};
+    alignas(16) static const uint64_t k3k4[2] = {0x01751997d0ULL, 0x00ccaa009eULL};
+    alignas(16) static const uint64_t k5k0[2] = {0x0163cd6124ULL, 0x0000000000ULL};
+    alignas(16) static const uint64_t poly[2] = {0x01db710641ULL, 0x01f7011641ULL};
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    p += 64;
+    n -= 64;
+
+    while (n >= 64) {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30)));
+        p += 64;
+        n -= 64;
+    }
+
+    // Fold the four lanes into one.
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    const __m128i* lanes[3] = {&x2, &x3, &x4};
+    for (const __m128i* lane : lanes) {
+        const __m128i lo = _mm_clmulepi64_si128(x1, k, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, *lane), lo);
+    }
+
+    while (n >= 16) {
+        const __m128i lo = _mm_clmulepi64_si128(x1, k, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p))), lo);
+        p += 16;
+        n -= 16;
+    }
+
+    // 128 -> 64 bits.
+    const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits.
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), k, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+uint32_t crc32_pclmul(uint32_t crc, const uint8_t* p, size_t n) {
+    // Below a few cache lines the table path wins over the fold setup cost.
+    if (n >= 64) {
+        const size_t chunk = n & ~static_cast<size_t>(15);
+        crc = crc32_fold_pclmul(crc, p, chunk);
+        p += chunk;
+        n -= chunk;
+    }
+    return crc32_sw(crc, p, n);
+}
+
+#endif
+
+CrcKernel select_crc32() {
+#if defined(ARGENTUM_X86)
+    const CpuFeatures& cpu = cpu_features();
+    if (cpu.pclmul && cpu.sse42) return crc32_pclmul;
+#endif
+    return crc32_sw;
+}
+
+CrcKernel select_crc32c() {
+#if defined(ARGENTUM_X86)
+    if (cpu_features().sse42) return crc32c_sse42;
+#endif
+    return crc32c_sw;
+}
+
+constexpr uint32_t kXxPrime1 = 2654435761U;
+constexpr uint32_t kXxPrime2 = 2246822519U;
+constexpr uint32_t kXxPrime3 = 3266489917U;
+constexpr uint32_t kXxPrime4 = 668265263U;
+constexpr uint32_t kXxPrime5 = 374761393U;
+
+uint32_t xx_round(uint32_t acc, uint32_t input) {
+    acc += input * kXxPrime2;
+    acc = std::rotl(acc, 13);
+    return acc * kXxPrime1;
+}
+
+} // namespace
+
+uint32_t crc32(const void* data, size_t size, uint32_t crc) {
+    static const CrcKernel kernel = select_crc32();
+    if (!data || size == 0) return crc;
+    return ~kernel(~crc, static_cast<const uint8_t*>(data), size);
+}
+
+uint32_t crc32c(const void* data, size_t size, uint32_t crc) {
+    static const CrcKernel kernel = select_crc32c();
+    if (!data || size == 0) return crc;
+    return ~kernel(~crc, static_cast<const uint8_t*>(data), size);
+}
+
+uint32_t xxhash32(const void* data, size_t size, uint32_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    if (!p) size = 0;
+    const uint8_t* const end = p + size;
+    uint32_t h;
+
+    if (size >= 16) {
+        uint32_t v1 = seed + kXxPrime1 + kXxPrime2;
+        uint32_t v2 = seed + kXxPrime2;
+        uint32_t v3 = seed;
+        uint32_t v4 = seed - kXxPrime1;
+        const uint8_t* const limit = end - 16;
+        do {
+            v1 = xx_round(v1, load_u32(p));
+            v2 = xx_round(v2, load_u32(p + 4));
+            v3 = xx_round(v3, load_u32(p + 8));
+            v4 = xx_round(v4, load_u32(p + 12));
+            p += 16;
+        } while (p <= limit);
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+    } else {
+        h = seed + kXxPrime5;
+    }
+
+    h += static_cast<uint32_t>(size);
+    while (end - p >= 4) {
+        h += load_u32(p) * kXxPrime3;
+        h = std::rotl(h, 17) * kXxPrime4;
+        p += 4;
+    }
+    while (p < end) {
+        h += static_cast<uint32_t>(*p++) * kXxPrime5;
+        h = std::rotl(h, 11) * kXxPrime1;
+    }
+
+    h ^= h >> 15;
+    h *= kXxPrime2;
+    h ^= h >> 13;
+    h *= kXxPrime3;
+    h ^= h >> 16;
+    return h;
+}
+
+uint32_t compute_checksum(ChecksumKind kind, const void* data, size_t size) {
+    switch (kind) {
+        case ChecksumKind::Crc32: return crc32(data, size);
+        case ChecksumKind::Crc32c: return crc32c(data, size);
+        case ChecksumKind::XxHash32: return xxhash32(data, size);
+    }
+    return 0;
+}
+
+const char* checksum_kind_name(ChecksumKind kind) {
+    switch (kind) {
+        case ChecksumKind::Crc32: return "crc32";
+        case ChecksumKind::Crc32c: return "crc32c";
+        case ChecksumKind::XxHash32: return "xxhash32";
+    }
+    return "unknown";
+}
+
+namespace detail {
+
+uint32_t crc32_portable(const void* data, size_t size, uint32_t crc) {
+    if (!data || size == 0) return crc;
+    return ~crc32_sw(~crc, static_cast<const uint8_t*>(data), size);
+}
+
+uint32_t crc32c_portable(const void* data, size_t size, uint32_t crc) {
+    if (!data || size == 0) return crc;
+    return ~crc32c_sw(~crc, static_cast<const uint8_t*>(data), size);
+}
+
+} // namespace detail
+
+} // namespace argentum::core
@@ -0,0 +1,89 @@
+#include "core/cpu_features.hpp"
+
+#include <cstdint>
+
+#if defined(ARGENTUM_X86)
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace argentum::core {
+
+namespace {
+
+#if defined(ARGENTUM_X86)
+
+void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#if defined(_MSC_VER)
+    int out[4];
+    __cpuidex(out, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i) regs[i] = static_cast<uint32_t>(out[i]);
+#else
+    if (!__get_cpuid_count(leaf, subleaf, &regs[0], &regs[1], &regs[2], &regs[3])) {
+        regs[0] = regs[1] = regs[2] = regs[3] = 0;
+    }
+#endif
+}
+
+uint64_t read_xcr0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo = 0;
+    uint32_t hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#endif
+}
+
+CpuFeatures probe() {
+    CpuFeatures f;
+    uint32_t regs[4] = {};
+    cpuid(0, 0, regs);
+    const uint32_t max_leaf = regs[0];
+    if (max_leaf < 1) return f;
+
+    cpuid(1, 0, regs);
+    const uint32_t ecx1 = regs[2];
+    f.sse42 = (ecx1 >> 20) & 1U;
+    f.pclmul = (ecx1 >> 1) & 1U;
+    const bool fma_bit = (ecx1 >> 12) & 1U;
+
+    const bool osxsave = (ecx1 >> 27) & 1U;
+    const uint64_t xcr0 = osxsave ? read_xcr0() : 0;
+    const bool ymm_saved = (xcr0 & 0x6U) == 0x6U;   // SSE + AVX state
+    const bool zmm_saved = (xcr0 & 0xE6U) == 0xE6U; // + opmask, ZMM_Hi256, Hi16_ZMM
+    f.fma = ymm_saved && fma_bit;
+
+    if (max_leaf >= 7) {
+        cpuid(7, 0, regs);
+        const uint32_t ebx7 = regs[1];
+        f.bmi2 = (ebx7 >> 8) & 1U;
+        f.avx2 = ymm_saved && ((ebx7 >> 5) & 1U);
+        f.avx512f = zmm_saved && ((ebx7 >> 16) & 1U);
+        f.avx512bw = f.avx512f && ((ebx7 >> 30) & 1U);
+        f.avx512dq = f.avx512f && ((ebx7 >> 17) & 1U);
+    }
+    return f;
+}
+
+#else
+
+CpuFeatures probe() {
+    return CpuFeatures{};
+}
+
+#endif
+
+} // namespace
+
+const CpuFeatures& cpu_features() {
+    static const CpuFeatures features = probe();
+    return features;
+}
+
+} // namespace argentum::core
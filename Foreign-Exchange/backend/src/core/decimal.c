@@ -0,0 +1,127 @@
+#include "core/decimal.h"
+
+#define DECIMAL_EXPONENT_LIMIT 100000
+
+static const uint64_t kPow10[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+    1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+    100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL};
+
+static int is_digit(char c) {
+    return (unsigned)(c - '0') < 10;
+}
+
+/* mantissa * 10^shift rounded half away from zero; mantissa has at most 18 digits. */
+static ArgentumStatus scale_small(uint64_t mantissa, int shift, uint64_t* out) {
+    if (mantissa == 0) {
+        *out = 0;
+    } else if (shift >= 0) {
+        if (shift > 18 || mantissa > (uint64_t)INT64_MAX / kPow10[shift]) return ARGENTUM_ERR_RANGE;
+        *out = mantissa * kPow10[shift];
+    } else if (shift >= -19) {
+        const uint64_t div = kPow10[-shift];
+        *out = mantissa / div + ((mantissa % div) >= div / 2 ? 1 : 0);
+    } else {
+        *out = 0;
+    }
+    return ARGENTUM_OK;
+}
+
+/*
+ * Long inputs: walk the digits once more, keeping those at or above the scale
+ * with overflow checks and rounding on the first digit below it.
+ */
+static ArgentumStatus scale_long(const char* int_begin,
+                                 size_t n_int,
+                                 const char* frac_begin,
+                                 size_t n_frac,
+                                 int shift,
+                                 uint64_t* out) {
+    const size_t n_total = n_int + n_frac;
+    uint64_t acc = 0;
+    long weight = 0; /* power of ten of the digit just consumed, after scaling */
+    int round_up = 0;
+    for (size_t i = 0; i < n_total; ++i) {
+        const char c = (i < n_int) ? int_begin[i] : frac_begin[i - n_int];
+        weight = (long)n_int - 1 - (long)i + shift;
+        if (weight < 0) {
+            round_up = (weight == -1 && c >= '5');
+            break;
+        }
+        const uint64_t digit = (uint64_t)(c - '0');
+        if (acc > ((uint64_t)INT64_MAX - digit) / 10) return ARGENTUM_ERR_RANGE;
+        acc = acc * 10 + digit;
+    }
+    if (weight > 0 && acc != 0) {
+        /* digits ran out above the scale: pad with zeros */
+        if (weight > 18 || acc > (uint64_t)INT64_MAX / kPow10[weight]) return ARGENTUM_ERR_RANGE;
+        acc *= kPow10[weight];
+    }
+    if (round_up) {
+        if (acc == (uint64_t)INT64_MAX) return ARGENTUM_ERR_RANGE;
+        ++acc;
+    }
+    *out = acc;
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus decimal_parse_scaled(const char* first,
+                                    const char* last,
+                                    int scale_digits,
+                                    int64_t* out,
+                                    const char** out_end) {
+    if (!first || !last || !out || first >= last) return ARGENTUM_ERR_PARSE;
+
+    const char* p = first;
+    int negative = 0;
+    if (*p == '-' || *p == '+') negative = (*p++ == '-');
+
+    const char* int_begin = p;
+    while (p < last && is_digit(*p)) ++p;
+    const size_t n_int = (size_t)(p - int_begin);
+
+    const char* frac_begin = p;
+    size_t n_frac = 0;
+    if (p < last && *p == '.') {
+        frac_begin = ++p;
+        while (p < last && is_digit(*p)) ++p;
+        n_frac = (size_t)(p - frac_begin);
+    }
+    if (n_int + n_frac == 0) return ARGENTUM_ERR_PARSE;
+
+    long exponent = 0;
+    if (p < last && (*p == 'e' || *p == 'E')) {
+        const char* q = p + 1;
+        int exp_negative = 0;
+        if (q < last && (*q == '-' || *q == '+')) exp_negative = (*q++ == '-');
+        if (q < last && is_digit(*q)) {
+            for (; q < last && is_digit(*q); ++q) {
+                if (exponent < DECIMAL_EXPONENT_LIMIT) exponent = exponent * 10 + (*q - '0');
+            }
+            exponent = exp_negative ? -exponent : exponent;
+            p = q;
+        }
+    }
+
+    const long shift = exponent + scale_digits;
+    uint64_t magnitude = 0;
+    ArgentumStatus status;
+    if (n_int + n_frac <= 18) {
+        /* Fast path: the digits fit a uint64 exactly. */
+        uint64_t mantissa = 0;
+        for (size_t i = 0; i < n_int; ++i) mantissa = mantissa * 10 + (uint64_t)(int_begin[i] - '0');
+        for (size_t i = 0; i < n_frac; ++i) mantissa = mantissa * 10 + (uint64_t)(frac_begin[i] - '0');
+        const long net = shift - (long)n_frac;
+        status = scale_small(mantissa, net < -20 ? -20 : (net > 19 ? 19 : (int)net), &magnitude);
+    } else {
+        const long clamped = shift < -DECIMAL_EXPONENT_LIMIT ? -DECIMAL_EXPONENT_LIMIT
+                             : (shift > DECIMAL_EXPONENT_LIMIT ? DECIMAL_EXPONENT_LIMIT : shift);
+        status = scale_long(int_begin, n_int, frac_begin, n_frac, (int)clamped, &magnitude);
+    }
+    if (status != ARGENTUM_OK) return status;
+
+    *out = negative ? -(int64_t)magnitude : (int64_t)magnitude;
+    if (out_end) *out_end = p;
+    return ARGENTUM_OK;
+}
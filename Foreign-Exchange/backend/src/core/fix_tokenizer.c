@@ -0,0 +1,60 @@
+#include "core/fix_tokenizer.h"
+
+#include <string.h>
+
+char fix_detect_delimiter(const char* data, size_t len) {
+    return (data && len && memchr(data, '|', len) != NULL) ? '|' : FIX_SOH;
+}
+
+int fix_next_field(const char* data, size_t len, char delimiter, size_t* cursor, FixField* out) {
+    if (!data || !cursor || !out) return 0;
+
+    size_t pos = *cursor;
+    while (pos < len) {
+        /* memchr is the vectorized delimiter search on every libc we build against. */
+        const char* stop = (const char*)memchr(data + pos, delimiter, len - pos);
+        const size_t end = stop ? (size_t)(stop - data) : len;
+        const size_t begin = pos;
+        pos = stop ? end + 1 : len;
+
+        uint32_t tag = 0;
+        size_t i = begin;
+        for (; i < end && (unsigned)(data[i] - '0') < 10; ++i) {
+            if (tag > (UINT32_MAX - 9) / 10) break;
+            tag = tag * 10 + (uint32_t)(data[i] - '0');
+        }
+        if (i == begin || i >= end || data[i] != '=' || tag == 0) continue;
+
+        out->tag = tag;
+        out->offset = (uint32_t)(i + 1);
+        out->length = (uint32_t)(end - (i + 1));
+        *cursor = pos;
+        return 1;
+    }
+    *cursor = len;
+    return 0;
+}
+
+size_t fix_scan_tags(const char* data,
+                     size_t len,
+                     char delimiter,
+                     const uint32_t* tags,
+                     size_t tag_count,
+                     FixField* out) {
+    if (!tags || !out) return 0;
+    memset(out, 0, tag_count * sizeof(*out));
+
+    size_t found = 0;
+    size_t cursor = 0;
+    FixField field;
+    while (found < tag_count && fix_next_field(data, len, delimiter, &cursor, &field)) {
+        for (size_t i = 0; i < tag_count; ++i) {
+            if (tags[i] == field.tag && out[i].tag == 0) {
+                out[i] = field;
+                ++found;
+                break;
+            }
+        }
+    }
+    return found;
+}
@@ -0,0 +1,203 @@
+#include "core/fixed_point.hpp"
+
+#include "core/cpu_features.hpp"
+
+#include <algorithm>
+
+#if defined(ARGENTUM_X86)
+#include <immintrin.h>
+#endif
+
+namespace argentum::core {
+
+namespace {
+
+using RoundKernel = void (*)(const double*, size_t, int64_t, int64_t*);
+using ToDoubleKernel = void (*)(const int64_t*, size_t, int64_t, double*);
+
+// Vector lanes are converted exactly only below 2^51 units (the magic-number
+// int64 <-> double tricks); anything else is handed to the scalar functions.
+constexpr double kTwo51 = 2251799813685248.0;
+constexpr int64_t kVectorIntLimit = int64_t{1} << 51;
+
+void round_scalar(const double* in, size_t n, int64_t scale, int64_t* out) {
+    for (size_t i = 0; i < n; ++i) out[i] = round_to_i64(in[i], scale);
+}
+
+void to_double_scalar(const int64_t* in, size_t n, int64_t scale, double* out) {
+    for (size_t i = 0; i < n; ++i) out[i] = to_double(in[i], scale);
+}
+
+#if defined(ARGENTUM_X86)
+
+ARGENTUM_TARGET("avx2,fma")
+void round_avx2(const double* in, size_t n, int64_t scale, int64_t* out) {
+    const __m256d scale_v = _mm256_set1_pd(static_cast<double>(scale));
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d half = _mm256_set1_pd(0.5);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d limit = _mm256_set1_pd(kTwo51);
+    const __m256d magic = _mm256_set1_pd(detail::kTwo52);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d value = _mm256_loadu_pd(in + i);
+        const __m256d magnitude = _mm256_andnot_pd(sign_bit, value);
+        const __m256d product = _mm256_mul_pd(magnitude, scale_v);
+        // NaN compares false, so non-finite input also leaves the vector path.
+        if (_mm256_movemask_pd(_mm256_cmp_pd(product, limit, _CMP_LT_OQ)) != 0xF) {
+            round_scalar(in + i, 4, scale, out + i);
+            continue;
+        }
+        const __m256d residual = _mm256_fmsub_pd(magnitude, scale_v, product);
+        const __m256d whole = _mm256_floor_pd(product);
+        const __m256d above_half = _mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(product, whole), half), residual);
+        const __m256d rounded =
+            _mm256_add_pd(whole, _mm256_and_pd(_mm256_cmp_pd(above_half, zero, _CMP_GE_OQ), one));
+
+        const __m256i bits = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(rounded, magic)),
+                                              _mm256_castpd_si256(magic));
+        const __m256i negative = _mm256_castpd_si256(_mm256_cmp_pd(value, zero, _CMP_LT_OQ));
+        const __m256i result = _mm256_sub_epi64(_mm256_xor_si256(bits, negative), negative);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+    }
+    round_scalar(in + i, n - i, scale, out + i);
+}
+
+ARGENTUM_TARGET("avx2")
+void to_double_avx2(const int64_t* in, size_t n, int64_t scale, double* out) {
+    const __m256d scale_v = _mm256_set1_pd(static_cast<double>(scale));
+    // 2^52 + 2^51: adding a signed int below 2^51 lands it in this double's mantissa.
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+    const __m256i low = _mm256_set1_epi64x(-kVectorIntLimit);
+    const __m256i high = _mm256_set1_epi64x(kVectorIntLimit);
+
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(value, high), _mm256_cmpgt_epi64(low, value));
+        if (!_mm256_testz_si256(outside, outside)) {
+            to_double_scalar(in + i, 4, scale, out + i);
+            continue;
+        }
+        const __m256d as_double = _mm256_sub_pd(
+            _mm256_castsi256_pd(_mm256_add_epi64(value, _mm256_castpd_si256(magic))), magic);
+        _mm256_storeu_pd(out + i, _mm256_div_pd(as_double, scale_v));
+    }
+    to_double_scalar(in + i, n - i, scale, out + i);
+}
+
+ARGENTUM_TARGET("avx512f,avx512dq")
+void round_avx512(const double* in, size_t n, int64_t scale, int64_t* out) {
+    const __m512d scale_v = _mm512_set1_pd(static_cast<double>(scale));
+    const __m512d zero = _mm512_setzero_pd();
+    const __m512d half = _mm512_set1_pd(0.5);
+    const __m512d one = _mm512_set1_pd(1.0);
+    const __m512d limit = _mm512_set1_pd(kTwo51);
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        const __m512d value = _mm512_loadu_pd(in + i);
+        const __m512d magnitude = _mm512_abs_pd(value);
+        const __m512d product = _mm512_mul_pd(magnitude, scale_v);
+        if (_mm512_cmp_pd_mask(product, limit, _CMP_LT_OQ) != 0xFF) {
+            round_scalar(in + i, 8, scale, out + i);
+            continue;
+        }
+        const __m512d residual = _mm512_fmsub_pd(magnitude, scale_v, product);
+        // Masked form: the unmasked intrinsic trips GCC's maybe-uninitialized on its undefined source.
+        const __m512d whole =
+            _mm512_mask_roundscale_pd(product, 0xFF, product, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        const __m512d above_half = _mm512_add_pd(_mm512_sub_pd(_mm512_sub_pd(product, whole), half), residual);
+        const __m512d rounded =
+            _mm512_mask_add_pd(whole, _mm512_cmp_pd_mask(above_half, zero, _CMP_GE_OQ), whole, one);
+
+        const __m512i magnitude_i = _mm512_cvttpd_epi64(rounded);
+        const __mmask8 negative = _mm512_cmp_pd_mask(value, zero, _CMP_LT_OQ);
+        const __m512i result = _mm512_mask_sub_epi64(magnitude_i, negative, _mm512_setzero_si512(), magnitude_i);
+        _mm512_storeu_si512(out + i, result);
+    }
+    round_scalar(in + i, n - i, scale, out + i);
+}
+
+ARGENTUM_TARGET("avx512f,avx512dq")
+void to_double_avx512(const int64_t* in, size_t n, int64_t scale, double* out) {
+    const __m512d scale_v = _mm512_set1_pd(static_cast<double>(scale));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        // cvtqq2pd rounds to nearest like the scalar int64 -> double conversion, so no range check.
+        const __m512d as_double = _mm512_cvtepi64_pd(_mm512_loadu_si512(in + i));
+        _mm512_storeu_pd(out + i, _mm512_div_pd(as_double, scale_v));
+    }
+    to_double_scalar(in + i, n - i, scale, out + i);
+}
+
+#endif
+
+bool kernel_supported(detail::FixedPointKernel kernel) {
+#if defined(ARGENTUM_X86)
+    const CpuFeatures& cpu = cpu_features();
+    switch (kernel) {
+        case detail::FixedPointKernel::Avx512:
+            return cpu.avx512f && cpu.avx512dq;
+        case detail::FixedPointKernel::Avx2:
+            return cpu.avx2 && cpu.fma;
+        case detail::FixedPointKernel::Scalar:
+            return true;
+    }
+    return false;
+#else
+    return kernel == detail::FixedPointKernel::Scalar;
+#endif
+}
+
+RoundKernel round_kernel(detail::FixedPointKernel kernel) {
+    if (!kernel_supported(kernel)) return round_scalar;
+#if defined(ARGENTUM_X86)
+    if (kernel == detail::FixedPointKernel::Avx512) return round_avx512;
+    if (kernel == detail::FixedPointKernel::Avx2) return round_avx2;
+#endif
+    return round_scalar;
+}
+
+ToDoubleKernel to_double_kernel(detail::FixedPointKernel kernel) {
+    if (!kernel_supported(kernel)) return to_double_scalar;
+#if defined(ARGENTUM_X86)
+    if (kernel == detail::FixedPointKernel::Avx512) return to_double_avx512;
+    if (kernel == detail::FixedPointKernel::Avx2) return to_double_avx2;
+#endif
+    return to_double_scalar;
+}
+
+detail::FixedPointKernel best_kernel() {
+    if (kernel_supported(detail::FixedPointKernel::Avx512)) return detail::FixedPointKernel::Avx512;
+    if (kernel_supported(detail::FixedPointKernel::Avx2)) return detail::FixedPointKernel::Avx2;
+    return detail::FixedPointKernel::Scalar;
+}
+
+} // namespace
+
+void round_to_i64_batch(std::span<const double> in, int64_t scale, std::span<int64_t> out) {
+    static const RoundKernel kernel = round_kernel(best_kernel());
+    kernel(in.data(), std::min(in.size(), out.size()), scale, out.data());
+}
+
+void to_double_batch(std::span<const int64_t> in, int64_t scale, std::span<double> out) {
+    static const ToDoubleKernel kernel = to_double_kernel(best_kernel());
+    kernel(in.data(), std::min(in.size(), out.size()), scale, out.data());
+}
+
+namespace detail {
+
+void round_to_i64_batch_with(FixedPointKernel kernel, std::span<const double> in, int64_t scale, std::span<int64_t> out) {
+    round_kernel(kernel)(in.data(), std::min(in.size(), out.size()), scale, out.data());
+}
+
+void to_double_batch_with(FixedPointKernel kernel, std::span<const int64_t> in, int64_t scale, std::span<double> out) {
+    to_double_kernel(kernel)(in.data(), std::min(in.size(), out.size()), scale, out.data());
+}
+
+} // namespace detail
+
+} // namespace argentum::core
@@ -0,0 +1,52 @@
+#include "core/instrument_registry.hpp"
+
+#include <cstring>
+#include <mutex>
+
+namespace argentum::core {
+
+InstrumentRegistry::InstrumentRegistry(size_t capacity) : entries_(capacity) {}
+
+uint32_t InstrumentRegistry::intern(std::string_view name) {
+    if (name.empty() || name.size() > kMaxNameLength) return kInvalidId;
+    if (const uint32_t id = find(name); id != kInvalidId) return id;
+
+    std::unique_lock lock(mutex_);
+    if (auto it = ids_.find(name); it != ids_.end()) return it->second;
+
+    const uint32_t index = count_.load(std::memory_order_relaxed);
+    if (index >= entries_.size()) return kInvalidId;
+
+    Entry& entry = entries_[index];
+    std::memcpy(entry.name, name.data(), name.size());
+    entry.name[name.size()] = '\0';
+    const uint32_t id = index + 1;
+    ids_.emplace(std::string(name), id);
+    // Publishes the entry to lock-free name() readers.
+    count_.store(index + 1, std::memory_order_release);
+    return id;
+}
+
+uint32_t InstrumentRegistry::find(std::string_view name) const {
+    std::shared_lock lock(mutex_);
+    auto it = ids_.find(name);
+    return it == ids_.end() ? kInvalidId : it->second;
+}
+
+std::string_view InstrumentRegistry::name(uint32_t id) const {
+    if (id == kInvalidId || id > count_.load(std::memory_order_acquire)) return {};
+    const Entry& entry = entries_[id - 1];
+    return std::string_view(entry.name);
+}
+
+InstrumentRegistry& instrument_registry() {
+    static InstrumentRegistry registry;
+    return registry;
+}
+
+InstrumentRegistry& venue_registry() {
+    static InstrumentRegistry registry(1024);
+    return registry;
+}
+
+} // namespace argentum::core
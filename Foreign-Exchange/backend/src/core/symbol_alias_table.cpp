@@ -0,0 +1,171 @@
+#include "core/symbol_alias_table.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstring>
+#include <string>
+
+namespace argentum::core {
+
+namespace {
+
+constexpr uint64_t kMul1 = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t kMul2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint32_t kMaxDisplacement = 1U << 16;
+constexpr int kMaxSeedAttempts = 16;
+
+uint64_t fmix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xFF51AFD7ED558CCDULL;
+    k ^= k >> 33;
+    k *= 0xC4CEB9FE1A85EC53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+} // namespace
+
+SymbolAliasTable::SymbolAliasTable(InstrumentRegistry& registry) : registry_(registry) {}
+
+bool SymbolAliasTable::make_key(std::string_view raw, Key* out) {
+    if (raw.empty() || raw.size() > kMaxSpellingLength) return false;
+    if (raw.find('\0') != std::string_view::npos) return false;
+    unsigned char bytes[16] = {};
+    std::memcpy(bytes, raw.data(), raw.size());
+    std::memcpy(&out->lo, bytes, 8);
+    std::memcpy(&out->hi, bytes + 8, 8);
+    return true;
+}
+
+uint64_t SymbolAliasTable::hash(const Key& key, uint64_t seed) {
+    return fmix64((key.lo * kMul1) ^ std::rotl(key.hi * kMul2, 31) ^ seed);
+}
+
+uint64_t SymbolAliasTable::slot_hash(uint64_t h, uint32_t displacement) {
+    return fmix64(h + displacement * kMul2);
+}
+
+uint32_t SymbolAliasTable::add_instrument(std::string_view canonical) {
+    const uint32_t id = registry_.intern(canonical);
+    if (id == InstrumentRegistry::kInvalidId) return id;
+
+    const size_t slash = canonical.find('/');
+    const std::string_view base = canonical.substr(0, slash);
+    const std::string_view quote = slash == std::string_view::npos ? std::string_view{} : canonical.substr(slash + 1);
+
+    static constexpr std::string_view kSeparators[] = {"", "/", "-", "_", ".", " "};
+    for (std::string_view sep : kSeparators) {
+        if (quote.empty() && !sep.empty()) continue;
+        std::string upper;
+        upper.append(base).append(sep).append(quote);
+        std::string lower = upper;
+        for (char& c : upper) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        for (char& c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        Key key;
+        if (make_key(upper, &key)) pending_.emplace_back(key, id);
+        if (make_key(lower, &key)) pending_.emplace_back(key, id);
+    }
+    return id;
+}
+
+bool SymbolAliasTable::add_alias(std::string_view raw, std::string_view canonical) {
+    Key key;
+    if (!make_key(raw, &key)) return false;
+    const uint32_t id = registry_.intern(canonical);
+    if (id == InstrumentRegistry::kInvalidId) return false;
+    pending_.emplace_back(key, id);
+    return true;
+}
+
+bool SymbolAliasTable::build() {
+    std::vector<std::pair<Key, uint32_t>> keys = pending_;
+    std::sort(keys.begin(), keys.end(), [](const auto& a, const auto& b) {
+        return a.first.lo != b.first.lo ? a.first.lo < b.first.lo : a.first.hi < b.first.hi;
+    });
+    for (size_t i = 1; i < keys.size(); ++i) {
+        if (keys[i].first == keys[i - 1].first && keys[i].second != keys[i - 1].second) return false;
+    }
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    for (int attempt = 0; attempt < kMaxSeedAttempts; ++attempt) {
+        if (try_build(fmix64(kMul1 + static_cast<uint64_t>(attempt)), keys)) return true;
+    }
+    return false;
+}
+
+bool SymbolAliasTable::try_build(uint64_t seed, const std::vector<std::pair<Key, uint32_t>>& keys) {
+    // Load factor <= 1/2 in the slots, ~4 keys per displacement bucket.
+    const size_t slot_count = std::bit_ceil(std::max<size_t>(keys.size() * 2, 8));
+    const size_t bucket_count = std::bit_ceil(std::max<size_t>(keys.size() / 4, 1));
+    const uint32_t bucket_bits = static_cast<uint32_t>(std::countr_zero(bucket_count));
+    const uint32_t bucket_shift = 64 - std::max<uint32_t>(bucket_bits, 1);
+    const uint64_t slot_mask = slot_count - 1;
+
+    std::vector<uint64_t> hashes(keys.size());
+    std::vector<std::vector<uint32_t>> buckets(size_t{1} << (64 - bucket_shift));
+    for (size_t i = 0; i < keys.size(); ++i) {
+        hashes[i] = hash(keys[i].first, seed);
+        buckets[hashes[i] >> bucket_shift].push_back(static_cast<uint32_t>(i));
+    }
+
+    std::vector<uint32_t> order(buckets.size());
+    for (uint32_t b = 0; b < order.size(); ++b) order[b] = b;
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<Slot> slots(slot_count);
+    std::vector<uint8_t> taken(slot_count, 0);
+    std::vector<uint32_t> displacements(buckets.size(), 0);
+    std::vector<uint64_t> trial;
+    for (uint32_t b : order) {
+        const auto& members = buckets[b];
+        if (members.empty()) break;
+
+        bool placed = false;
+        for (uint32_t d = 0; d < kMaxDisplacement && !placed; ++d) {
+            trial.clear();
+            placed = true;
+            for (uint32_t i : members) {
+                const uint64_t s = slot_hash(hashes[i], d) & slot_mask;
+                if (taken[s] || std::find(trial.begin(), trial.end(), s) != trial.end()) {
+                    placed = false;
+                    break;
+                }
+                trial.push_back(s);
+            }
+            if (placed) {
+                displacements[b] = d;
+                for (size_t k = 0; k < members.size(); ++k) {
+                    taken[trial[k]] = 1;
+                    slots[trial[k]] = Slot{keys[members[k]].first, keys[members[k]].second};
+                }
+            }
+        }
+        if (!placed) return false;
+    }
+
+    seed_ = seed;
+    bucket_shift_ = bucket_shift;
+    slot_mask_ = slot_mask;
+    displacements_ = std::move(displacements);
+    slots_ = std::move(slots);
+    built_count_ = keys.size();
+    return true;
+}
+
+uint32_t SymbolAliasTable::find(std::string_view raw) const {
+    Key key;
+    if (slots_.empty() || !make_key(raw, &key)) return InstrumentRegistry::kInvalidId;
+    const uint64_t h = hash(key, seed_);
+    const Slot& slot = slots_[slot_hash(h, displacements_[h >> bucket_shift_]) & slot_mask_];
+    return slot.key == key ? slot.id : InstrumentRegistry::kInvalidId;
+}
+
+SymbolAliasTable& symbol_aliases() {
+    static SymbolAliasTable table(instrument_registry());
+    return table;
+}
+
+} // namespace argentum::core
@@ -1,14 +1,20 @@
 #include "datafeed/feed_player.hpp"
-#include "codec/market_tick_codec.hpp"
 
+#include "core/mapped_file.hpp"
+
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 namespace argentum::datafeed {
 
 FeedPlayer::FeedPlayer(std::shared_ptr<bus::MessageBus> bus, std::string topic)
-    : bus_(std::move(bus)), topic_(std::move(topic)) {}
+    : ticks_(std::move(bus), std::move(topic)) {}
 
 static size_t trim_line(char* line, size_t len) {
     while (len > 0) {
@@ -24,7 +30,7 @@ static size_t trim_line(char* line, size_t len) {
 }
 
 size_t FeedPlayer::play_file(const std::string& path, FeedFormat format, uint32_t throttle_us) {
-    if (!bus_) return 0;
+    if (!ticks_.bus()) return 0;
 
     std::ifstream file(path);
     if (!file.is_open()) return 0;
@@ -45,17 +51,8 @@ size_t FeedPlayer::play_file(const std::string& path, FeedFormat format, uint32_
 
         MarketTick tick{};
         if (parse_market_message(format, line.data(), len, &tick) == ARGENTUM_OK) {
-            std::vector<uint8_t> payload;
-            ArgentumStatus status = ARGENTUM_ERR_INVALID;
-#ifdef ARGENTUM_USE_FLATBUFFERS
-            status = codec::encode_market_tick_flatbuffers(tick, &payload, false);
-#else
-            status = codec::encode_market_tick_legacy(tick, &payload);
-#endif
-            if (status == ARGENTUM_OK) {
-                if (bus_->publish(topic_, payload.data(), payload.size()) == ARGENTUM_OK) {
-                    ++published;
-                }
+            if (ticks_.publish(tick) == ARGENTUM_OK) {
+                ++published;
             }
         }
 
@@ -69,4 +66,195 @@ size_t FeedPlayer::play_file(const std::string& path, FeedFormat format, uint32_
     return published;
 }
 
+namespace {
+
+struct ChunkRange {
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+// Splits [0, size) into pieces of about `target` bytes, each ending just after a '\n'
+// (or at end of file).
+std::vector<ChunkRange> split_at_newlines(const char* data, size_t size, size_t target) {
+    std::vector<ChunkRange> chunks;
+    chunks.reserve(size / target + 1);
+    size_t begin = 0;
+    while (begin < size) {
+        size_t end = size;
+        if (size - begin > target) {
+            const void* nl = std::memchr(data + begin + target, '\n', size - begin - target);
+            end = nl ? static_cast<size_t>(static_cast<const char*>(nl) - data) + 1 : size;
+        }
+        chunks.push_back({begin, end});
+        begin = end;
+    }
+    return chunks;
+}
+
+// Advances *p past the next line of [*p, end) that parses into `tick` (and its feed
+// sequence, if `seq` is set); CR/LF are trimmed, blank lines skipped. False at end of input.
+bool next_tick(const char** p, const char* end, FeedFormat format, MarketTick* tick, uint64_t* seq) {
+    while (*p < end) {
+        const char* line = *p;
+        const char* nl = static_cast<const char*>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+        const char* line_end = nl ? nl : end;
+        *p = nl ? nl + 1 : end;
+        size_t len = static_cast<size_t>(line_end - line);
+        while (len > 0 && (line[len - 1] == '\r' || line[len - 1] == '\n')) --len;
+        if (len > 0 && parse_market_message_seq(format, line, len, tick, seq) == ARGENTUM_OK) return true;
+    }
+    return false;
+}
+
+// Calls fn(tick) for every line in [p, end) that parses.
+template <typename Fn>
+void for_each_tick(const char* p, const char* end, FeedFormat format, Fn&& fn) {
+    MarketTick tick{};
+    while (next_tick(&p, end, format, &tick, nullptr)) fn(tick);
+}
+
+void parse_chunk(const char* p, const char* end, FeedFormat format, std::vector<MarketTick>* out) {
+    out->clear();
+    for_each_tick(p, end, format, [out](const MarketTick& tick) { out->push_back(tick); });
+}
+
+// One reorder-window entry; `ticks` is reused across the chunks that map to this slot.
+struct ChunkSlot {
+    std::vector<MarketTick> ticks;
+    bool ready = false;
+};
+
+} // namespace
+
+size_t FeedPlayer::play_file_paced(const std::string& path, FeedFormat format, ReplayClock* clock) {
+    if (!ticks_.bus() || !clock) return 0;
+
+    core::MappedFile file;
+    if (!file.open(path) || file.size() == 0) return 0;
+
+    clock->rearm();
+    size_t published = 0;
+    for_each_tick(file.data(), file.data() + file.size(), format, [&](const MarketTick& tick) {
+        clock->wait_for_event(tick.timestamp_ns);
+        if (ticks_.publish(tick) == ARGENTUM_OK) ++published;
+    });
+    return published;
+}
+
+size_t FeedPlayer::play_arbitrated(const std::string& path_a,
+                                   const std::string& path_b,
+                                   FeedFormat format,
+                                   LineArbitrator* arbitrator) {
+    if (!ticks_.bus() || !arbitrator) return 0;
+
+    struct LineCursor {
+        core::MappedFile file;
+        const char* p = nullptr;
+        const char* end = nullptr;
+        MarketTick tick{};
+        uint64_t seq = 0;
+        bool live = false;
+
+        void advance(FeedFormat fmt) {
+            // Unsequenced lines cannot be arbitrated and are skipped.
+            do {
+                live = next_tick(&p, end, fmt, &tick, &seq);
+            } while (live && seq == 0);
+        }
+    };
+
+    LineCursor lines[2];
+    const std::string* paths[2] = {&path_a, &path_b};
+    for (size_t i = 0; i < 2; ++i) {
+        // A missing or empty capture is a dead line; the other one carries the feed.
+        if (!lines[i].file.open(*paths[i]) || lines[i].file.size() == 0) continue;
+        lines[i].p = lines[i].file.data();
+        lines[i].end = lines[i].file.data() + lines[i].file.size();
+        lines[i].advance(format);
+    }
+
+    size_t published = 0;
+    while (lines[0].live || lines[1].live) {
+        // Merge the captures on their recorded timestamps to reproduce arrival order.
+        const bool take_a = !lines[1].live || (lines[0].live && lines[0].tick.timestamp_ns <= lines[1].tick.timestamp_ns);
+        const size_t pick = take_a ? 0 : 1;
+        LineCursor& line = lines[pick];
+        const ArbitrationResult result = arbitrator->on_message(static_cast<FeedLine>(pick), line.seq);
+        if (LineArbitrator::forward(result) && ticks_.publish(line.tick) == ARGENTUM_OK) ++published;
+        line.advance(format);
+    }
+    arbitrator->finish();
+    return published;
+}
+
+size_t FeedPlayer::play_file_parallel(const std::string& path, FeedFormat format, const ParallelPlayOptions& options) {
+    if (!ticks_.bus()) return 0;
+
+    core::MappedFile file;
+    if (!file.open(path) || file.size() == 0) return 0;
+
+    size_t workers = options.workers;
+    if (workers == 0) {
+        const unsigned hw = std::thread::hardware_concurrency();
+        workers = hw > 1 ? hw - 1 : 1;
+    }
+    const size_t window = options.max_chunks_in_flight > 0 ? options.max_chunks_in_flight : 4 * workers;
+    const std::vector<ChunkRange> chunks =
+        split_at_newlines(file.data(), file.size(), std::max<size_t>(options.chunk_bytes, 1));
+    workers = std::min(workers, chunks.size());
+
+    std::vector<ChunkSlot> slots(window);
+    std::mutex mutex;
+    std::condition_variable slot_ready;
+    std::condition_variable window_open;
+    size_t next_claim = 0;
+    size_t next_publish = 0;
+
+    auto worker = [&]() {
+        for (;;) {
+            size_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                // A slot is reusable once the publisher has drained the chunk `window` back.
+                window_open.wait(lock, [&] { return next_claim >= chunks.size() || next_claim < next_publish + window; });
+                if (next_claim >= chunks.size()) return;
+                index = next_claim++;
+            }
+            ChunkSlot& slot = slots[index % window];
+            const ChunkRange& range = chunks[index];
+            parse_chunk(file.data() + range.begin, file.data() + range.end, format, &slot.ticks);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.ready = true;
+            }
+            slot_ready.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) threads.emplace_back(worker);
+
+    size_t published = 0;
+    for (size_t index = 0; index < chunks.size(); ++index) {
+        ChunkSlot& slot = slots[index % window];
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            slot_ready.wait(lock, [&] { return slot.ready; });
+        }
+        for (const MarketTick& tick : slot.ticks) {
+            if (ticks_.publish(tick) == ARGENTUM_OK) ++published;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            slot.ready = false;
+            ++next_publish;
+        }
+        window_open.notify_all();
+    }
+
+    for (std::thread& thread : threads) thread.join();
+    return published;
+}
+
 } // namespace argentum::datafeed
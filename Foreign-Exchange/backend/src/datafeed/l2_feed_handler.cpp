@@ -0,0 +1,276 @@
+#include "datafeed/l2_feed_handler.hpp"
+
+#include "bus/wait_strategy.hpp"
+#include "core/instrument_registry.hpp"
+#include "core/symbol_alias_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace argentum::datafeed {
+
+L2Book::L2Book(uint32_t venue_id, uint32_t instrument_id)
+    : venue_id_(venue_id),
+      instrument_id_(instrument_id),
+      venue_name_(core::venue_registry().name(venue_id)),
+      symbol_(core::instrument_registry().name(instrument_id)) {}
+
+void L2Book::begin_write() {
+    version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void L2Book::end_write() {
+    version_.store(version_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+void L2Book::desync() {
+    begin_write();
+    state_.bid_depth = 0;
+    state_.ask_depth = 0;
+    state_.synced = false;
+    end_write();
+}
+
+bool L2Book::apply_level(State& state, const L2LevelUpdate& update, uint64_t* truncated) {
+    if (update.level == 0) return false;
+    gateway::QuoteLevel* levels = nullptr;
+    uint32_t* depth = nullptr;
+    bool* deeper = nullptr;
+    if (update.side == SIDE_BUY) {
+        levels = state.bids.data();
+        depth = &state.bid_depth;
+        deeper = &state.bid_deeper;
+    } else if (update.side == SIDE_SELL) {
+        levels = state.asks.data();
+        depth = &state.ask_depth;
+        deeper = &state.ask_deeper;
+    } else {
+        return false;
+    }
+
+    // Levels past kMaxDepth are not tracked, but their existence is remembered.
+    const size_t index = update.level - 1u;
+    if (index >= kMaxDepth) {
+        *deeper = true;
+        ++*truncated;
+        return true;
+    }
+
+    switch (update.action) {
+    case L2Action::New: {
+        if (index > *depth) return false;
+        if (*depth == kMaxDepth) *deeper = true; // the last held level is pushed out
+        const size_t kept = std::min<size_t>(*depth, kMaxDepth - 1);
+        std::memmove(levels + index + 1, levels + index, (kept - index) * sizeof(gateway::QuoteLevel));
+        levels[index] = gateway::QuoteLevel{update.price_ticks, update.size_lots};
+        *depth = static_cast<uint32_t>(kept + 1);
+        return true;
+    }
+    case L2Action::Change:
+        if (index >= *depth) return false;
+        levels[index] = gateway::QuoteLevel{update.price_ticks, update.size_lots};
+        return true;
+    case L2Action::Delete:
+        if (index >= *depth) return false;
+        std::memmove(levels + index, levels + index + 1, (*depth - index - 1) * sizeof(gateway::QuoteLevel));
+        --*depth;
+        // The venue moved its next level up into a slot this book never held.
+        if (*deeper) state.needs_snapshot = true;
+        return true;
+    }
+    return false;
+}
+
+L2ApplyResult L2Book::apply(uint32_t sequence, uint64_t timestamp_ns, std::span<const L2LevelUpdate> updates) {
+    if (!state_.synced) return L2ApplyResult::Stale;
+    if (sequence <= state_.sequence) return L2ApplyResult::Duplicate;
+    if (sequence != state_.sequence + 1) {
+        desync();
+        return L2ApplyResult::Gap;
+    }
+
+    begin_write();
+    bool valid = true;
+    for (const L2LevelUpdate& update : updates) {
+        if (!apply_level(state_, update, &truncated_updates_)) {
+            valid = false;
+            break;
+        }
+    }
+    state_.sequence = sequence;
+    state_.timestamp_ns = timestamp_ns;
+    if (!valid) {
+        state_.bid_depth = 0;
+        state_.ask_depth = 0;
+        state_.synced = false;
+    }
+    end_write();
+    return valid ? L2ApplyResult::Applied : L2ApplyResult::Invalid;
+}
+
+void L2Book::apply_snapshot(uint32_t sequence,
+                            uint64_t timestamp_ns,
+                            std::span<const gateway::QuoteLevel> bids,
+                            std::span<const gateway::QuoteLevel> asks) {
+    const size_t bid_depth = std::min(bids.size(), kMaxDepth);
+    const size_t ask_depth = std::min(asks.size(), kMaxDepth);
+    begin_write();
+    std::copy_n(bids.begin(), bid_depth, state_.bids.begin());
+    std::copy_n(asks.begin(), ask_depth, state_.asks.begin());
+    state_.bid_depth = static_cast<uint32_t>(bid_depth);
+    state_.ask_depth = static_cast<uint32_t>(ask_depth);
+    state_.bid_deeper = bids.size() > kMaxDepth;
+    state_.ask_deeper = asks.size() > kMaxDepth;
+    state_.needs_snapshot = false;
+    state_.sequence = sequence;
+    state_.timestamp_ns = timestamp_ns;
+    state_.synced = true;
+    end_write();
+}
+
+bool L2Book::snapshot_into(gateway::VenueOrderBookSnapshot* out, size_t max_depth) const {
+    if (!out) return false;
+
+    // Sequence-lock read: copy, then retry if the writer was active or moved on meanwhile.
+    State copy;
+    for (;;) {
+        const uint64_t before = version_.load(std::memory_order_acquire);
+        if (before & 1u) {
+            bus::cpu_relax();
+            continue;
+        }
+        std::memcpy(static_cast<void*>(&copy), &state_, sizeof(State));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (version_.load(std::memory_order_relaxed) == before) break;
+    }
+    if (!copy.synced) return false;
+
+    out->venue_id.assign(venue_name_);
+    out->symbol.assign(symbol_);
+    out->timestamp_ns = copy.timestamp_ns;
+    const size_t bid_depth = std::min<size_t>(copy.bid_depth, max_depth);
+    const size_t ask_depth = std::min<size_t>(copy.ask_depth, max_depth);
+    out->bid_levels.assign(copy.bids.begin(), copy.bids.begin() + bid_depth);
+    out->ask_levels.assign(copy.asks.begin(), copy.asks.begin() + ask_depth);
+    return true;
+}
+
+L2Book* L2FeedHandler::add_book(uint32_t venue_id, uint32_t instrument_id) {
+    if (instrument_id == core::InstrumentRegistry::kInvalidId) return nullptr;
+    const uint64_t key = book_key(venue_id, instrument_id);
+    const auto it = index_.find(key);
+    if (it != index_.end()) return it->second;
+    books_.push_back(std::make_unique<L2Book>(venue_id, instrument_id));
+    L2Book* book = books_.back().get();
+    index_.emplace(key, book);
+    return book;
+}
+
+L2Book* L2FeedHandler::find(uint32_t venue_id, uint32_t instrument_id) const {
+    const auto it = index_.find(book_key(venue_id, instrument_id));
+    return it == index_.end() ? nullptr : it->second;
+}
+
+L2ApplyResult L2FeedHandler::apply(uint32_t venue_id,
+                                   uint32_t instrument_id,
+                                   uint32_t sequence,
+                                   uint64_t timestamp_ns,
+                                   std::span<const L2LevelUpdate> updates) {
+    ++stats_.messages;
+    L2Book* book = find(venue_id, instrument_id);
+    if (!book) {
+        ++stats_.unknown_book;
+        return L2ApplyResult::UnknownBook;
+    }
+
+    const uint32_t expected = book->sequence() + 1;
+    const uint64_t truncated_before = book->truncated_updates();
+    const bool short_before = book->needs_snapshot();
+    const L2ApplyResult result = book->apply(sequence, timestamp_ns, updates);
+    stats_.truncated += book->truncated_updates() - truncated_before;
+    switch (result) {
+    case L2ApplyResult::Applied:
+        ++stats_.applied;
+        if (!short_before && book->needs_snapshot()) {
+            ++stats_.short_books;
+            if (gap_handler_) gap_handler_(*book, sequence, sequence);
+        }
+        break;
+    case L2ApplyResult::Duplicate:
+        ++stats_.duplicates;
+        break;
+    case L2ApplyResult::Stale:
+        ++stats_.stale;
+        break;
+    case L2ApplyResult::Gap:
+        ++stats_.gaps;
+        if (gap_handler_) gap_handler_(*book, expected, sequence);
+        break;
+    case L2ApplyResult::Invalid:
+        ++stats_.invalid;
+        if (gap_handler_) gap_handler_(*book, expected, sequence);
+        break;
+    case L2ApplyResult::UnknownBook:
+        break;
+    }
+    return result;
+}
+
+size_t L2FeedHandler::apply_sbe_events(uint32_t venue_id, std::span<const SbeMarketEvent> events) {
+    // A BookUpdate group holds at most 255 entries (uint8 num_in_group).
+    std::array<L2LevelUpdate, 255> updates;
+    size_t applied = 0;
+    size_t i = 0;
+    while (i < events.size()) {
+        const SbeMarketEvent& head = events[i];
+        if (head.template_id != SBE_TEMPLATE_BOOK_UPDATE) {
+            ++i;
+            continue;
+        }
+
+        size_t count = 0;
+        for (; i < events.size() && count < updates.size(); ++i, ++count) {
+            const SbeMarketEvent& ev = events[i];
+            if (ev.template_id != SBE_TEMPLATE_BOOK_UPDATE || ev.security_id != head.security_id ||
+                ev.rpt_seq != head.rpt_seq) {
+                break;
+            }
+            updates[count] = L2LevelUpdate{ev.price_ticks,
+                                           ev.quantity_lots,
+                                           ev.side,
+                                           static_cast<L2Action>(ev.update_action),
+                                           ev.price_level};
+        }
+
+        const std::string_view symbol(head.symbol);
+        uint32_t instrument_id = core::symbol_aliases().find(symbol);
+        if (instrument_id == core::InstrumentRegistry::kInvalidId) {
+            instrument_id = core::instrument_registry().find(symbol);
+        }
+        const L2ApplyResult result = apply(venue_id,
+                                           instrument_id,
+                                           head.rpt_seq,
+                                           head.transact_time_ns,
+                                           std::span<const L2LevelUpdate>(updates.data(), count));
+        if (result == L2ApplyResult::Applied) ++applied;
+    }
+    return applied;
+}
+
+size_t L2FeedHandler::collect_snapshots(uint32_t instrument_id,
+                                        std::vector<gateway::VenueOrderBookSnapshot>* out,
+                                        size_t max_depth) const {
+    if (!out) return 0;
+    size_t count = 0;
+    for (const auto& book : books_) {
+        if (book->instrument_id() != instrument_id) continue;
+        if (out->size() <= count) out->emplace_back();
+        if (book->snapshot_into(&(*out)[count], max_depth)) ++count;
+    }
+    out->resize(count);
+    return count;
+}
+
+} // namespace argentum::datafeed
@@ -0,0 +1,116 @@
+#include "datafeed/line_arbitrator.hpp"
+
+#include <algorithm>
+
+namespace argentum::datafeed {
+
+LineArbitrator::LineArbitrator(size_t window) {
+    size_t size = 64;
+    while (size < window) size <<= 1;
+    bits_.assign(size / 64, 0);
+    mask_ = size - 1;
+}
+
+ArbitrationResult LineArbitrator::on_message(FeedLine line, uint64_t seq) {
+    const size_t line_index = static_cast<size_t>(line) & 1u;
+    if (!started_) {
+        started_ = true;
+        first_ = seq;
+        highest_ = seq;
+        std::fill(bits_.begin(), bits_.end(), 0);
+        mark(seq);
+        ++stats_.accepted;
+        ++stats_.won[line_index];
+        return ArbitrationResult::Accepted;
+    }
+
+    if (seq > highest_) {
+        advance_to(seq);
+        mark(seq);
+        ++stats_.accepted;
+        ++stats_.won[line_index];
+        return ArbitrationResult::Accepted;
+    }
+
+    if (seq < first_ || highest_ - seq > mask_) {
+        ++stats_.stale;
+        return ArbitrationResult::Stale;
+    }
+    if (seen(seq)) {
+        ++stats_.duplicates;
+        return ArbitrationResult::Duplicate;
+    }
+    mark(seq);
+    ++stats_.recovered;
+    ++stats_.won[line_index];
+    return ArbitrationResult::Recovered;
+}
+
+// Slides the window so it ends at `seq`. Each sequence leaving the window that was
+// never delivered becomes part of a gap; slot bits of the entering sequences are cleared.
+void LineArbitrator::advance_to(uint64_t seq) {
+    const uint64_t window = mask_ + 1;
+    if (seq - highest_ < window) {
+        for (uint64_t q = highest_ + 1; q <= seq; ++q) {
+            // q's slot still holds q - window, which is leaving the window.
+            if (q - first_ >= window) {
+                if (!seen(q)) {
+                    report_lost(q - window, q - window);
+                } else if (gap_open_) {
+                    flush_gap();
+                }
+            }
+            clear(q);
+        }
+    } else {
+        const uint64_t oldest = highest_ - first_ > mask_ ? highest_ - mask_ : first_;
+        for (uint64_t q = oldest; q <= highest_; ++q) {
+            if (!seen(q)) {
+                report_lost(q, q);
+            } else if (gap_open_) {
+                flush_gap();
+            }
+        }
+        // Sequences jumped over that never enter the new window are lost outright.
+        const uint64_t entering = seq - mask_;
+        if (entering > highest_ + 1) report_lost(highest_ + 1, entering - 1);
+        std::fill(bits_.begin(), bits_.end(), 0);
+    }
+    highest_ = seq;
+}
+
+// Extends the pending gap when [first, last] continues it, otherwise reports it and starts a new one.
+void LineArbitrator::report_lost(uint64_t first, uint64_t last) {
+    if (gap_open_ && pending_gap_.last_seq + 1 != first) flush_gap();
+    if (!gap_open_) {
+        gap_open_ = true;
+        pending_gap_.first_seq = first;
+    }
+    pending_gap_.last_seq = last;
+    stats_.lost += last - first + 1;
+}
+
+void LineArbitrator::flush_gap() {
+    if (!gap_open_) return;
+    gap_open_ = false;
+    ++stats_.gaps;
+    if (gap_handler_) gap_handler_(pending_gap_);
+}
+
+void LineArbitrator::finish() {
+    if (started_) {
+        const uint64_t oldest = highest_ - first_ > mask_ ? highest_ - mask_ : first_;
+        for (uint64_t q = oldest; q <= highest_; ++q) {
+            if (!seen(q)) {
+                report_lost(q, q);
+            } else if (gap_open_) {
+                flush_gap();
+            }
+        }
+    }
+    flush_gap();
+    started_ = false;
+    highest_ = 0;
+}
+
+} // namespace argentum::datafeed
@@ -1,20 +1,110 @@
 #include "datafeed/market_parser.h"
 #include "datafeed/normalizer.h"
+#include "datafeed/sbe_decoder.h"
+#include "core/decimal.h"
+#include "core/fix_tokenizer.h"
 
-#include <ctype.h>
 #include <string.h>
-#include <stdlib.h>
 #include <stdint.h>
 
-static const char* find_key(const char* data, size_t len, const char* key) {
-    size_t key_len = strlen(key);
-    for (size_t i = 0; i + key_len + 2 < len; ++i) {
-        if (data[i] != '"') continue;
-        if (memcmp(&data[i + 1], key, key_len) == 0 && data[i + 1 + key_len] == '"') {
-            return &data[i + 1 + key_len + 1];
-        }
+#define TICK_SCALE_DIGITS 6 /* core::kPriceScaleDigits / kQuantityScaleDigits */
+
+/* ---- JSON: single pass over the line ------------------------------------------
+ * Members are visited once, in order. Keys are dispatched on a (length, first, last)
+ * signature and confirmed with memcmp; unknown values are skipped with SIMD scans
+ * for the next structural byte. Nested objects are walked with the same dispatch, so
+ * wrapped payloads ({"data":{...}}) keep working; the first occurrence of a key wins.
+ */
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ARGENTUM_JSON_SIMD_WIDTH 32
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ARGENTUM_JSON_SIMD_WIDTH 16
+#endif
+
+#if defined(_MSC_VER) && defined(ARGENTUM_JSON_SIMD_WIDTH)
+#include <intrin.h>
+static unsigned ctz32(uint32_t v) {
+    unsigned long idx;
+    _BitScanForward(&idx, v);
+    return (unsigned)idx;
+}
+#elif defined(ARGENTUM_JSON_SIMD_WIDTH)
+static unsigned ctz32(uint32_t v) {
+    return (unsigned)__builtin_ctz(v);
+}
+#endif
+
+#define JSON_MAX_DEPTH 8
+
+/* First of `a` or `b` in [p, end), or end. */
+static const char* scan_for2(const char* p, const char* end, char a, char b) {
+#if ARGENTUM_JSON_SIMD_WIDTH == 32
+    const __m256i va = _mm256_set1_epi8(a);
+    const __m256i vb = _mm256_set1_epi8(b);
+    while (end - p >= 32) {
+        const __m256i chunk = _mm256_loadu_si256((const __m256i*)p);
+        const uint32_t mask = (uint32_t)_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, va), _mm256_cmpeq_epi8(chunk, vb)));
+        if (mask) return p + ctz32(mask);
+        p += 32;
     }
-    return NULL;
+#elif ARGENTUM_JSON_SIMD_WIDTH == 16
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    while (end - p >= 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i*)p);
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, va), _mm_cmpeq_epi8(chunk, vb)));
+        if (mask) return p + ctz32(mask);
+        p += 16;
+    }
+#endif
+    while (p < end && *p != a && *p != b) ++p;
+    return p;
+}
+
+/* First of '"', ',', '}', ']', '{', '[' in [p, end), or end. */
+static const char* scan_structural(const char* p, const char* end) {
+#if ARGENTUM_JSON_SIMD_WIDTH == 32
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i brace_o = _mm256_set1_epi8('{');
+    const __m256i brace_c = _mm256_set1_epi8('}');
+    const __m256i brack_o = _mm256_set1_epi8('[');
+    const __m256i brack_c = _mm256_set1_epi8(']');
+    while (end - p >= 32) {
+        const __m256i c = _mm256_loadu_si256((const __m256i*)p);
+        const __m256i hit = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(c, quote), _mm256_cmpeq_epi8(c, comma)),
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(c, brace_o), _mm256_cmpeq_epi8(c, brace_c)),
+                            _mm256_or_si256(_mm256_cmpeq_epi8(c, brack_o), _mm256_cmpeq_epi8(c, brack_c))));
+        const uint32_t mask = (uint32_t)_mm256_movemask_epi8(hit);
+        if (mask) return p + ctz32(mask);
+        p += 32;
+    }
+#elif ARGENTUM_JSON_SIMD_WIDTH == 16
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i brace_o = _mm_set1_epi8('{');
+    const __m128i brace_c = _mm_set1_epi8('}');
+    const __m128i brack_o = _mm_set1_epi8('[');
+    const __m128i brack_c = _mm_set1_epi8(']');
+    while (end - p >= 16) {
+        const __m128i c = _mm_loadu_si128((const __m128i*)p);
+        const __m128i hit = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(c, quote), _mm_cmpeq_epi8(c, comma)),
+            _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, brace_o), _mm_cmpeq_epi8(c, brace_c)),
+                         _mm_or_si128(_mm_cmpeq_epi8(c, brack_o), _mm_cmpeq_epi8(c, brack_c))));
+        const uint32_t mask = (uint32_t)_mm_movemask_epi8(hit);
+        if (mask) return p + ctz32(mask);
+        p += 16;
+    }
+#endif
+    while (p < end && *p != '"' && *p != ',' && *p != '{' && *p != '}' && *p != '[' && *p != ']') ++p;
+    return p;
 }
 
 static const char* skip_ws(const char* p, const char* end) {
@@ -22,208 +112,375 @@ static const char* skip_ws(const char* p, const char* end) {
     return p;
 }
 
-static ArgentumStatus parse_string(const char* p, const char* end, char* out, size_t out_len) {
+/* `p` is just past an opening quote; returns the closing quote or NULL. */
+static const char* string_end(const char* p, const char* end) {
+    for (;;) {
+        p = scan_for2(p, end, '"', '\\');
+        if (p >= end) return NULL;
+        if (*p == '"') return p;
+        p += 2; /* escaped character */
+        if (p > end) return NULL;
+    }
+}
+
+/* Skips one value of any type starting at `p`; returns the byte after it or NULL. */
+static const char* skip_value(const char* p, const char* end) {
     p = skip_ws(p, end);
-    if (p >= end || *p != '"') return ARGENTUM_ERR_PARSE;
-    p++;
-    size_t i = 0;
-    while (p < end && *p != '"') {
-        if (i + 1 >= out_len) return ARGENTUM_ERR_RANGE;
-        out[i++] = *p++;
+    if (p >= end) return NULL;
+    if (*p == '"') {
+        const char* close = string_end(p + 1, end);
+        return close ? close + 1 : NULL;
+    }
+    if (*p != '{' && *p != '[') {
+        /* number / literal: up to the next structural byte */
+        const char* stop = scan_structural(p, end);
+        return stop > p ? stop : NULL;
+    }
+
+    int depth = 0;
+    while (p < end) {
+        p = scan_structural(p, end);
+        if (p >= end) return NULL;
+        switch (*p) {
+            case '"': {
+                const char* close = string_end(p + 1, end);
+                if (!close) return NULL;
+                p = close + 1;
+                continue;
+            }
+            case '{':
+            case '[':
+                ++depth;
+                break;
+            case '}':
+            case ']':
+                if (--depth == 0) return p + 1;
+                break;
+            default:
+                break;
+        }
+        ++p;
+    }
+    return NULL;
+}
+
+static double scaled_to_double(int64_t units) {
+    return (double)units / 1e6;
+}
+
+/* Decimal number, optionally quoted, in 1e-6 units (core/decimal.h). */
+static ArgentumStatus parse_fixed6(const char** pp, const char* end, int64_t* out) {
+    const char* p = skip_ws(*pp, end);
+    const int quoted = (p < end && *p == '"');
+    if (quoted) ++p;
+
+    ArgentumStatus st = decimal_parse_scaled(p, end, TICK_SCALE_DIGITS, out, &p);
+    if (st != ARGENTUM_OK) return st;
+    if (quoted) {
+        if (p >= end || *p != '"') return ARGENTUM_ERR_PARSE;
+        ++p;
+    }
+    *pp = p;
+    return ARGENTUM_OK;
+}
+
+static ArgentumStatus parse_u64(const char** pp, const char* end, uint64_t* out) {
+    const char* p = skip_ws(*pp, end);
+    uint64_t value = 0;
+    const char* start = p;
+    for (; p < end && (unsigned)(*p - '0') < 10; ++p) {
+        const uint64_t digit = (uint64_t)(*p - '0');
+        if (value > (UINT64_MAX - digit) / 10) return ARGENTUM_ERR_RANGE;
+        value = value * 10 + digit;
     }
+    if (p == start) return ARGENTUM_ERR_PARSE;
+    *out = value;
+    *pp = p;
+    return ARGENTUM_OK;
+}
+
+/* Quoted string value; `*out`/`*out_len` point into the input (no unescaping). */
+static ArgentumStatus parse_string_ref(const char** pp, const char* end, const char** out, size_t* out_len) {
+    const char* p = skip_ws(*pp, end);
     if (p >= end || *p != '"') return ARGENTUM_ERR_PARSE;
-    out[i] = '\0';
+    const char* close = string_end(p + 1, end);
+    if (!close) return ARGENTUM_ERR_PARSE;
+    *out = p + 1;
+    *out_len = (size_t)(close - (p + 1));
+    *pp = close + 1;
     return ARGENTUM_OK;
 }
 
-static ArgentumStatus parse_number(const char* p, const char* end, double* out) {
-    p = skip_ws(p, end);
-    if (p >= end) return ARGENTUM_ERR_PARSE;
+typedef enum {
+    JSON_KEY_OTHER = 0,
+    JSON_KEY_TIMESTAMP_NS,
+    JSON_KEY_TS,
+    JSON_KEY_PRICE,
+    JSON_KEY_QUANTITY,
+    JSON_KEY_VOLUME,
+    JSON_KEY_SYMBOL,
+    JSON_KEY_SIDE,
+    JSON_KEY_SOURCE,
+    JSON_KEY_SEQ
+} JsonKey;
+
+#define JSON_KEY_SIG(len, first, last) (((uint32_t)(len) << 16) | ((uint32_t)(unsigned char)(first) << 8) | (uint32_t)(unsigned char)(last))
 
-    char tmp[64];
-    size_t i = 0;
-    while (p < end && (isdigit((unsigned char)*p) || *p == '-' || *p == '+' || *p == '.' || *p == 'e' || *p == 'E')) {
-        if (i + 1 >= sizeof(tmp)) return ARGENTUM_ERR_RANGE;
-        tmp[i++] = *p++;
+static JsonKey classify_key(const char* key, size_t len) {
+    if (len == 0 || len > 12) return JSON_KEY_OTHER;
+    JsonKey candidate = JSON_KEY_OTHER;
+    const char* expected = NULL;
+    switch (JSON_KEY_SIG(len, key[0], key[len - 1])) {
+        case JSON_KEY_SIG(12, 't', 's'): candidate = JSON_KEY_TIMESTAMP_NS; expected = "timestamp_ns"; break;
+        case JSON_KEY_SIG(2, 't', 's'): candidate = JSON_KEY_TS; expected = "ts"; break;
+        case JSON_KEY_SIG(5, 'p', 'e'): candidate = JSON_KEY_PRICE; expected = "price"; break;
+        case JSON_KEY_SIG(8, 'q', 'y'): candidate = JSON_KEY_QUANTITY; expected = "quantity"; break;
+        case JSON_KEY_SIG(6, 'v', 'e'): candidate = JSON_KEY_VOLUME; expected = "volume"; break;
+        case JSON_KEY_SIG(6, 's', 'l'): candidate = JSON_KEY_SYMBOL; expected = "symbol"; break;
+        case JSON_KEY_SIG(4, 's', 'e'): candidate = JSON_KEY_SIDE; expected = "side"; break;
+        case JSON_KEY_SIG(6, 's', 'e'): candidate = JSON_KEY_SOURCE; expected = "source"; break;
+        case JSON_KEY_SIG(3, 's', 'q'): candidate = JSON_KEY_SEQ; expected = "seq"; break;
+        default: return JSON_KEY_OTHER;
     }
-    tmp[i] = '\0';
-    if (i == 0) return ARGENTUM_ERR_PARSE;
-    *out = strtod(tmp, NULL);
-    return ARGENTUM_OK;
+    return memcmp(key, expected, len) == 0 ? candidate : JSON_KEY_OTHER;
 }
 
-static ArgentumStatus parse_u64(const char* p, const char* end, uint64_t* out) {
-    p = skip_ws(p, end);
-    if (p >= end) return ARGENTUM_ERR_PARSE;
+typedef struct {
+    uint32_t seen; /* bit per JsonKey */
+    uint64_t timestamp_ns;
+    uint64_t ts;
+    uint64_t seq;
+    int64_t price_ticks;
+    int64_t quantity_lots;
+    int64_t volume_lots;
+    const char* symbol;
+    size_t symbol_len;
+    const char* source;
+    size_t source_len;
+    uint8_t side;
+} JsonTickFields;
 
-    char tmp[32];
-    size_t i = 0;
-    while (p < end && isdigit((unsigned char)*p)) {
-        if (i + 1 >= sizeof(tmp)) return ARGENTUM_ERR_RANGE;
-        tmp[i++] = *p++;
+static ArgentumStatus parse_side_value(const char** pp, const char* end, uint8_t* out) {
+    const char* p = skip_ws(*pp, end);
+    if (p >= end) return ARGENTUM_ERR_PARSE;
+    char c;
+    if (*p == '"') {
+        const char* s = NULL;
+        size_t n = 0;
+        if (parse_string_ref(&p, end, &s, &n) != ARGENTUM_OK || n == 0) return ARGENTUM_ERR_PARSE;
+        c = s[0];
+    } else {
+        uint64_t numeric = 0;
+        if (parse_u64(&p, end, &numeric) != ARGENTUM_OK || numeric < 1 || numeric > 2) return ARGENTUM_ERR_PARSE;
+        c = (char)('0' + numeric);
+    }
+    if (c == 'B' || c == 'b' || c == '1') {
+        *out = SIDE_BUY;
+    } else if (c == 'S' || c == 's' || c == '2') {
+        *out = SIDE_SELL;
+    } else {
+        return ARGENTUM_ERR_PARSE;
     }
-    tmp[i] = '\0';
-    if (i == 0) return ARGENTUM_ERR_PARSE;
-    *out = (uint64_t)strtoull(tmp, NULL, 10);
+    *pp = p;
     return ARGENTUM_OK;
 }
 
-static ArgentumStatus parse_json(const char* data, size_t len, MarketTick* out) {
+static ArgentumStatus parse_json_object(const char** pp, const char* end, JsonTickFields* f, int depth) {
+    const char* p = skip_ws(*pp, end);
+    if (p >= end || *p != '{') return ARGENTUM_ERR_PARSE;
+    p = skip_ws(p + 1, end);
+    if (p < end && *p == '}') {
+        *pp = p + 1;
+        return ARGENTUM_OK;
+    }
+
+    for (;;) {
+        const char* key = NULL;
+        size_t key_len = 0;
+        if (parse_string_ref(&p, end, &key, &key_len) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
+        p = skip_ws(p, end);
+        if (p >= end || *p != ':') return ARGENTUM_ERR_PARSE;
+        p = skip_ws(p + 1, end);
+        if (p >= end) return ARGENTUM_ERR_PARSE;
+
+        const JsonKey kind = classify_key(key, key_len);
+        const uint32_t bit = 1U << kind;
+        ArgentumStatus st = ARGENTUM_OK;
+        if (kind != JSON_KEY_OTHER && (f->seen & bit)) {
+            p = skip_value(p, end); /* first occurrence wins */
+            if (!p) return ARGENTUM_ERR_PARSE;
+        } else {
+            switch (kind) {
+                case JSON_KEY_TIMESTAMP_NS: st = parse_u64(&p, end, &f->timestamp_ns); break;
+                case JSON_KEY_TS: st = parse_u64(&p, end, &f->ts); break;
+                case JSON_KEY_PRICE: st = parse_fixed6(&p, end, &f->price_ticks); break;
+                case JSON_KEY_QUANTITY: st = parse_fixed6(&p, end, &f->quantity_lots); break;
+                case JSON_KEY_VOLUME: st = parse_fixed6(&p, end, &f->volume_lots); break;
+                case JSON_KEY_SYMBOL: st = parse_string_ref(&p, end, &f->symbol, &f->symbol_len); break;
+                case JSON_KEY_SIDE: st = parse_side_value(&p, end, &f->side); break;
+                case JSON_KEY_SOURCE: st = parse_string_ref(&p, end, &f->source, &f->source_len); break;
+                case JSON_KEY_SEQ: st = parse_u64(&p, end, &f->seq); break;
+                case JSON_KEY_OTHER:
+                default:
+                    if (*p == '{' && depth + 1 < JSON_MAX_DEPTH) {
+                        st = parse_json_object(&p, end, f, depth + 1);
+                    } else {
+                        p = skip_value(p, end);
+                        if (!p) return ARGENTUM_ERR_PARSE;
+                    }
+                    break;
+            }
+            if (st != ARGENTUM_OK) return st;
+            if (kind != JSON_KEY_OTHER) f->seen |= bit;
+        }
+
+        p = skip_ws(p, end);
+        if (p >= end) return ARGENTUM_ERR_PARSE;
+        if (*p == ',') {
+            p = skip_ws(p + 1, end);
+            continue;
+        }
+        if (*p == '}') {
+            *pp = p + 1;
+            return ARGENTUM_OK;
+        }
+        return ARGENTUM_ERR_PARSE;
+    }
+}
+
+static ArgentumStatus parse_json(const char* data, size_t len, MarketTick* out, uint64_t* out_seq) {
     if (!data || !out) return ARGENTUM_ERR_INVALID;
     const char* end = data + len;
 
     memset(out, 0, sizeof(*out));
 
-    const char* k_ts = find_key(data, len, "timestamp_ns");
-    if (!k_ts) k_ts = find_key(data, len, "ts");
-    const char* k_price = find_key(data, len, "price");
-    const char* k_qty = find_key(data, len, "quantity");
-    if (!k_qty) k_qty = find_key(data, len, "volume");
-    const char* k_symbol = find_key(data, len, "symbol");
-    const char* k_side = find_key(data, len, "side");
-    const char* k_source = find_key(data, len, "source");
-
-    if (!k_price || !k_qty || !k_symbol || !k_side) return ARGENTUM_ERR_PARSE;
-
-    if (k_ts) {
-        if (parse_u64(k_ts + 1, end, &out->timestamp_ns) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
-    }
-
-    if (parse_number(k_price + 1, end, &out->price) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
-    if (parse_number(k_qty + 1, end, &out->quantity) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
-
-    char raw_symbol[SYMBOL_LEN * 2] = {0};
-    if (parse_string(k_symbol + 1, end, raw_symbol, sizeof(raw_symbol)) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
-    if (normalize_symbol(raw_symbol, out->symbol, sizeof(out->symbol)) != ARGENTUM_OK) return ARGENTUM_ERR_INVALID;
-
-    char side_str[8] = {0};
-    ArgentumStatus side_status = parse_string(k_side + 1, end, side_str, sizeof(side_str));
-    if (side_status != ARGENTUM_OK) {
-        uint64_t numeric_side = 0;
-        if (parse_u64(k_side + 1, end, &numeric_side) == ARGENTUM_OK) {
-            if (numeric_side == 1) {
-                out->side = SIDE_BUY;
-            } else if (numeric_side == 2) {
-                out->side = SIDE_SELL;
-            } else {
-                return ARGENTUM_ERR_PARSE;
-            }
-        } else {
-            return ARGENTUM_ERR_PARSE;
-        }
+    JsonTickFields f;
+    memset(&f, 0, sizeof(f));
+    const char* p = data;
+    if (parse_json_object(&p, end, &f, 0) != ARGENTUM_OK) return ARGENTUM_ERR_PARSE;
+
+#define JSON_SEEN(k) ((f.seen & (1U << (k))) != 0)
+    const int have_qty = JSON_SEEN(JSON_KEY_QUANTITY) || JSON_SEEN(JSON_KEY_VOLUME);
+    if (!JSON_SEEN(JSON_KEY_PRICE) || !have_qty || !JSON_SEEN(JSON_KEY_SYMBOL) || !JSON_SEEN(JSON_KEY_SIDE)) {
+        return ARGENTUM_ERR_PARSE;
     }
 
-    if (side_status == ARGENTUM_OK) {
-        if (side_str[0] == 'B' || side_str[0] == 'b' || strcmp(side_str, "BUY") == 0 || strcmp(side_str, "buy") == 0) {
-            out->side = SIDE_BUY;
-        } else if (side_str[0] == 'S' || side_str[0] == 's' || strcmp(side_str, "SELL") == 0 || strcmp(side_str, "sell") == 0) {
-            out->side = SIDE_SELL;
-        } else if (side_str[0] == '1') {
-            out->side = SIDE_BUY;
-        } else if (side_str[0] == '2') {
-            out->side = SIDE_SELL;
-        } else {
-            return ARGENTUM_ERR_PARSE;
-        }
+    if (JSON_SEEN(JSON_KEY_TIMESTAMP_NS)) {
+        out->timestamp_ns = f.timestamp_ns;
+    } else if (JSON_SEEN(JSON_KEY_TS)) {
+        out->timestamp_ns = f.ts;
     }
+    out->price = scaled_to_double(f.price_ticks);
+    out->quantity = scaled_to_double(JSON_SEEN(JSON_KEY_QUANTITY) ? f.quantity_lots : f.volume_lots);
+    out->side = f.side;
 
-    if (k_source) {
-        char source[SOURCE_LEN] = {0};
-        if (parse_string(k_source + 1, end, source, sizeof(source)) == ARGENTUM_OK) {
-            strncpy(out->source, source, sizeof(out->source) - 1);
-        }
+    const ArgentumStatus symbol_status =
+        resolve_symbol(f.symbol, f.symbol_len, out->symbol, sizeof(out->symbol), &out->instrument_id);
+    if (symbol_status == ARGENTUM_ERR_PARSE) return ARGENTUM_ERR_PARSE;
+    if (symbol_status != ARGENTUM_OK) return ARGENTUM_ERR_INVALID;
+
+    if (JSON_SEEN(JSON_KEY_SOURCE) && f.source_len < sizeof(out->source)) {
+        memcpy(out->source, f.source, f.source_len);
     }
+    if (out_seq) *out_seq = JSON_SEEN(JSON_KEY_SEQ) ? f.seq : 0;
+#undef JSON_SEEN
 
     return ARGENTUM_OK;
 }
 
-static const char* find_fix_tag(const char* data, size_t len, const char* tag, char delimiter, size_t* out_value_len) {
-    const size_t tag_len = strlen(tag);
-    for (size_t i = 0; i + tag_len + 1 < len; ++i) {
-        if (memcmp(&data[i], tag, tag_len) != 0) continue;
-        if (data[i + tag_len] != '=') continue;
+/* ---- FIX: one tokenizer pass (core/fix_tokenizer.h), values read in place ---- */
 
-        const size_t val_begin = i + tag_len + 1;
-        size_t val_end = val_begin;
-        while (val_end < len && data[val_end] != delimiter) ++val_end;
-        if (val_end <= val_begin) continue;
-        if (out_value_len) *out_value_len = (val_end - val_begin);
-        return &data[val_begin];
-    }
-    return NULL;
-}
+enum { FIX_SYMBOL, FIX_SIDE, FIX_PRICE, FIX_QTY, FIX_TIME, FIX_SEQ, FIX_TAG_COUNT };
+static const uint32_t kFixTickTags[FIX_TAG_COUNT] = {55, 54, 44, 38, 60, 34};
 
-static ArgentumStatus copy_fix_value(
-    const char* data,
-    size_t len,
-    const char* tag,
-    char delimiter,
-    char* out,
-    size_t out_len) {
-    size_t value_len = 0;
-    const char* value = find_fix_tag(data, len, tag, delimiter, &value_len);
-    if (!value || value_len == 0) return ARGENTUM_ERR_PARSE;
-    if (value_len + 1 > out_len) return ARGENTUM_ERR_RANGE;
-    memcpy(out, value, value_len);
-    out[value_len] = '\0';
+/* The whole value must be a decimal; result in 1e-6 units. */
+static ArgentumStatus parse_fix_scaled(const char* data, const FixField* field, int64_t* out) {
+    if (field->tag == 0 || field->length == 0) return ARGENTUM_ERR_PARSE;
+    const char* first = data + field->offset;
+    const char* last = first + field->length;
+    const char* stop = NULL;
+    if (decimal_parse_scaled(first, last, TICK_SCALE_DIGITS, out, &stop) != ARGENTUM_OK || stop != last) {
+        return ARGENTUM_ERR_PARSE;
+    }
     return ARGENTUM_OK;
 }
 
-static ArgentumStatus parse_fix(const char* data, size_t len, MarketTick* out) {
+static ArgentumStatus parse_fix(const char* data, size_t len, MarketTick* out, uint64_t* out_seq) {
     if (!data || !out || len == 0) return ARGENTUM_ERR_INVALID;
 
     memset(out, 0, sizeof(*out));
-    const char delimiter = (memchr(data, '|', len) != NULL) ? '|' : '\x01';
+    const char delimiter = fix_detect_delimiter(data, len);
 
-    char symbol_raw[SYMBOL_LEN * 2] = {0};
-    char side_raw[8] = {0};
-    char price_raw[64] = {0};
-    char qty_raw[64] = {0};
-    char ts_raw[32] = {0};
+    FixField fields[FIX_TAG_COUNT];
+    fix_scan_tags(data, len, delimiter, kFixTickTags, FIX_TAG_COUNT, fields);
 
-    if (copy_fix_value(data, len, "55", delimiter, symbol_raw, sizeof(symbol_raw)) != ARGENTUM_OK) {
-        return ARGENTUM_ERR_PARSE;
-    }
-    if (copy_fix_value(data, len, "54", delimiter, side_raw, sizeof(side_raw)) != ARGENTUM_OK) {
-        return ARGENTUM_ERR_PARSE;
-    }
-    if (copy_fix_value(data, len, "44", delimiter, price_raw, sizeof(price_raw)) != ARGENTUM_OK) {
-        return ARGENTUM_ERR_PARSE;
-    }
-    if (copy_fix_value(data, len, "38", delimiter, qty_raw, sizeof(qty_raw)) != ARGENTUM_OK) {
+    int64_t price_ticks = 0;
+    int64_t quantity_lots = 0;
+    if (fields[FIX_SYMBOL].tag == 0 || fields[FIX_SYMBOL].length == 0 ||
+        fields[FIX_SIDE].tag == 0 || fields[FIX_SIDE].length == 0 ||
+        parse_fix_scaled(data, &fields[FIX_PRICE], &price_ticks) != ARGENTUM_OK ||
+        parse_fix_scaled(data, &fields[FIX_QTY], &quantity_lots) != ARGENTUM_OK) {
         return ARGENTUM_ERR_PARSE;
     }
 
-    if (normalize_symbol(symbol_raw, out->symbol, sizeof(out->symbol)) != ARGENTUM_OK) {
-        return ARGENTUM_ERR_INVALID;
-    }
+    const ArgentumStatus symbol_status = resolve_symbol(data + fields[FIX_SYMBOL].offset,
+                                                        fields[FIX_SYMBOL].length,
+                                                        out->symbol,
+                                                        sizeof(out->symbol),
+                                                        &out->instrument_id);
+    if (symbol_status == ARGENTUM_ERR_PARSE) return ARGENTUM_ERR_PARSE;
+    if (symbol_status != ARGENTUM_OK) return ARGENTUM_ERR_INVALID;
 
-    out->price = strtod(price_raw, NULL);
-    out->quantity = strtod(qty_raw, NULL);
-    if (out->price <= 0.0 || out->quantity <= 0.0) return ARGENTUM_ERR_PARSE;
+    if (price_ticks <= 0 || quantity_lots <= 0) return ARGENTUM_ERR_PARSE;
+    out->price = scaled_to_double(price_ticks);
+    out->quantity = scaled_to_double(quantity_lots);
 
-    if (side_raw[0] == '1' || side_raw[0] == 'B' || side_raw[0] == 'b') {
+    const char side = data[fields[FIX_SIDE].offset];
+    if (side == '1' || side == 'B' || side == 'b') {
         out->side = SIDE_BUY;
-    } else if (side_raw[0] == '2' || side_raw[0] == 'S' || side_raw[0] == 's') {
+    } else if (side == '2' || side == 'S' || side == 's') {
         out->side = SIDE_SELL;
     } else {
         return ARGENTUM_ERR_PARSE;
     }
 
-    if (copy_fix_value(data, len, "60", delimiter, ts_raw, sizeof(ts_raw)) == ARGENTUM_OK) {
-        out->timestamp_ns = (uint64_t)strtoull(ts_raw, NULL, 10);
+    if (fields[FIX_TIME].tag != 0) {
+        const char* p = data + fields[FIX_TIME].offset;
+        const char* end = p + fields[FIX_TIME].length;
+        uint64_t ts = 0;
+        if (parse_u64(&p, end, &ts) == ARGENTUM_OK) out->timestamp_ns = ts;
+    }
+    if (out_seq) {
+        *out_seq = 0;
+        if (fields[FIX_SEQ].tag != 0) {
+            const char* p = data + fields[FIX_SEQ].offset;
+            const char* end = p + fields[FIX_SEQ].length;
+            uint64_t seq = 0;
+            if (parse_u64(&p, end, &seq) == ARGENTUM_OK) *out_seq = seq;
+        }
     }
-    strncpy(out->source, "FIX", sizeof(out->source) - 1);
+    memcpy(out->source, "FIX", 4);
     return ARGENTUM_OK;
 }
 
 ArgentumStatus parse_market_message(FeedFormat format, const char* data, size_t len, MarketTick* out) {
+    return parse_market_message_seq(format, data, len, out, NULL);
+}
+
+ArgentumStatus parse_market_message_seq(FeedFormat format,
+                                        const char* data,
+                                        size_t len,
+                                        MarketTick* out,
+                                        uint64_t* out_seq) {
     switch (format) {
         case FEED_FORMAT_JSON:
-            return parse_json(data, len, out);
+            return parse_json(data, len, out, out_seq);
         case FEED_FORMAT_FIX:
-            return parse_fix(data, len, out);
+            return parse_fix(data, len, out, out_seq);
         case FEED_FORMAT_SBE:
+            /* A lone Trade message has no sequence; it lives in the SBE packet header. */
+            if (out_seq) *out_seq = 0;
+            return sbe_decode_trade_tick((const uint8_t*)data, len, out);
         default:
             return ARGENTUM_ERR_INVALID;
     }
@@ -0,0 +1,64 @@
+#include "datafeed/replay_clock.hpp"
+
+#include "bus/wait_strategy.hpp"
+#include "core/time_utils.hpp"
+
+#include <chrono>
+#include <thread>
+
+namespace argentum::datafeed {
+
+ReplayClock::ReplayClock(ReplayClockConfig config) : config_(config) {}
+
+void ReplayClock::rearm() {
+    anchored_ = false;
+}
+
+uint64_t ReplayClock::wait_for_event(uint64_t event_ts_ns) {
+    ++events_;
+    if (config_.speed <= 0.0) {
+        lag_.record(0);
+        return 0;
+    }
+
+    if (!anchored_) {
+        // Nothing to schedule against until a real timestamp arrives.
+        if (event_ts_ns == 0) {
+            lag_.record(0);
+            return 0;
+        }
+        anchored_ = true;
+        anchor_ts_ns_ = event_ts_ns;
+        anchor_wall_ns_ = core::now_ns();
+        last_ts_ns_ = event_ts_ns;
+    }
+    if (event_ts_ns > last_ts_ns_) last_ts_ns_ = event_ts_ns;
+
+    const double offset = static_cast<double>(last_ts_ns_ - anchor_ts_ns_) / config_.speed;
+    const uint64_t deadline = anchor_wall_ns_ + static_cast<uint64_t>(offset);
+
+    uint64_t now = core::now_ns();
+    while (now + config_.spin_threshold_ns < deadline) {
+        std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now - config_.spin_threshold_ns));
+        now = core::now_ns();
+    }
+    while (now < deadline) {
+        bus::cpu_relax();
+        now = core::now_ns();
+    }
+
+    const uint64_t lag = now - deadline;
+    lag_.record(lag);
+    if (lag > kLateToleranceNs) ++late_events_;
+    return lag;
+}
+
+ReplayLagStats ReplayClock::stats() const {
+    ReplayLagStats out;
+    out.events = events_;
+    out.late_events = late_events_;
+    out.lag = lag_.percentiles();
+    return out;
+}
+
+} // namespace argentum::datafeed
@@ -0,0 +1,213 @@
+#include "datafeed/sbe_decoder.h"
+#include "datafeed/normalizer.h"
+
+#include <string.h>
+
+/* Fixed-offset little-endian loads. Callers bounds-check a whole block once. */
+static inline uint16_t load_u16(const uint8_t* p) {
+    uint16_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t load_u32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t load_u64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline int64_t load_i64(const uint8_t* p) {
+    int64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void load_symbol(const uint8_t* p, char* out) {
+    memcpy(out, p, SBE_SYMBOL_LENGTH);
+    out[SBE_SYMBOL_LENGTH] = '\0';
+}
+
+static inline uint8_t book_side(uint8_t raw) {
+    return raw == SIDE_SELL ? (uint8_t)SIDE_SELL : (uint8_t)SIDE_BUY;
+}
+
+typedef struct {
+    uint16_t block_length;
+    uint16_t template_id;
+    const uint8_t* block;
+    const uint8_t* end;
+} SbeMessage;
+
+/* Validates the header and that the root block fits; `data` starts at the MessageHeader. */
+static ArgentumStatus open_message(const uint8_t* data, size_t len, SbeMessage* msg, int* foreign) {
+    if (len < SBE_MESSAGE_HEADER_SIZE) return ARGENTUM_ERR_PROTO;
+    msg->block_length = load_u16(data + SBE_HDR_OFF_BLOCK_LENGTH);
+    msg->template_id = load_u16(data + SBE_HDR_OFF_TEMPLATE_ID);
+    msg->block = data + SBE_MESSAGE_HEADER_SIZE;
+    msg->end = data + len;
+    *foreign = load_u16(data + SBE_HDR_OFF_SCHEMA_ID) != ARGENTUM_SBE_SCHEMA_ID;
+    if ((size_t)msg->block_length > len - SBE_MESSAGE_HEADER_SIZE) return ARGENTUM_ERR_PROTO;
+    return ARGENTUM_OK;
+}
+
+static void decode_trade(const uint8_t* b, SbeMarketEvent* ev) {
+    memset(ev, 0, sizeof(*ev));
+    ev->template_id = SBE_TEMPLATE_TRADE;
+    ev->transact_time_ns = load_u64(b + SBE_TRADE_OFF_TIME);
+    ev->price_ticks = load_i64(b + SBE_TRADE_OFF_PRICE);
+    ev->quantity_lots = load_i64(b + SBE_TRADE_OFF_QUANTITY);
+    ev->security_id = load_u32(b + SBE_TRADE_OFF_SECURITY_ID);
+    ev->side = b[SBE_TRADE_OFF_AGGRESSOR];
+    load_symbol(b + SBE_TRADE_OFF_SYMBOL, ev->symbol);
+}
+
+static void decode_top_of_book(const uint8_t* b, SbeMarketEvent* ev) {
+    memset(ev, 0, sizeof(*ev));
+    ev->template_id = SBE_TEMPLATE_TOP_OF_BOOK;
+    ev->transact_time_ns = load_u64(b + SBE_TOB_OFF_TIME);
+    ev->price_ticks = load_i64(b + SBE_TOB_OFF_BID_PRICE);
+    ev->quantity_lots = load_i64(b + SBE_TOB_OFF_BID_QUANTITY);
+    ev->ask_price_ticks = load_i64(b + SBE_TOB_OFF_ASK_PRICE);
+    ev->ask_quantity_lots = load_i64(b + SBE_TOB_OFF_ASK_QUANTITY);
+    ev->security_id = load_u32(b + SBE_TOB_OFF_SECURITY_ID);
+    ev->rpt_seq = load_u32(b + SBE_TOB_OFF_RPT_SEQ);
+    load_symbol(b + SBE_TOB_OFF_SYMBOL, ev->symbol);
+}
+
+static ArgentumStatus decode_book_update(const SbeMessage* msg,
+                                         SbeMarketEvent* events,
+                                         size_t max_events,
+                                         size_t* count) {
+    const uint8_t* group = msg->block + msg->block_length;
+    if ((size_t)(msg->end - group) < SBE_GROUP_HEADER_SIZE) return ARGENTUM_ERR_PROTO;
+    const uint16_t entry_length = load_u16(group);
+    const uint8_t entries = group[2];
+    const uint8_t* entry = group + SBE_GROUP_HEADER_SIZE;
+    if (entry_length < SBE_BOOK_ENTRY_LENGTH) return ARGENTUM_ERR_PROTO;
+    if ((size_t)(msg->end - entry) < (size_t)entry_length * entries) return ARGENTUM_ERR_PROTO;
+
+    SbeMarketEvent root;
+    memset(&root, 0, sizeof(root));
+    root.template_id = SBE_TEMPLATE_BOOK_UPDATE;
+    root.transact_time_ns = load_u64(msg->block + SBE_BOOK_OFF_TIME);
+    root.security_id = load_u32(msg->block + SBE_BOOK_OFF_SECURITY_ID);
+    root.rpt_seq = load_u32(msg->block + SBE_BOOK_OFF_RPT_SEQ);
+    load_symbol(msg->block + SBE_BOOK_OFF_SYMBOL, root.symbol);
+
+    for (uint8_t i = 0; i < entries; ++i, entry += entry_length) {
+        if (*count >= max_events) return ARGENTUM_ERR_RANGE;
+        SbeMarketEvent* ev = &events[(*count)++];
+        *ev = root;
+        ev->price_ticks = load_i64(entry + SBE_ENTRY_OFF_PRICE);
+        ev->quantity_lots = load_i64(entry + SBE_ENTRY_OFF_QUANTITY);
+        ev->update_action = entry[SBE_ENTRY_OFF_ACTION];
+        ev->side = book_side(entry[SBE_ENTRY_OFF_SIDE]);
+        ev->price_level = entry[SBE_ENTRY_OFF_LEVEL];
+    }
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus sbe_decode_packet(const uint8_t* data,
+                                 size_t len,
+                                 SbePacketInfo* info,
+                                 SbeMarketEvent* events,
+                                 size_t max_events,
+                                 size_t* out_count) {
+    if (!data || !out_count || (!events && max_events > 0)) return ARGENTUM_ERR_INVALID;
+    *out_count = 0;
+    if (len < SBE_PACKET_HEADER_SIZE) return ARGENTUM_ERR_PROTO;
+
+    SbePacketInfo local;
+    if (!info) info = &local;
+    memset(info, 0, sizeof(*info));
+    info->sequence_number = load_u32(data + SBE_PACKET_OFF_SEQUENCE);
+    info->sending_time_ns = load_u64(data + SBE_PACKET_OFF_SENDING_TIME);
+
+    size_t count = 0;
+    size_t pos = SBE_PACKET_HEADER_SIZE;
+    while (pos < len) {
+        if (len - pos < SBE_MSG_SIZE_FIELD) return ARGENTUM_ERR_PROTO;
+        const uint16_t msg_size = load_u16(data + pos);
+        if (msg_size < SBE_MSG_SIZE_FIELD + SBE_MESSAGE_HEADER_SIZE || msg_size > len - pos) {
+            *out_count = count;
+            return ARGENTUM_ERR_PROTO;
+        }
+
+        SbeMessage msg;
+        int foreign = 0;
+        ArgentumStatus status = open_message(data + pos + SBE_MSG_SIZE_FIELD, msg_size - SBE_MSG_SIZE_FIELD, &msg, &foreign);
+        if (status != ARGENTUM_OK) {
+            *out_count = count;
+            return status;
+        }
+        info->messages++;
+        pos += msg_size;
+
+        if (foreign) {
+            info->skipped_messages++;
+            continue;
+        }
+
+        switch (msg.template_id) {
+            case SBE_TEMPLATE_TRADE:
+                if (msg.block_length < SBE_TRADE_BLOCK_LENGTH) status = ARGENTUM_ERR_PROTO;
+                else if (count >= max_events) status = ARGENTUM_ERR_RANGE;
+                else decode_trade(msg.block, &events[count++]);
+                break;
+            case SBE_TEMPLATE_TOP_OF_BOOK:
+                if (msg.block_length < SBE_TOB_BLOCK_LENGTH) status = ARGENTUM_ERR_PROTO;
+                else if (count >= max_events) status = ARGENTUM_ERR_RANGE;
+                else decode_top_of_book(msg.block, &events[count++]);
+                break;
+            case SBE_TEMPLATE_BOOK_UPDATE:
+                if (msg.block_length < SBE_BOOK_BLOCK_LENGTH) status = ARGENTUM_ERR_PROTO;
+                else status = decode_book_update(&msg, events, max_events, &count);
+                break;
+            default:
+                info->skipped_messages++;
+                break;
+        }
+        if (status != ARGENTUM_OK) {
+            *out_count = count;
+            return status;
+        }
+    }
+
+    *out_count = count;
+    return ARGENTUM_OK;
+}
+
+ArgentumStatus sbe_decode_trade_tick(const uint8_t* data, size_t len, MarketTick* out) {
+    if (!data || !out) return ARGENTUM_ERR_INVALID;
+    memset(out, 0, sizeof(*out));
+
+    SbeMessage msg;
+    int foreign = 0;
+    const ArgentumStatus status = open_message(data, len, &msg, &foreign);
+    if (status != ARGENTUM_OK) return status;
+    if (foreign || msg.template_id != SBE_TEMPLATE_TRADE) return ARGENTUM_ERR_INVALID;
+    if (msg.block_length < SBE_TRADE_BLOCK_LENGTH) return ARGENTUM_ERR_PROTO;
+
+    SbeMarketEvent ev;
+    decode_trade(msg.block, &ev);
+    if (ev.side != SIDE_BUY && ev.side != SIDE_SELL) return ARGENTUM_ERR_PARSE;
+    if (resolve_symbol(ev.symbol, strlen(ev.symbol), out->symbol, sizeof(out->symbol), &out->instrument_id) !=
+        ARGENTUM_OK) {
+        return ARGENTUM_ERR_INVALID;
+    }
+
+    /* Mantissas use exponent -6, the same scale as core::kPriceScale / kQuantityScale. */
+    out->timestamp_ns = ev.transact_time_ns;
+    out->price = (double)ev.price_ticks / 1e6;
+    out->quantity = (double)ev.quantity_lots / 1e6;
+    out->side = ev.side;
+    if (out->price <= 0.0 || out->quantity <= 0.0) return ARGENTUM_ERR_PARSE;
+    strncpy(out->source, "SBE", sizeof(out->source) - 1);
+    return ARGENTUM_OK;
+}
@@ -0,0 +1,55 @@
+#include "datafeed/normalizer.h"
+
+#include "core/symbol_alias_table.hpp"
+
+#include <cctype>
+#include <cstring>
+
+using argentum::core::instrument_registry;
+using argentum::core::symbol_aliases;
+
+ArgentumStatus resolve_symbol(const char* raw, size_t raw_len, char* out, size_t out_len, uint32_t* out_id) {
+    if (!raw || !out || out_len == 0 || !out_id) return ARGENTUM_ERR_INVALID;
+
+    const uint32_t id = symbol_aliases().find(std::string_view(raw, raw_len));
+    if (id != argentum::core::InstrumentRegistry::kInvalidId) {
+        const std::string_view name = symbol_aliases().canonical_name(id);
+        if (name.size() < out_len) {
+            std::memcpy(out, name.data(), name.size());
+            out[name.size()] = '\0';
+            *out_id = id;
+            return ARGENTUM_OK;
+        }
+    }
+
+    char terminated[SYMBOL_LEN * 2];
+    if (raw_len >= sizeof(terminated)) return ARGENTUM_ERR_PARSE;
+    std::memcpy(terminated, raw, raw_len);
+    terminated[raw_len] = '\0';
+    const ArgentumStatus status = normalize_symbol(terminated, out, out_len);
+    if (status != ARGENTUM_OK) return status;
+    *out_id = instrument_registry().find(out);
+    return ARGENTUM_OK;
+}
+
+uint32_t instrument_id_for_symbol(const char* raw, size_t raw_len, int intern) {
+    constexpr uint32_t kInvalid = argentum::core::InstrumentRegistry::kInvalidId;
+    if (!raw || raw_len == 0) return kInvalid;
+
+    char name[SYMBOL_LEN];
+    uint32_t id = kInvalid;
+    if (resolve_symbol(raw, raw_len, name, sizeof(name), &id) == ARGENTUM_OK) {
+        if (id != kInvalid) return id;
+    } else {
+        size_t len = 0;
+        for (size_t i = 0; i < raw_len && raw[i] != '\0'; ++i) {
+            const char c = raw[i];
+            if (c == '/' || c == '-' || c == '_' || c == ' ' || c == '.') continue;
+            if (len + 1 >= sizeof(name)) return kInvalid;
+            name[len++] = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+        if (len == 0) return kInvalid;
+        name[len] = '\0';
+    }
+    return intern ? instrument_registry().intern(name) : instrument_registry().find(name);
+}
@@ -1,10 +1,12 @@
 #include "gateway/fix_adapter.hpp"
 
+#include "core/fix_tokenizer.h"
 #include "core/fixed_point.hpp"
 
-#include <algorithm>
 #include <cctype>
-#include <cstdlib>
+#include <charconv>
+#include <cstring>
+#include <string_view>
 
 namespace argentum::gateway {
 
@@ -14,43 +16,75 @@ const std::string& FixAdapterV1::venue_id() const {
     return venue_id_;
 }
 
-bool FixAdapterV1::parse_market_data(const std::string& raw, VenueQuote* out_quote) const {
-    if (!out_quote || raw.empty()) return false;
+namespace {
 
-    std::unordered_map<int, std::string> fields;
-    const char delimiter = (raw.find('|') != std::string::npos) ? '|' : '\x01';
-    if (!parse_fields(raw, &fields, delimiter)) return false;
+enum FixQuoteField { kSymbol, kBidPx, kAskPx, kBidQty, kAskQty, kTime, kFixQuoteFieldCount };
+constexpr uint32_t kFixQuoteTags[kFixQuoteFieldCount] = {55, 132, 133, 134, 135, 60};
 
-    auto symbol_it = fields.find(55);
-    if (symbol_it == fields.end()) return false;
+std::string_view field_value(std::string_view raw, const FixField& field) {
+    return raw.substr(field.offset, field.length);
+}
 
-    const auto bid_px_it = fields.find(132);
-    const auto ask_px_it = fields.find(133);
-    const auto bid_qty_it = fields.find(134);
-    const auto ask_qty_it = fields.find(135);
+uint64_t parse_u64(std::string_view value) {
+    uint64_t out = 0;
+    std::from_chars(value.data(), value.data() + value.size(), out);
+    return out;
+}
 
-    if (bid_px_it == fields.end() || ask_px_it == fields.end() ||
-        bid_qty_it == fields.end() || ask_qty_it == fields.end()) {
-        return false;
+// Canonical "BASE/QUOTE" form written into `out`; returns its length. `out_len` must be
+// at least raw.size() + 1 (stripping only shrinks, and at most one '/' is inserted).
+size_t normalize_symbol_into(std::string_view raw, char* out, size_t out_len) {
+    size_t n = 0;
+    for (char c : raw) {
+        if (c == '/' || c == '-' || c == '_' || c == ' ') continue;
+        if (n + 1 >= out_len) return 0;
+        out[n++] = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
     }
 
-    const double bid_px = std::strtod(bid_px_it->second.c_str(), nullptr);
-    const double ask_px = std::strtod(ask_px_it->second.c_str(), nullptr);
-    const double bid_qty = std::strtod(bid_qty_it->second.c_str(), nullptr);
-    const double ask_qty = std::strtod(ask_qty_it->second.c_str(), nullptr);
-    if (bid_px <= 0.0 || ask_px <= 0.0 || bid_qty <= 0.0 || ask_qty <= 0.0) return false;
+    size_t split = 0;
+    if (n == 6) {
+        split = 3;
+    } else if (n >= 7 && std::string_view(out + n - 4, 4) == "USDT") {
+        split = n - 4;
+    }
+    if (split != 0) {
+        std::memmove(out + split + 1, out + split, n - split);
+        out[split] = '/';
+        ++n;
+    }
+    return n;
+}
+
+} // namespace
+
+bool FixAdapterV1::parse_market_data(const std::string& raw, VenueQuote* out_quote) const {
+    if (!out_quote || raw.empty()) return false;
 
+    const char delimiter = fix_detect_delimiter(raw.data(), raw.size());
+    FixField fields[kFixQuoteFieldCount];
+    fix_scan_tags(raw.data(), raw.size(), delimiter, kFixQuoteTags, kFixQuoteFieldCount, fields);
+    for (int i = kSymbol; i <= kAskQty; ++i) {
+        if (fields[i].tag == 0) return false;
+    }
+
+    const std::string_view view(raw);
     VenueQuote quote{};
+    if (!core::parse_price_ticks(field_value(view, fields[kBidPx]), &quote.bid_price_ticks) ||
+        !core::parse_price_ticks(field_value(view, fields[kAskPx]), &quote.ask_price_ticks) ||
+        !core::parse_quantity_lots(field_value(view, fields[kBidQty]), &quote.bid_size_lots) ||
+        !core::parse_quantity_lots(field_value(view, fields[kAskQty]), &quote.ask_size_lots)) {
+        return false;
+    }
+
+    char symbol[32];
+    const std::string_view raw_symbol = field_value(view, fields[kSymbol]);
+    if (raw_symbol.size() >= sizeof(symbol)) return false;
+    const size_t symbol_len = normalize_symbol_into(raw_symbol, symbol, sizeof(symbol));
+
     quote.venue_id = venue_id_;
-    quote.symbol = normalize_symbol(symbol_it->second);
-    quote.bid_price_ticks = core::to_price_ticks(bid_px);
-    quote.ask_price_ticks = core::to_price_ticks(ask_px);
-    quote.bid_size_lots = core::to_quantity_lots(bid_qty);
-    quote.ask_size_lots = core::to_quantity_lots(ask_qty);
-
-    auto ts_it = fields.find(60);
-    if (ts_it != fields.end()) {
-        quote.timestamp_ns = static_cast<uint64_t>(std::strtoull(ts_it->second.c_str(), nullptr, 10));
+    quote.symbol.assign(symbol, symbol_len);
+    if (fields[kTime].tag != 0) {
+        quote.timestamp_ns = parse_u64(field_value(view, fields[kTime]));
     }
 
     if (quote.symbol.empty() || quote.bid_price_ticks <= 0 || quote.ask_price_ticks <= 0 ||
@@ -69,44 +103,18 @@ bool FixAdapterV1::parse_fields(
     if (!out_fields || raw.empty()) return false;
 
     out_fields->clear();
-    size_t start = 0;
-    while (start < raw.size()) {
-        size_t end = raw.find(delimiter, start);
-        if (end == std::string::npos) end = raw.size();
-
-        if (end > start) {
-            const std::string token = raw.substr(start, end - start);
-            const size_t eq = token.find('=');
-            if (eq != std::string::npos && eq > 0) {
-                const int tag = std::atoi(token.substr(0, eq).c_str());
-                if (tag > 0) {
-                    (*out_fields)[tag] = token.substr(eq + 1);
-                }
-            }
-        }
-
-        if (end == raw.size()) break;
-        start = end + 1;
+    size_t cursor = 0;
+    FixField field;
+    while (fix_next_field(raw.data(), raw.size(), delimiter, &cursor, &field)) {
+        (*out_fields)[static_cast<int>(field.tag)].assign(raw, field.offset, field.length);
     }
-
     return !out_fields->empty();
 }
 
 std::string FixAdapterV1::normalize_symbol(const std::string& raw_symbol) {
-    std::string compact;
-    compact.reserve(raw_symbol.size());
-    for (char c : raw_symbol) {
-        if (c == '/' || c == '-' || c == '_' || c == ' ') continue;
-        compact.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(c))));
-    }
-
-    if (compact.size() == 6) {
-        return compact.substr(0, 3) + "/" + compact.substr(3, 3);
-    }
-    if (compact.size() >= 7 && compact.rfind("USDT") == compact.size() - 4) {
-        return compact.substr(0, compact.size() - 4) + "/USDT";
-    }
-    return compact;
+    std::string out(raw_symbol.size() + 1, '\0');
+    out.resize(normalize_symbol_into(raw_symbol, out.data(), out.size()));
+    return out;
 }
 
 } // namespace argentum::gateway
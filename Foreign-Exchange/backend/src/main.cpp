@@ -22,12 +22,23 @@
 #include "audit/logger.hpp"
 #include "api/market_gateway.hpp"
 #include "api/http_ws_server.hpp"
+#include "core/symbol_alias_table.hpp"
 
 int main() {
     // 1. System Init
     argentum::system::pin_thread_to_core(0);
     argentum::audit::Logger::instance().log(argentum::audit::LogLevel::INFO, "System Booting...");
 
+    // Venue symbol spellings resolve through one perfect-hash probe once the table is built.
+    auto& aliases = argentum::core::symbol_aliases();
+    for (const char* instrument : {"BTC/USDT", "ETH/USDT", "USD/ARS", "ARS/USD", "USDT/ARS", "EUR/USD"}) {
+        aliases.add_instrument(instrument);
+    }
+    aliases.add_alias("XBTUSDT", "BTC/USDT");
+    if (!aliases.build()) {
+        argentum::audit::Logger::instance().log(argentum::audit::LogLevel::WARN, "Symbol alias table has conflicting spellings");
+    }
+
     // 2. Alert System
     argentum::alerts::AlertSystem alerts;
     alerts.register_handler(argentum::alerts::AlertSystem::console_handler);
@@ -45,13 +56,17 @@ int main() {
     argentum::persist::DataWriterService writer;
     writer.set_max_batch(256);
     writer.set_flush_interval_ms(50);
+    if (const char* shards_env = std::getenv("ARGENTUM_WRITER_SHARDS")) {
+        const long parsed = std::strtol(shards_env, nullptr, 10);
+        if (parsed > 0 && parsed <= 64) {
+            writer.set_shard_count(static_cast<size_t>(parsed));
+        }
+    }
     writer.start();
 
-    bus->subscribe("market.ticks", [&](const void* data, size_t size) {
-        MarketTick tick{};
-        if (argentum::codec::decode_market_tick(data, size, &tick) != ARGENTUM_OK) return;
-        writer.enqueue(tick);
-    });
+    // Typed topic: the tick is decoded at most once per process and shared by all subscribers.
+    argentum::bus::MarketTickTopic market_ticks(bus, "market.ticks");
+    market_ticks.subscribe([&](const MarketTick& tick) { writer.enqueue(tick); });
 
     auto book = std::make_shared<argentum::engine::OrderBook>("BTC/USDT");
     auto risk = std::make_shared<argentum::risk::RiskManager>(argentum::risk::RiskLimits{
@@ -102,22 +117,7 @@ int main() {
         std::strncpy(tick.symbol, "BTC/USDT", sizeof(tick.symbol) - 1);
         std::strncpy(tick.source, "BINANCE", sizeof(tick.source) - 1);
         tick.side = SIDE_BUY;
-        std::vector<uint8_t> payload;
-        bool published_ok = false;
-#ifdef ARGENTUM_USE_FLATBUFFERS
-        if (argentum::codec::encode_market_tick_flatbuffers(tick, &payload, false) == ARGENTUM_OK) {
-            if (bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK) {
-                published_ok = true;
-            }
-        }
-#else
-        if (argentum::codec::encode_market_tick_legacy(tick, &payload) == ARGENTUM_OK) {
-            if (bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK) {
-                published_ok = true;
-            }
-        }
-#endif
-        if (published_ok) {
+        if (market_ticks.publish(tick) == ARGENTUM_OK) {
             published = 1;
         }
     }
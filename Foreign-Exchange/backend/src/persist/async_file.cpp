@@ -0,0 +1,506 @@
+#include "persist/async_file.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#include <malloc.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#if defined(ARGENTUM_USE_IO_URING) && defined(__linux__)
+#include <atomic>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define ARGENTUM_HAVE_IO_URING 1
+#endif
+#endif
+
+namespace argentum::persist {
+
+namespace {
+
+constexpr size_t kPageSize = 4096;
+
+uint8_t* allocate_aligned(size_t bytes) {
+#ifdef _WIN32
+    return static_cast<uint8_t*>(::_aligned_malloc(bytes, kPageSize));
+#else
+    return static_cast<uint8_t*>(std::aligned_alloc(kPageSize, bytes));
+#endif
+}
+
+void free_aligned(uint8_t* ptr) {
+#ifdef _WIN32
+    ::_aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#ifndef _WIN32
+// Writes every iovec at `offset`, resuming after short writes.
+bool pwritev_all(int fd, struct iovec* iov, int count, uint64_t offset) {
+    while (count > 0) {
+        const ssize_t written = ::pwritev(fd, iov, count, static_cast<off_t>(offset));
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        offset += static_cast<uint64_t>(written);
+        size_t left = static_cast<size_t>(written);
+        while (count > 0 && left >= iov->iov_len) {
+            left -= iov->iov_len;
+            ++iov;
+            --count;
+        }
+        if (count > 0) {
+            iov->iov_base = static_cast<uint8_t*>(iov->iov_base) + left;
+            iov->iov_len -= left;
+        }
+    }
+    return true;
+}
+#endif
+
+} // namespace
+
+#ifdef ARGENTUM_HAVE_IO_URING
+
+constexpr uint64_t kSyncTag = ~0ULL;
+
+struct AsyncFile::Uring {
+    int fd = -1;
+    void* sq_ring = nullptr;
+    size_t sq_ring_bytes = 0;
+    void* cq_ring = nullptr;
+    size_t cq_ring_bytes = 0;
+    io_uring_sqe* sqes = nullptr;
+    size_t sqes_bytes = 0;
+
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned sq_mask = 0;
+    unsigned sq_entries = 0;
+    unsigned* sq_array = nullptr;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned cq_mask = 0;
+    io_uring_cqe* cqes = nullptr;
+
+    bool fixed_buffers = false;
+    unsigned to_submit = 0;
+    unsigned in_flight = 0;
+
+    ~Uring() {
+        if (sqes) ::munmap(sqes, sqes_bytes);
+        if (cq_ring && cq_ring != sq_ring) ::munmap(cq_ring, cq_ring_bytes);
+        if (sq_ring) ::munmap(sq_ring, sq_ring_bytes);
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool setup(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) return false;
+
+        sq_ring_bytes = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_bytes = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            sq_ring_bytes = cq_ring_bytes = std::max(sq_ring_bytes, cq_ring_bytes);
+        }
+        sq_ring = ::mmap(nullptr, sq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (sq_ring == MAP_FAILED) {
+            sq_ring = nullptr;
+            return false;
+        }
+        if (single_mmap) {
+            cq_ring = sq_ring;
+        } else {
+            cq_ring = ::mmap(nullptr, cq_ring_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (cq_ring == MAP_FAILED) {
+                cq_ring = nullptr;
+                return false;
+            }
+        }
+        sqes_bytes = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes_map = ::mmap(nullptr, sqes_bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqes_map == MAP_FAILED) return false;
+        sqes = static_cast<io_uring_sqe*>(sqes_map);
+
+        auto* sq = static_cast<uint8_t*>(sq_ring);
+        sq_head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries = params.sq_entries;
+        sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        auto* cq = static_cast<uint8_t*>(cq_ring);
+        cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    bool register_buffers(uint8_t* base, size_t buffer_bytes, size_t count) {
+        std::vector<struct iovec> iov(count);
+        for (size_t i = 0; i < count; ++i) {
+            iov[i].iov_base = base + i * buffer_bytes;
+            iov[i].iov_len = buffer_bytes;
+        }
+        fixed_buffers = ::syscall(__NR_io_uring_register, fd, IORING_REGISTER_BUFFERS, iov.data(), static_cast<unsigned>(count)) == 0;
+        return fixed_buffers;
+    }
+
+    // Only this thread writes the SQ tail; the kernel advances the head.
+    io_uring_sqe* next_sqe() {
+        const unsigned tail = *sq_tail;
+        if (tail - std::atomic_ref<unsigned>(*sq_head).load(std::memory_order_acquire) >= sq_entries) return nullptr;
+        const unsigned index = tail & sq_mask;
+        sq_array[index] = index;
+        io_uring_sqe* sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    void queue() {
+        std::atomic_ref<unsigned>(*sq_tail).store(*sq_tail + 1, std::memory_order_release);
+        ++to_submit;
+        ++in_flight;
+    }
+
+    // Submits queued entries and, if min_complete > 0, waits for that many completions.
+    bool enter(unsigned min_complete) {
+        for (;;) {
+            const unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+            const long ret = ::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0);
+            if (ret >= 0) {
+                to_submit -= std::min(to_submit, static_cast<unsigned>(ret));
+                return true;
+            }
+            if (errno != EINTR) return false;
+        }
+    }
+};
+
+#else
+
+struct AsyncFile::Uring {};
+
+#endif
+
+AsyncFile::AsyncFile(AsyncFileConfig config) : config_(config) {
+    if (config_.buffer_count == 0) config_.buffer_count = 1;
+    if (config_.buffer_bytes == 0) config_.buffer_bytes = kPageSize;
+}
+
+AsyncFile::~AsyncFile() {
+    close();
+    uring_.reset();
+    free_aligned(buffers_);
+}
+
+bool AsyncFile::ensure_buffers() {
+    if (buffers_) return true;
+    buffer_bytes_ = (config_.buffer_bytes + kPageSize - 1) / kPageSize * kPageSize;
+    buffers_ = allocate_aligned(buffer_bytes_ * config_.buffer_count);
+    if (!buffers_) return false;
+    lengths_.assign(config_.buffer_count, 0);
+    free_.clear();
+    for (size_t i = config_.buffer_count; i > 0; --i) free_.push_back(static_cast<uint32_t>(i - 1));
+
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (config_.use_io_uring && !uring_tried_) {
+        uring_tried_ = true;
+        auto uring = std::make_unique<Uring>();
+        // Room for every buffer in flight plus the syncs queued behind them.
+        const unsigned entries = static_cast<unsigned>(config_.buffer_count * 2 + 2);
+        if (uring->setup(entries)) {
+            // Unregistered buffers (e.g. RLIMIT_MEMLOCK) still work with plain WRITE.
+            uring->register_buffers(buffers_, buffer_bytes_, config_.buffer_count);
+            uring_ = std::move(uring);
+            backend_ = AsyncFileBackend::IoUring;
+        }
+    }
+#endif
+    return true;
+}
+
+bool AsyncFile::open(const std::string& path, bool truncate) {
+    close();
+    if (!ensure_buffers()) return false;
+#ifdef _WIN32
+    const int flags = _O_WRONLY | _O_CREAT | _O_BINARY | (truncate ? _O_TRUNC : 0);
+    fd_ = ::_open(path.c_str(), flags, _S_IREAD | _S_IWRITE);
+    if (fd_ < 0) return false;
+    offset_ = static_cast<uint64_t>(::_lseeki64(fd_, 0, SEEK_END));
+#else
+    // No O_APPEND: every write carries its own offset, which O_APPEND would override.
+    const int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0);
+    fd_ = ::open(path.c_str(), flags, 0644);
+    if (fd_ < 0) return false;
+    struct stat st;
+    offset_ = (::fstat(fd_, &st) == 0) ? static_cast<uint64_t>(st.st_size) : 0;
+#endif
+    pending_offset_ = offset_;
+    current_ = -1;
+    fill_ = 0;
+    return true;
+}
+
+bool AsyncFile::write(const void* data, size_t size) {
+    if (fd_ < 0) return false;
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        if (current_ < 0 && !acquire_buffer()) return false;
+        const size_t n = std::min(size, buffer_bytes_ - fill_);
+        std::memcpy(buffer(static_cast<uint32_t>(current_)) + fill_, bytes, n);
+        fill_ += n;
+        bytes += n;
+        size -= n;
+        if (fill_ == buffer_bytes_) {
+            submit_current(false);
+#ifdef ARGENTUM_HAVE_IO_URING
+            if (uring_ && !uring_->enter(0)) ++stats_.failed;
+#endif
+        }
+    }
+    return true;
+}
+
+bool AsyncFile::acquire_buffer() {
+    if (free_.empty()) {
+        ++stats_.buffer_waits;
+#ifdef ARGENTUM_HAVE_IO_URING
+        if (uring_) {
+            while (free_.empty()) {
+                if (!reap(true)) return false;
+            }
+        }
+#endif
+        if (!uring_) write_pending();
+        if (free_.empty()) return false;
+    }
+    current_ = free_.back();
+    free_.pop_back();
+    fill_ = 0;
+    return true;
+}
+
+// Drains the completion queue; with `block`, first waits for at least one completion.
+bool AsyncFile::reap(bool block) {
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (!uring_) return false;
+    Uring& ring = *uring_;
+    if (block && !ring.enter(1)) return false;
+    const unsigned tail = std::atomic_ref<unsigned>(*ring.cq_tail).load(std::memory_order_acquire);
+    unsigned head = *ring.cq_head;
+    for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = ring.cqes[head & ring.cq_mask];
+        --ring.in_flight;
+        if (cqe.user_data == kSyncTag) {
+            // -ECANCELED when the linked write before it failed.
+            if (cqe.res < 0) {
+                ++stats_.failed;
+            } else {
+                ++stats_.syncs;
+            }
+        } else {
+            complete_write(static_cast<uint32_t>(cqe.user_data), cqe.res);
+        }
+    }
+    std::atomic_ref<unsigned>(*ring.cq_head).store(head, std::memory_order_release);
+    return true;
+#else
+    (void)block;
+    return false;
+#endif
+}
+
+void AsyncFile::complete_write(uint32_t index, int64_t result) {
+    if (result == static_cast<int64_t>(lengths_[index])) {
+        stats_.bytes_written += static_cast<uint64_t>(result);
+    } else {
+        ++stats_.failed;
+    }
+    lengths_[index] = 0;
+    free_.push_back(index);
+}
+
+// Hands the current buffer to the backend. With io_uring the write is only queued;
+// the caller submits it (together with a linked sync, if any).
+void AsyncFile::submit_current(bool link_sync) {
+    if (current_ < 0) return;
+    const uint32_t index = static_cast<uint32_t>(current_);
+    if (fill_ == 0) {
+        free_.push_back(index);
+        current_ = -1;
+        return;
+    }
+    lengths_[index] = static_cast<uint32_t>(fill_);
+    ++stats_.writes;
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (uring_) {
+        // Bounds the completions outstanding, so the completion queue cannot overflow.
+        while (uring_->in_flight >= uring_->sq_entries && reap(true)) {
+        }
+        io_uring_sqe* sqe = uring_->next_sqe();
+        while (!sqe) {
+            // Every entry is queued or in flight: push them to the kernel and retry.
+            if (!uring_->enter(uring_->in_flight > uring_->to_submit ? 1 : 0)) break;
+            reap(false);
+            sqe = uring_->next_sqe();
+        }
+        if (!sqe) {
+            complete_write(index, -1);
+        } else {
+            sqe->opcode = uring_->fixed_buffers ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE;
+            sqe->fd = fd_;
+            sqe->addr = reinterpret_cast<uint64_t>(buffer(index));
+            sqe->len = static_cast<uint32_t>(fill_);
+            sqe->off = offset_;
+            sqe->buf_index = static_cast<uint16_t>(index);
+            sqe->user_data = index;
+            if (link_sync) sqe->flags = IOSQE_IO_LINK | IOSQE_IO_DRAIN;
+            uring_->queue();
+        }
+        offset_ += fill_;
+        current_ = -1;
+        fill_ = 0;
+        return;
+    }
+#else
+    (void)link_sync;
+#endif
+    pending_.emplace_back(index, static_cast<uint32_t>(fill_));
+    offset_ += fill_;
+    current_ = -1;
+    fill_ = 0;
+}
+
+// pwritev backend: one gathered write for every full buffer, then they are free again.
+void AsyncFile::write_pending() {
+    if (pending_.empty()) return;
+    bool ok = true;
+#ifdef _WIN32
+    ok = ::_lseeki64(fd_, static_cast<__int64>(pending_offset_), SEEK_SET) >= 0;
+    for (const auto& [index, length] : pending_) {
+        if (!ok) break;
+        ok = ::_write(fd_, buffer(index), length) == static_cast<int>(length);
+    }
+#else
+    std::vector<struct iovec> iov(pending_.size());
+    for (size_t i = 0; i < pending_.size(); ++i) {
+        iov[i].iov_base = buffer(pending_[i].first);
+        iov[i].iov_len = pending_[i].second;
+    }
+    ok = pwritev_all(fd_, iov.data(), static_cast<int>(iov.size()), pending_offset_);
+#endif
+    for (const auto& [index, length] : pending_) {
+        complete_write(index, ok ? static_cast<int64_t>(length) : -1);
+        pending_offset_ += length;
+    }
+    pending_.clear();
+}
+
+void AsyncFile::flush() {
+    if (fd_ < 0) return;
+    submit_current(false);
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (uring_) {
+        if (!uring_->enter(0)) ++stats_.failed;
+        reap(false);
+        return;
+    }
+#endif
+    write_pending();
+}
+
+void AsyncFile::sync() {
+    if (fd_ < 0) return;
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (uring_) {
+        // The last write (if any) drains everything before it and is linked to the sync;
+        // without one, the sync itself drains.
+        const bool linked = current_ >= 0 && fill_ > 0;
+        submit_current(linked);
+        // Bounds the completions outstanding, so the completion queue cannot overflow.
+        while (uring_->in_flight >= uring_->sq_entries && reap(true)) {
+        }
+        io_uring_sqe* sqe = uring_->next_sqe();
+        while (!sqe) {
+            if (!uring_->enter(uring_->in_flight > uring_->to_submit ? 1 : 0)) break;
+            reap(false);
+            sqe = uring_->next_sqe();
+        }
+        if (!sqe) {
+            ++stats_.failed;
+            return;
+        }
+        sqe->opcode = IORING_OP_FSYNC;
+        sqe->fd = fd_;
+        sqe->fsync_flags = IORING_FSYNC_DATASYNC;
+        sqe->user_data = kSyncTag;
+        if (!linked) sqe->flags = IOSQE_IO_DRAIN;
+        uring_->queue();
+        if (!uring_->enter(0)) ++stats_.failed;
+        reap(false);
+        return;
+    }
+#endif
+    submit_current(false);
+    write_pending();
+#ifdef _WIN32
+    const bool ok = ::_commit(fd_) == 0;
+#elif defined(__APPLE__)
+    const bool ok = ::fsync(fd_) == 0;
+#else
+    const bool ok = ::fdatasync(fd_) == 0;
+#endif
+    if (ok) {
+        ++stats_.syncs;
+    } else {
+        ++stats_.failed;
+    }
+}
+
+bool AsyncFile::wait() {
+    flush();
+#ifdef ARGENTUM_HAVE_IO_URING
+    if (uring_) {
+        while (uring_->in_flight > 0) {
+            if (!reap(true)) {
+                ++stats_.failed;
+                break;
+            }
+        }
+    }
+#endif
+    const bool ok = stats_.failed == failed_reported_;
+    failed_reported_ = stats_.failed;
+    return ok;
+}
+
+bool AsyncFile::close() {
+    if (fd_ < 0) return true;
+    const bool ok = wait();
+#ifdef _WIN32
+    ::_close(fd_);
+#else
+    ::close(fd_);
+#endif
+    fd_ = -1;
+    return ok;
+}
+
+} // namespace argentum::persist
@@ -3,24 +3,43 @@
 #include <chrono>
 #include <thread>
 #include <filesystem>
+#include <functional>
 #include <cstdio>
 #include <sstream>
 #include <algorithm>
 #include <system_error>
-#include <cstdio>
-#ifdef _WIN32
-#include <io.h>
-#else
-#include <unistd.h>
-#endif
 
+#include "bus/wait_strategy.hpp"
+#include "core/checksum.hpp"
 #include "core/time_utils.hpp"
 #ifdef ARGENTUM_USE_LIBPQ
 #include <libpq-fe.h>
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
 #endif
 
 namespace argentum::persist {
 
+namespace {
+
+size_t bounded_length(const char* text, size_t capacity) {
+    size_t n = 0;
+    while (n < capacity && text[n] != '\0') ++n;
+    return n;
+}
+
+// "data/market_ticks.csv" -> "data/market_ticks.2.csv" for shard 2 of several.
+std::string shard_csv_path(const std::string& path, size_t shard, size_t shard_count) {
+    if (shard_count <= 1) return path;
+    const std::filesystem::path base(path);
+    return (base.parent_path() / (base.stem().string() + "." + std::to_string(shard) + base.extension().string())).string();
+}
+
+} // namespace
+
 DataWriterService::DataWriterService(std::string connection_string)
     : connection_string_(std::move(connection_string)) {}
 
@@ -29,23 +48,47 @@ DataWriterService::~DataWriterService() {
 }
 
 void DataWriterService::start() {
+    if (running_.load()) return;
+    if (shards_.empty()) {
+        shards_.reserve(shard_count_);
+        for (size_t i = 0; i < shard_count_; ++i) {
+            auto shard = std::make_unique<Shard>();
+            shard->index = i;
+            shard->ring = std::make_unique<core::MpscRing<MarketTick>>(queue_capacity_, max_batch_);
+            shards_.push_back(std::move(shard));
+        }
+    }
+    for (auto& shard : shards_) {
+        shard->csv_path = shard_csv_path(csv_path_, shard->index, shards_.size());
+    }
     if (running_.exchange(true)) return;
-    worker_ = std::thread(&DataWriterService::worker_loop, this);
+    for (auto& shard : shards_) {
+        shard->worker = std::thread(&DataWriterService::worker_loop, this, std::ref(*shard));
+    }
 }
 
 void DataWriterService::stop() {
     if (!running_.exchange(false)) return;
-    cv_.notify_all();
-    cv_space_.notify_all();
-    if (worker_.joinable()) {
-        worker_.join();
+    for (auto& shard : shards_) {
+        std::lock_guard lock(shard->wake_mutex);
+        shard->cv.notify_all();
+        shard->cv_space.notify_all();
     }
+    for (auto& shard : shards_) {
+        if (shard->worker.joinable()) {
+            shard->worker.join();
+        }
 #ifdef ARGENTUM_USE_LIBPQ
-    if (pg_conn_) {
-        PQfinish(pg_conn_);
-        pg_conn_ = nullptr;
-    }
+        if (shard->pg_conn) {
+            PQfinish(shard->pg_conn);
+            shard->pg_conn = nullptr;
+        }
 #endif
+    }
+}
+
+void DataWriterService::set_shard_count(size_t shards) {
+    shard_count_ = (shards == 0) ? 1 : shards;
 }
 
 void DataWriterService::set_max_batch(size_t max_batch) {
@@ -64,6 +107,22 @@ void DataWriterService::set_overflow_policy(OverflowPolicy policy) {
     overflow_policy_ = policy;
 }
 
+void DataWriterService::set_block_spin_budget(uint32_t spins) {
+    block_spin_budget_ = spins;
+}
+
+void DataWriterService::set_local_format(LocalFormat format) {
+    local_format_ = format;
+}
+
+void DataWriterService::set_tick_store_path(std::string root) {
+    tick_store_path_ = std::move(root);
+}
+
+void DataWriterService::set_tick_store_config(const TickStoreConfig& config) {
+    tick_store_config_ = config;
+}
+
 void DataWriterService::set_csv_path(std::string path) {
     csv_path_ = std::move(path);
 }
@@ -76,187 +135,395 @@ void DataWriterService::set_csv_fsync(bool enabled) {
     csv_fsync_ = enabled;
 }
 
+void DataWriterService::set_file_config(const AsyncFileConfig& config) {
+    file_config_ = config;
+}
+
+size_t DataWriterService::shard_count() const {
+    return shards_.empty() ? shard_count_ : shards_.size();
+}
+
+size_t DataWriterService::shard_for(const MarketTick& tick) const {
+    const size_t shards = shard_count();
+    if (shards == 1) return 0;
+    // Hash the tick store directory spelling, so symbols that share a directory
+    // ("EUR/USD", "EUR-USD") also share the one writer that owns it.
+    char key[sizeof(tick.symbol)];
+    const size_t length = bounded_length(tick.symbol, sizeof(tick.symbol));
+    for (size_t i = 0; i < length; ++i) key[i] = tick_store_dir_char(tick.symbol[i]);
+    const uint32_t hash = core::xxhash32(key, length);
+    return static_cast<size_t>(hash % shards);
+}
+
+DataWriterShardStats DataWriterService::shard_stats(size_t shard) const {
+    DataWriterShardStats out{};
+    if (shard >= shards_.size()) return out;
+    const Shard& s = *shards_[shard];
+    out.queued = s.ring->size();
+    out.written = s.written.load(std::memory_order_relaxed);
+    out.dropped = s.dropped.load(std::memory_order_relaxed);
+    out.failed_flushes = s.failed_flushes.load(std::memory_order_relaxed);
+    return out;
+}
+
+DataWriterShardStats DataWriterService::stats() const {
+    DataWriterShardStats total{};
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        const DataWriterShardStats shard = shard_stats(i);
+        total.queued += shard.queued;
+        total.written += shard.written;
+        total.dropped += shard.dropped;
+        total.failed_flushes += shard.failed_flushes;
+    }
+    return total;
+}
+
 uint64_t DataWriterService::dropped_count() const {
-    return dropped_.load(std::memory_order_relaxed);
+    return stats().dropped;
 }
 
 uint64_t DataWriterService::failed_flush_count() const {
-    return failed_flushes_.load(std::memory_order_relaxed);
+    return stats().failed_flushes;
+}
+
+uint64_t DataWriterService::dropped_count(size_t shard) const {
+    return shard_stats(shard).dropped;
+}
+
+uint64_t DataWriterService::failed_flush_count(size_t shard) const {
+    return shard_stats(shard).failed_flushes;
 }
 
 void DataWriterService::enqueue(const MarketTick& tick) {
-    std::unique_lock lock(mutex_);
-    if (!running_) return;
-    if (queue_.size() >= queue_capacity_) {
-        switch (overflow_policy_) {
-            case OverflowPolicy::DropNewest:
-                dropped_.fetch_add(1, std::memory_order_relaxed);
-                return;
-            case OverflowPolicy::DropOldest:
-                if (!queue_.empty()) {
-                    queue_.pop_front();
-                    dropped_.fetch_add(1, std::memory_order_relaxed);
-                }
-                break;
-            case OverflowPolicy::Block:
-                cv_space_.wait(lock, [&] {
-                    return !running_ || queue_.size() < queue_capacity_;
-                });
-                if (!running_) return;
-                break;
-        }
-    }
-    queue_.push_back(tick);
-    if (queue_.size() >= max_batch_ || queue_.size() == 1) {
-        cv_.notify_one();
-    }
+    if (!running_.load(std::memory_order_acquire)) return;
+    Shard& shard = *shards_[shard_for(tick)];
+    if (push(shard, tick)) wake_worker(shard);
 }
 
 void DataWriterService::enqueue_batch(const MarketTick* ticks, size_t count) {
     if (!ticks || count == 0) return;
-    std::unique_lock lock(mutex_);
-    if (!running_) return;
+    if (!running_.load(std::memory_order_acquire)) return;
+    // One wake-up per shard touched, after the whole batch is queued.
+    constexpr size_t kMaxTracked = 64;
+    bool touched[kMaxTracked] = {};
+    const bool track = shards_.size() <= kMaxTracked;
     for (size_t i = 0; i < count; ++i) {
-        if (queue_.size() >= queue_capacity_) {
-            switch (overflow_policy_) {
-                case OverflowPolicy::DropNewest:
-                    dropped_.fetch_add(1, std::memory_order_relaxed);
-                    continue;
-                case OverflowPolicy::DropOldest:
-                    if (!queue_.empty()) {
-                        queue_.pop_front();
-                        dropped_.fetch_add(1, std::memory_order_relaxed);
-                    }
-                    break;
-                case OverflowPolicy::Block:
-                    cv_space_.wait(lock, [&] {
-                        return !running_ || queue_.size() < queue_capacity_;
-                    });
-                    if (!running_) return;
-                    break;
+        const size_t index = shard_for(ticks[i]);
+        Shard& shard = *shards_[index];
+        if (push(shard, ticks[i])) {
+            if (track) {
+                touched[index] = true;
+            } else {
+                wake_worker(shard);
             }
+        } else if (!running_.load(std::memory_order_acquire)) {
+            break;
         }
-        queue_.push_back(ticks[i]);
     }
-    if (queue_.size() >= max_batch_ || !queue_.empty()) {
-        cv_.notify_one();
+    if (!track) return;
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        if (touched[i]) wake_worker(*shards_[i]);
     }
 }
 
-void DataWriterService::worker_loop() {
-    using namespace std::chrono;
-    std::vector<MarketTick> batch;
+// Returns true if the tick was queued; drops are counted here.
+bool DataWriterService::push(Shard& shard, const MarketTick& tick) {
+    switch (overflow_policy_) {
+        case OverflowPolicy::DropNewest:
+            if (shard.ring->try_push(tick)) return true;
+            shard.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        case OverflowPolicy::DropOldest: {
+            uint64_t evicted = 0;
+            // Only fails while the worker holds every queued tick; the newest is dropped then.
+            const bool pushed = shard.ring->push_evict(tick, &evicted);
+            if (!pushed) ++evicted;
+            if (evicted > 0) shard.dropped.fetch_add(evicted, std::memory_order_relaxed);
+            return pushed;
+        }
+        case OverflowPolicy::Block:
+            return shard.ring->try_push(tick) || push_blocking(shard, tick);
+    }
+    return false;
+}
 
-    while (running_ || !queue_.empty()) {
-        {
-            std::unique_lock lock(mutex_);
-            cv_.wait_for(lock, milliseconds(flush_interval_ms_), [&] {
-                return !queue_.empty() || !running_;
-            });
-            if (queue_.empty()) {
-                continue;
-            }
-            size_t count = std::min(max_batch_, queue_.size());
-            batch.clear();
-            batch.reserve(count);
-            for (size_t i = 0; i < count; ++i) {
-                batch.push_back(queue_.front());
-                queue_.pop_front();
+// Spins for block_spin_budget_ pauses, then parks until the worker releases slots or
+// the service stops.
+bool DataWriterService::push_blocking(Shard& shard, const MarketTick& tick) {
+    for (uint32_t spin = 0; spin < block_spin_budget_; ++spin) {
+        if (!running_.load(std::memory_order_acquire)) return false;
+        argentum::bus::cpu_relax();
+        if (shard.ring->try_push(tick)) return true;
+    }
+    shard.space_waiters.fetch_add(1, std::memory_order_seq_cst);
+    bool pushed = false;
+    {
+        std::unique_lock lock(shard.wake_mutex);
+        while (running_.load(std::memory_order_acquire)) {
+            if (shard.ring->try_push(tick)) {
+                pushed = true;
+                break;
             }
-            cv_space_.notify_all();
+            shard.cv_space.wait_for(lock, std::chrono::milliseconds(flush_interval_ms_));
         }
+    }
+    shard.space_waiters.fetch_sub(1, std::memory_order_relaxed);
+    return pushed;
+}
 
-        if (!batch.empty()) {
-            flush_batch(batch);
-        }
+void DataWriterService::wake_worker(Shard& shard) {
+    // Pairs with the fence in worker_loop(): either the worker sees the tick before it
+    // parks, or this sees worker_waiting and notifies under the lock.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (shard.worker_waiting.load(std::memory_order_relaxed)) {
+        std::lock_guard lock(shard.wake_mutex);
+        shard.cv.notify_one();
     }
 }
 
-void DataWriterService::flush_batch(std::vector<MarketTick>& batch) {
+void DataWriterService::worker_loop(Shard& shard) {
+    using namespace std::chrono;
+    core::MpscRing<MarketTick>& ring = *shard.ring;
+
+    while (running_ || !ring.empty()) {
+        // Flushed straight from the ring slots, which stay claimed until the flush returns.
+        const std::span<MarketTick> batch = ring.claim(max_batch_);
+        if (batch.empty()) {
+            std::unique_lock lock(shard.wake_mutex);
+            shard.worker_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            shard.cv.wait_for(lock, milliseconds(flush_interval_ms_), [&] {
+                return !ring.empty() || !running_;
+            });
+            shard.worker_waiting.store(false, std::memory_order_relaxed);
 #ifdef ARGENTUM_USE_LIBPQ
-    if (!pg_conn_ || PQstatus(pg_conn_) != CONNECTION_OK) {
-        if (pg_conn_) {
-            PQfinish(pg_conn_);
-            pg_conn_ = nullptr;
-        }
-        pg_conn_ = PQconnectdb(connection_string_.c_str());
-        if (!pg_conn_ || PQstatus(pg_conn_) != CONNECTION_OK) {
-            if (pg_conn_) {
-                PQfinish(pg_conn_);
-                pg_conn_ = nullptr;
+            // Idle: read the last COPY's result now rather than with the next batch.
+            if (ring.empty()) finish_pending_copy(shard, true);
+#endif
+        } else {
+            flush_batch(shard, batch);
+            shard.written.fetch_add(batch.size(), std::memory_order_relaxed);
+            ring.release(batch.size());
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (shard.space_waiters.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard lock(shard.wake_mutex);
+                shard.cv_space.notify_all();
             }
-            failed_flushes_.fetch_add(1, std::memory_order_relaxed);
-            flush_csv(batch);
-            std::this_thread::sleep_for(std::chrono::milliseconds(reconnect_backoff_ms_));
-            reconnect_backoff_ms_ = std::min(reconnect_backoff_ms_ * 2, reconnect_backoff_max_ms_);
-            return;
+#ifdef ARGENTUM_USE_LIBPQ
+            // Pick up the COPY's result if it is already here, so the next flush_batch
+            // does not have to wait for it.
+            finish_pending_copy(shard, false);
+#endif
+        }
+        // Quiet symbols still reach disk within max_open_ns.
+        if (shard.tick_store) {
+            shard.tick_store->seal_expired(argentum::core::now_ns());
         }
-        reconnect_backoff_ms_ = 250;
     }
+#ifdef ARGENTUM_USE_LIBPQ
+    finish_pending_copy(shard, true);
+#endif
+    close_local(shard);
+}
 
-    PGresult* res = PQexec(pg_conn_,
-        "COPY market_ticks (time, symbol, price, volume, side, source) "
-        "FROM STDIN WITH (FORMAT csv)");
-    if (!res || PQresultStatus(res) != PGRES_COPY_IN) {
-        if (res) PQclear(res);
-        failed_flushes_.fetch_add(1, std::memory_order_relaxed);
-        flush_csv(batch);
-        return;
+#ifdef ARGENTUM_USE_LIBPQ
+
+namespace {
+
+constexpr size_t kCopyChunkBytes = 64 * 1024;
+
+// Waits until the connection's socket is writable (or readable, so the server's replies
+// keep draining), for at most `timeout_ms`.
+bool wait_pg_socket(PGconn* conn, int timeout_ms) {
+    const int fd = PQsocket(conn);
+    if (fd < 0) return false;
+#ifdef _WIN32
+    WSAPOLLFD pfd{};
+    pfd.fd = static_cast<SOCKET>(fd);
+    pfd.events = POLLWRNORM | POLLRDNORM;
+    return ::WSAPoll(&pfd, 1, timeout_ms) >= 0;
+#else
+    pollfd pfd{};
+    pfd.fd = fd;
+    pfd.events = POLLOUT | POLLIN;
+    return ::poll(&pfd, 1, timeout_ms) >= 0;
+#endif
+}
+
+// Pushes libpq's output buffer to the socket (non-blocking connection).
+bool flush_pg(PGconn* conn) {
+    for (;;) {
+        const int rc = PQflush(conn);
+        if (rc == 0) return true;
+        if (rc < 0) return false;
+        if (!wait_pg_socket(conn, 100)) return false;
+        if (PQconsumeInput(conn) == 0) return false;
     }
-    PQclear(res);
+}
 
-    char line[320];
-    char ts_buf[64];
-    bool copy_failed = false;
-    for (const auto& tick : batch) {
-        argentum::core::format_utc(tick.timestamp_ns, ts_buf, sizeof(ts_buf));
-        int written = snprintf(line, sizeof(line),
-            "%s,%s,%.10f,%.10f,%c,%s\n",
-            ts_buf,
-            tick.symbol,
-            tick.price,
-            tick.quantity,
-            tick.side == SIDE_BUY ? 'B' : 'S',
-            tick.source);
-        if (written > 0) {
-            if (PQputCopyData(pg_conn_, line, written) != 1) {
-                copy_failed = true;
-                break;
-            }
+} // namespace
+
+bool DataWriterService::ensure_pg(Shard& shard) {
+    if (shard.pg_conn && PQstatus(shard.pg_conn) == CONNECTION_OK) return true;
+    if (shard.pg_conn) {
+        PQfinish(shard.pg_conn);
+        shard.pg_conn = nullptr;
+    }
+    shard.pg_conn = PQconnectdb(connection_string_.c_str());
+    if (!shard.pg_conn || PQstatus(shard.pg_conn) != CONNECTION_OK || PQsetnonblocking(shard.pg_conn, 1) != 0) {
+        if (shard.pg_conn) {
+            PQfinish(shard.pg_conn);
+            shard.pg_conn = nullptr;
         }
+        return false;
     }
-    if (PQputCopyEnd(pg_conn_, copy_failed ? "copy data failed" : NULL) != 1) {
-        copy_failed = true;
+    shard.reconnect_backoff_ms = 250;
+    return true;
+}
+
+// Starts a binary COPY and streams the encoded batch, ending with PQputCopyEnd. The
+// result is not read here: the worker polls for it between batches.
+bool DataWriterService::send_copy(Shard& shard) {
+    PGconn* conn = shard.pg_conn;
+    if (!PQsendQuery(conn, "COPY market_ticks (time, symbol, price, volume, side, source) "
+                           "FROM STDIN WITH (FORMAT binary)")) {
+        return false;
+    }
+    if (!flush_pg(conn)) return false;
+    PGresult* res = PQgetResult(conn);
+    const bool copy_in = res && PQresultStatus(res) == PGRES_COPY_IN;
+    if (res) PQclear(res);
+    if (!copy_in) {
+        while ((res = PQgetResult(conn)) != nullptr) PQclear(res);
+        return false;
     }
 
-    bool result_failed = false;
-    while ((res = PQgetResult(pg_conn_)) != NULL) {
-        if (PQresultStatus(res) != PGRES_COMMAND_OK) {
-            result_failed = true;
+    const std::span<const uint8_t> data = shard.copy.data();
+    bool failed = false;
+    for (size_t offset = 0; offset < data.size() && !failed;) {
+        const size_t chunk = std::min(kCopyChunkBytes, data.size() - offset);
+        const int rc = PQputCopyData(conn, reinterpret_cast<const char*>(data.data() + offset), static_cast<int>(chunk));
+        if (rc == 1) {
+            offset += chunk;
+        } else if (rc == 0) {
+            failed = !wait_pg_socket(conn, 100) || !flush_pg(conn);
+        } else {
+            failed = true;
         }
-        PQclear(res);
+    }
+    int rc = 0;
+    while ((rc = PQputCopyEnd(conn, failed ? "copy data failed" : nullptr)) == 0) {
+        if (!wait_pg_socket(conn, 100)) break;
+    }
+    if (rc != 1 || !flush_pg(conn)) failed = true;
+    return !failed;
+}
+
+// Reads the result of the COPY sent for the previous batch; on failure its ticks go to
+// local output instead. Without `wait` it only consumes what the socket already holds
+// and returns with the COPY still pending if the answer is incomplete.
+void DataWriterService::finish_pending_copy(Shard& shard, bool wait) {
+    if (!shard.copy_pending) return;
+    PGconn* conn = shard.pg_conn;
+    if (conn) {
+        // A broken connection makes PQgetResult return at once, so only poll a live one.
+        const bool live = wait || PQconsumeInput(conn) != 0;
+        PGresult* res = nullptr;
+        for (;;) {
+            if (!wait && live && PQisBusy(conn)) return;
+            if ((res = PQgetResult(conn)) == nullptr) break;
+            if (PQresultStatus(res) != PGRES_COMMAND_OK) shard.copy_failed = true;
+            PQclear(res);
+        }
+    } else {
+        shard.copy_failed = true;
+    }
+    const bool failed = shard.copy_failed;
+    shard.copy_pending = false;
+    shard.copy_failed = false;
+    if (failed) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+        flush_local(shard, shard.copy_in_flight);
+    }
+    shard.copy_in_flight.clear();
+}
+
+#endif
+
+void DataWriterService::flush_batch(Shard& shard, std::span<const MarketTick> batch) {
+#ifdef ARGENTUM_USE_LIBPQ
+    // Encode while the previous batch's COPY result may still be on its way. libpq runs
+    // one command at a time and COPY cannot join a pipeline, so that result must be read
+    // before this batch's COPY starts; the worker's poll usually has it already.
+    shard.copy.begin();
+    shard.copy.append_batch(batch);
+    shard.copy.finish();
+    finish_pending_copy(shard, true);
+
+    if (!ensure_pg(shard)) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+        flush_local(shard, batch);
+        std::this_thread::sleep_for(std::chrono::milliseconds(shard.reconnect_backoff_ms));
+        shard.reconnect_backoff_ms = std::min(shard.reconnect_backoff_ms * 2, reconnect_backoff_max_ms_);
+        return;
     }
 
-    if (copy_failed || result_failed) {
-        failed_flushes_.fetch_add(1, std::memory_order_relaxed);
-        flush_csv(batch);
+    if (send_copy(shard)) {
+        // Second buffer: the ring slots are released once this returns.
+        shard.copy_in_flight.assign(batch.begin(), batch.end());
+        shard.copy_pending = true;
+        return;
     }
+    // Drain whatever the server answered so the connection is ready for the next COPY.
+    PGresult* res = nullptr;
+    while ((res = PQgetResult(shard.pg_conn)) != nullptr) PQclear(res);
+    shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+    flush_local(shard, batch);
 #else
-    flush_csv(batch);
+    flush_local(shard, batch);
 #endif
 }
 
-void DataWriterService::flush_csv(std::vector<MarketTick>& batch) {
-    if (batch.empty()) return;
-    std::filesystem::path path(csv_path_);
+void DataWriterService::flush_local(Shard& shard, std::span<const MarketTick> batch) {
+    if (local_format_ == LocalFormat::Csv) {
+        flush_csv(shard, batch);
+    } else {
+        flush_tick_store(shard, batch);
+    }
+}
+
+void DataWriterService::flush_tick_store(Shard& shard, std::span<const MarketTick> batch) {
+    if (!shard.tick_store) {
+        shard.tick_store = std::make_unique<TickStoreWriter>(tick_store_path_, tick_store_config_);
+    }
+    const uint64_t failed_before = shard.tick_store->failed_writes();
+    shard.tick_store->append_batch(batch);
+    if (shard.tick_store->failed_writes() != failed_before) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void DataWriterService::close_local(Shard& shard) {
+    if (shard.tick_store) {
+        if (!shard.tick_store->flush()) shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+        shard.tick_store.reset();
+    }
+    if (shard.csv && shard.csv->is_open() && !shard.csv->close()) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Keeps the file open between batches and tracks its size, so the filesystem is only
+// consulted when the file is (re)opened or rotated.
+bool DataWriterService::open_csv(Shard& shard) {
+    std::filesystem::path path(shard.csv_path);
     std::error_code ec;
     if (!path.parent_path().empty()) {
         std::filesystem::create_directories(path.parent_path(), ec);
     }
 
-    bool write_header = false;
     if (std::filesystem::exists(path, ec) && !ec) {
-        auto size = std::filesystem::file_size(path, ec);
+        const uint64_t size = std::filesystem::file_size(path, ec);
         if (!ec && size >= csv_max_bytes_) {
             auto ts = argentum::core::to_utc(argentum::core::unix_now_ns());
             for (char& c : ts) {
@@ -265,37 +532,55 @@ void DataWriterService::flush_csv(std::vector<MarketTick>& batch) {
             std::filesystem::path rotated = path.parent_path() /
                 (path.stem().string() + "_" + ts + path.extension().string());
             std::filesystem::rename(path, rotated, ec);
-            write_header = true;
         }
-    } else {
-        write_header = true;
     }
 
-    FILE* file = std::fopen(path.string().c_str(), "ab");
-    if (!file) return;
+    if (!shard.csv) shard.csv = std::make_unique<AsyncFile>(file_config_);
+    if (!shard.csv->open(path.string())) return false;
+    if (shard.csv->size() == 0) {
+        static constexpr char kHeader[] = "timestamp_ns,symbol,price,quantity,side,source\n";
+        shard.csv->write(kHeader, sizeof(kHeader) - 1);
+    }
+    return true;
+}
 
-    if (write_header) {
-        std::fputs("timestamp_ns,symbol,price,quantity,side,source\n", file);
+// Lines are queued into the file's buffers; the worker only blocks when every buffer
+// of the file is still being written.
+void DataWriterService::flush_csv(Shard& shard, std::span<const MarketTick> batch) {
+    if (batch.empty()) return;
+    AsyncFile* csv = shard.csv.get();
+    if (csv && csv->is_open() && csv->size() >= csv_max_bytes_) {
+        // Rotation renames the file, so everything queued for it must land first.
+        if (!csv->close()) shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+    }
+    if ((!csv || !csv->is_open()) && !open_csv(shard)) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
+    csv = shard.csv.get();
 
+    const uint64_t failed_before = csv->stats().failed;
+    char line[320];
     for (const auto& tick : batch) {
-        std::fprintf(file, "%llu,%s,%.10f,%.10f,%c,%s\n",
-                     static_cast<unsigned long long>(tick.timestamp_ns),
-                     tick.symbol,
-                     tick.price,
-                     tick.quantity,
-                     (tick.side == SIDE_BUY ? 'B' : 'S'),
-                     tick.source);
-    }
-    std::fflush(file);
+        const int written = std::snprintf(line, sizeof(line), "%llu,%s,%.10f,%.10f,%c,%s\n",
+                                          static_cast<unsigned long long>(tick.timestamp_ns),
+                                          tick.symbol,
+                                          tick.price,
+                                          tick.quantity,
+                                          (tick.side == SIDE_BUY ? 'B' : 'S'),
+                                          tick.source);
+        if (written > 0) {
+            csv->write(line, std::min(static_cast<size_t>(written), sizeof(line) - 1));
+        }
+    }
     if (csv_fsync_) {
-#ifdef _WIN32
-        _commit(_fileno(file));
-#else
-        fsync(fileno(file));
-#endif
+        csv->sync();
+    } else {
+        csv->flush();
+    }
+    if (csv->stats().failed != failed_before) {
+        shard.failed_flushes.fetch_add(1, std::memory_order_relaxed);
     }
-    std::fclose(file);
 }
 
 } // namespace argentum::persist
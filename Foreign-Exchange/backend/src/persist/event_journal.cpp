@@ -1,17 +1,20 @@
 #include "persist/event_journal.hpp"
 
+#include "core/checksum.hpp"
 #include "core/fixed_point.hpp"
 #include "core/time_utils.hpp"
 
 #include <algorithm>
 #include <cstdio>
 #include <filesystem>
+#include <fstream>
 #include <sstream>
 
 namespace argentum::persist {
 
 namespace {
 const char* kUnknownType = "unknown";
+const char* kCrcField = ",\"crc32c\":";
 
 bool parse_u64_field(const std::string& json, const std::string& key, uint64_t* out) {
     if (!out) return false;
@@ -162,7 +165,8 @@ bool load_tail_stats(const std::string& path, uint64_t* out_last_seq, uint64_t*
 
 } // namespace
 
-EventJournal::EventJournal(std::string path) : path_(std::move(path)) {
+EventJournal::EventJournal(std::string path, AsyncFileConfig file_config)
+    : path_(std::move(path)), file_(file_config) {
     std::error_code ec;
     const std::filesystem::path fs_path(path_);
     if (!fs_path.parent_path().empty()) {
@@ -183,10 +187,7 @@ EventJournal::~EventJournal() {
 
 bool EventJournal::append(const JournalEvent& event) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (!file_.is_open()) {
-        file_.open(path_, std::ios::out | std::ios::app);
-        if (!file_.is_open()) return false;
-    }
+    if (!file_.is_open() && !file_.open(path_)) return false;
 
     JournalEvent to_write = event;
     if (to_write.seq == 0) {
@@ -202,27 +203,54 @@ bool EventJournal::append(const JournalEvent& event) {
     }
     last_timestamp_ns_ = to_write.timestamp_ns;
 
-    file_ << "{\"seq\":" << to_write.seq
-          << ",\"timestamp_ns\":" << to_write.timestamp_ns
-          << ",\"type\":\"" << journal_event_type_to_string(to_write.type) << "\""
-          << ",\"order_id\":" << to_write.order_id
-          << ",\"related_order_id\":" << to_write.related_order_id
-          << ",\"price_ticks\":" << to_write.price_ticks
-          << ",\"quantity_lots\":" << to_write.quantity_lots
-          << ",\"remaining_lots\":" << to_write.remaining_lots
-          << ",\"reason_code\":" << to_write.reason_code
-          << ",\"side\":" << static_cast<uint32_t>(to_write.side)
-          << ",\"order_type\":" << static_cast<uint32_t>(to_write.order_type)
-          << ",\"tif\":" << static_cast<uint32_t>(to_write.tif)
-          << ",\"resting\":" << (to_write.resting ? "true" : "false")
-          << "}\n";
-    return file_.good();
+    std::string& line = line_;
+    line.clear();
+    line += "{\"seq\":";
+    line += std::to_string(to_write.seq);
+    line += ",\"timestamp_ns\":";
+    line += std::to_string(to_write.timestamp_ns);
+    line += ",\"type\":\"";
+    line += journal_event_type_to_string(to_write.type);
+    line += "\",\"order_id\":";
+    line += std::to_string(to_write.order_id);
+    line += ",\"related_order_id\":";
+    line += std::to_string(to_write.related_order_id);
+    line += ",\"price_ticks\":";
+    line += std::to_string(to_write.price_ticks);
+    line += ",\"quantity_lots\":";
+    line += std::to_string(to_write.quantity_lots);
+    line += ",\"remaining_lots\":";
+    line += std::to_string(to_write.remaining_lots);
+    line += ",\"reason_code\":";
+    line += std::to_string(to_write.reason_code);
+    line += ",\"side\":";
+    line += std::to_string(static_cast<uint32_t>(to_write.side));
+    line += ",\"order_type\":";
+    line += std::to_string(static_cast<uint32_t>(to_write.order_type));
+    line += ",\"tif\":";
+    line += std::to_string(static_cast<uint32_t>(to_write.tif));
+    line += ",\"resting\":";
+    line += to_write.resting ? "true" : "false";
+
+    // CRC-32C over everything before the field itself; always the last field on the line.
+    const uint32_t crc = core::crc32c(line.data(), line.size());
+    line += kCrcField;
+    line += std::to_string(crc);
+    line += "}\n";
+    return file_.write(line.data(), line.size());
 }
 
 void EventJournal::flush() {
     std::lock_guard<std::mutex> lock(mutex_);
     if (file_.is_open()) {
-        file_.flush();
+        file_.wait();
+    }
+}
+
+void EventJournal::sync() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_.is_open()) {
+        file_.sync();
     }
 }
 
@@ -301,6 +329,15 @@ bool EventReplayer::replay_file(const std::string& path, ReplaySummary* out_summ
         if (line.empty()) continue;
         ++summary.total_events;
 
+        // Lines written before checksums were introduced carry no crc32c field.
+        const size_t crc_pos = line.rfind(kCrcField);
+        if (crc_pos != std::string::npos) {
+            uint64_t stored_crc = 0;
+            if (!parse_u64_field(line.substr(crc_pos + 1), "crc32c", &stored_crc)) return false;
+            if (core::crc32c(line.data(), crc_pos) != stored_crc) return false;
+            ++summary.checksummed_events;
+        }
+
         JournalEvent event{};
         uint64_t seq = 0;
         uint64_t ts = 0;
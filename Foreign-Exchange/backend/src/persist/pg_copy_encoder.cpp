@@ -0,0 +1,81 @@
+#include "persist/pg_copy_encoder.hpp"
+
+#include <cstring>
+
+namespace argentum::persist {
+
+namespace {
+// "PGCOPY\n\377\r\n\0", then int32 flags and int32 header-extension length.
+constexpr uint8_t kSignature[11] = {'P', 'G', 'C', 'O', 'P', 'Y', '\n', 0xFF, '\r', '\n', 0};
+
+// Upper bound of one encoded row: field count, six length words, fixed-width fields and
+// the two bounded strings.
+constexpr size_t kMaxRowBytes = 2 + 6 * 4 + 8 + 8 + 8 + 1 + sizeof(MarketTick::symbol) + sizeof(MarketTick::source);
+
+uint8_t* put_u16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value >> 8);
+    out[1] = static_cast<uint8_t>(value);
+    return out + 2;
+}
+
+uint8_t* put_u32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) out[i] = static_cast<uint8_t>(value >> (24 - 8 * i));
+    return out + 4;
+}
+
+uint8_t* put_u64(uint8_t* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) out[i] = static_cast<uint8_t>(value >> (56 - 8 * i));
+    return out + 8;
+}
+
+uint8_t* put_f64(uint8_t* out, double value) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return put_u64(put_u32(out, 8), bits);
+}
+
+uint8_t* put_text(uint8_t* out, const char* text, size_t capacity) {
+    size_t length = 0;
+    while (length < capacity && text[length] != '\0') ++length;
+    out = put_u32(out, static_cast<uint32_t>(length));
+    std::memcpy(out, text, length);
+    return out + length;
+}
+} // namespace
+
+void PgTickCopyEncoder::begin() {
+    buffer_.resize(sizeof(kSignature) + 8);
+    std::memcpy(buffer_.data(), kSignature, sizeof(kSignature));
+    put_u32(put_u32(buffer_.data() + sizeof(kSignature), 0), 0);
+    rows_ = 0;
+}
+
+void PgTickCopyEncoder::append(const MarketTick& tick) {
+    append_batch({&tick, 1});
+}
+
+void PgTickCopyEncoder::append_batch(std::span<const MarketTick> ticks) {
+    const size_t start = buffer_.size();
+    buffer_.resize(start + ticks.size() * kMaxRowBytes);
+    uint8_t* out = buffer_.data() + start;
+    for (const MarketTick& tick : ticks) {
+        out = put_u16(out, static_cast<uint16_t>(kColumnCount));
+        out = put_u64(put_u32(out, 8), static_cast<uint64_t>(pg_timestamp_us(tick.timestamp_ns)));
+        out = put_text(out, tick.symbol, sizeof(tick.symbol));
+        out = put_f64(out, tick.price);
+        out = put_f64(out, tick.quantity);
+        out = put_u32(out, 1);
+        *out++ = tick.side == SIDE_BUY ? 'B' : 'S';
+        out = put_text(out, tick.source, sizeof(tick.source));
+    }
+    buffer_.resize(static_cast<size_t>(out - buffer_.data()));
+    rows_ += ticks.size();
+}
+
+void PgTickCopyEncoder::finish() {
+    const size_t start = buffer_.size();
+    buffer_.resize(start + 2);
+    put_u16(buffer_.data() + start, 0xFFFF); // field count -1
+}
+
+} // namespace argentum::persist
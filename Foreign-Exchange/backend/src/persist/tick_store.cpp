@@ -0,0 +1,354 @@
+#include "persist/tick_store.hpp"
+
+#include "core/fixed_point.hpp"
+#include "core/time_utils.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace argentum::persist {
+
+namespace {
+
+std::string_view bounded_name(const char* name, size_t capacity) {
+    const void* nul = std::memchr(name, '\0', capacity);
+    return std::string_view(name, nul ? static_cast<size_t>(static_cast<const char*>(nul) - name) : capacity);
+}
+
+uint64_t align8(uint64_t offset) {
+    return (offset + 7) & ~uint64_t{7};
+}
+
+bool write_padded(FILE* file, const void* data, size_t bytes, uint64_t padded) {
+    static const char kZeros[8] = {};
+    if (bytes > 0 && std::fwrite(data, 1, bytes, file) != bytes) return false;
+    const size_t pad = static_cast<size_t>(padded - bytes);
+    return pad == 0 || std::fwrite(kZeros, 1, pad, file) == pad;
+}
+
+// Pushes stdio's buffer and then the file's contents to disk.
+bool sync_file(FILE* file) {
+    if (std::fflush(file) != 0) return false;
+#ifdef _WIN32
+    return ::_commit(::_fileno(file)) == 0;
+#else
+    return ::fsync(::fileno(file)) == 0;
+#endif
+}
+
+// Makes a rename into `dir` durable. Windows cannot open a directory for syncing.
+bool sync_directory(const std::string& dir) {
+#ifdef _WIN32
+    (void)dir;
+    return true;
+#else
+    const int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    const bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#endif
+}
+
+// [offset, offset + bytes) lies within the body; written so that no addition can wrap.
+bool span_fits(uint64_t offset, uint64_t bytes, uint64_t body) {
+    return offset <= body && bytes <= body - offset;
+}
+
+bool read_footer(const std::filesystem::path& path, TickSegmentFooter* out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+    in.seekg(0, std::ios::end);
+    const std::streamoff size = in.tellg();
+    if (size < static_cast<std::streamoff>(sizeof(TickSegmentFooter))) return false;
+    in.seekg(size - static_cast<std::streamoff>(sizeof(TickSegmentFooter)));
+    in.read(reinterpret_cast<char*>(out), sizeof(TickSegmentFooter));
+    return in.good() && out->magic == kTickSegmentMagic && out->version == kTickSegmentVersion;
+}
+
+} // namespace
+
+std::string tick_store_symbol_dir(std::string_view symbol) {
+    if (symbol.empty()) return std::string(1, '_');
+    std::string dir(symbol);
+    for (char& c : dir) c = tick_store_dir_char(c);
+    return dir;
+}
+
+TickStoreWriter::TickStoreWriter(std::string root, TickStoreConfig config)
+    : root_(std::move(root)), config_(config) {
+    if (config_.rows_per_segment == 0) config_.rows_per_segment = 1;
+}
+
+TickStoreWriter::~TickStoreWriter() {
+    flush();
+}
+
+TickStoreWriter::OpenSegment* TickStoreWriter::segment_for(const MarketTick& tick) {
+    const std::string_view symbol = bounded_name(tick.symbol, sizeof(tick.symbol));
+    if (symbol.empty()) return nullptr;
+    if (last_ && last_->symbol == symbol) return last_;
+
+    auto [it, inserted] = open_.try_emplace(std::string(symbol));
+    OpenSegment& segment = it->second;
+    if (inserted) {
+        segment.symbol = it->first;
+        segment.directory = (std::filesystem::path(root_) / tick_store_symbol_dir(symbol)).string();
+    }
+    last_ = &segment;
+    return &segment;
+}
+
+uint16_t TickStoreWriter::venue_index(OpenSegment& segment, const char* source) {
+    const std::string_view venue = bounded_name(source, sizeof(MarketTick::source));
+    if (segment.last_venue < segment.venue_names.size() && segment.venue_names[segment.last_venue] == venue) {
+        return segment.last_venue;
+    }
+    for (size_t i = 0; i < segment.venue_names.size(); ++i) {
+        if (segment.venue_names[i] == venue) {
+            segment.last_venue = static_cast<uint16_t>(i);
+            return segment.last_venue;
+        }
+    }
+    // The table is bounded by the u16 column; past that, ticks share the last entry.
+    if (segment.venue_names.size() <= std::numeric_limits<uint16_t>::max()) {
+        segment.venue_names.emplace_back(venue);
+    }
+    segment.last_venue = static_cast<uint16_t>(segment.venue_names.size() - 1);
+    return segment.last_venue;
+}
+
+bool TickStoreWriter::append(const MarketTick& tick) {
+    OpenSegment* segment = segment_for(tick);
+    if (!segment) return false;
+
+    const uint64_t partition = config_.partition_ns > 0 ? tick.timestamp_ns / config_.partition_ns : 0;
+    bool ok = true;
+    if (!segment->timestamps.empty() && partition != segment->partition) ok = seal(*segment);
+    if (segment->timestamps.empty()) {
+        segment->partition = partition;
+        segment->opened_ns = core::now_ns();
+    }
+
+    segment->timestamps.push_back(tick.timestamp_ns);
+    segment->prices.push_back(tick.price);
+    segment->quantities.push_back(tick.quantity);
+    segment->venues.push_back(venue_index(*segment, tick.source));
+    segment->sides.push_back(tick.side);
+    if (segment->timestamps.size() >= config_.rows_per_segment) ok = seal(*segment) && ok;
+    return ok;
+}
+
+size_t TickStoreWriter::append_batch(std::span<const MarketTick> ticks) {
+    size_t appended = 0;
+    for (const MarketTick& tick : ticks) {
+        if (append(tick)) ++appended;
+    }
+    return appended;
+}
+
+size_t TickStoreWriter::seal_expired(uint64_t now_ns) {
+    size_t sealed = 0;
+    for (auto& [symbol, segment] : open_) {
+        if (segment.timestamps.empty() || now_ns - segment.opened_ns < config_.max_open_ns) continue;
+        if (seal(segment)) ++sealed;
+    }
+    return sealed;
+}
+
+bool TickStoreWriter::flush() {
+    bool ok = true;
+    for (auto& [symbol, segment] : open_) {
+        ok = seal(segment) && ok;
+    }
+    return ok;
+}
+
+bool TickStoreWriter::seal(OpenSegment& segment) {
+    const size_t rows = segment.timestamps.size();
+    if (rows == 0) return true;
+
+    std::error_code ec;
+    if (!segment.directory_ready) {
+        std::filesystem::create_directories(segment.directory, ec);
+        segment.directory_ready = !ec;
+    }
+
+    // Name collisions only happen after a restart; probing is once per sealed segment.
+    const uint64_t partition_start = segment.partition * config_.partition_ns;
+    std::filesystem::path path;
+    do {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%020llu-%06u.ats",
+                      static_cast<unsigned long long>(partition_start), segment.next_seq++);
+        path = std::filesystem::path(segment.directory) / name;
+    } while (std::filesystem::exists(path, ec));
+
+    TickSegmentFooter footer{};
+    footer.venue_count = static_cast<uint32_t>(segment.venue_names.size());
+    footer.row_count = rows;
+    const auto [min_ts, max_ts] = std::minmax_element(segment.timestamps.begin(), segment.timestamps.end());
+    footer.min_timestamp_ns = *min_ts;
+    footer.max_timestamp_ns = *max_ts;
+    footer.timestamp_offset = 0;
+    footer.price_offset = rows * sizeof(uint64_t);
+    footer.quantity_offset = footer.price_offset + rows * sizeof(int64_t);
+    footer.venue_offset = footer.quantity_offset + rows * sizeof(int64_t);
+    footer.side_offset = align8(footer.venue_offset + rows * sizeof(uint16_t));
+    footer.venue_table_offset = align8(footer.side_offset + rows);
+    std::memcpy(footer.symbol, segment.symbol.data(), std::min(segment.symbol.size(), sizeof(footer.symbol)));
+
+    std::vector<char> venue_table(segment.venue_names.size() * kTickSegmentNameLength, '\0');
+    for (size_t i = 0; i < segment.venue_names.size(); ++i) {
+        const std::string& name = segment.venue_names[i];
+        std::memcpy(venue_table.data() + i * kTickSegmentNameLength, name.data(),
+                    std::min(name.size(), kTickSegmentNameLength));
+    }
+
+    const std::filesystem::path tmp = path.string() + ".tmp";
+    FILE* file = std::fopen(tmp.string().c_str(), "wb");
+    bool ok = file != nullptr;
+    if (ok) {
+        scratch_.resize(rows);
+        ok = write_padded(file, segment.timestamps.data(), rows * sizeof(uint64_t), rows * sizeof(uint64_t));
+        core::to_price_ticks_batch(segment.prices, scratch_);
+        ok = ok && write_padded(file, scratch_.data(), rows * sizeof(int64_t), rows * sizeof(int64_t));
+        core::to_quantity_lots_batch(segment.quantities, scratch_);
+        ok = ok && write_padded(file, scratch_.data(), rows * sizeof(int64_t), rows * sizeof(int64_t));
+        ok = ok && write_padded(file, segment.venues.data(), rows * sizeof(uint16_t),
+                                footer.side_offset - footer.venue_offset);
+        ok = ok && write_padded(file, segment.sides.data(), rows, footer.venue_table_offset - footer.side_offset);
+        ok = ok && write_padded(file, venue_table.data(), venue_table.size(), venue_table.size());
+        ok = ok && write_padded(file, &footer, sizeof(footer), sizeof(footer));
+        // The data must be on disk before the rename publishes it, or a crash can leave
+        // a complete-looking name over a truncated file.
+        ok = ok && sync_file(file);
+        ok = (std::fclose(file) == 0) && ok;
+    }
+    if (ok) {
+        std::filesystem::rename(tmp, path, ec);
+        ok = !ec;
+        if (!ok) std::filesystem::remove(tmp, ec);
+    } else {
+        std::filesystem::remove(tmp, ec);
+    }
+    // A segment whose directory entry may not survive a crash counts as a failed write.
+    if (ok && sync_directory(segment.directory)) {
+        ++segments_written_;
+    } else {
+        ok = false;
+        ++failed_writes_;
+    }
+
+    segment.timestamps.clear();
+    segment.prices.clear();
+    segment.quantities.clear();
+    segment.venues.clear();
+    segment.sides.clear();
+    segment.venue_names.clear();
+    segment.last_venue = 0;
+    return ok;
+}
+
+bool TickSegment::open(const std::string& path) {
+    close();
+    if (!file_.open(path) || file_.size() < sizeof(TickSegmentFooter)) {
+        close();
+        return false;
+    }
+    std::memcpy(&footer_, file_.data() + file_.size() - sizeof(TickSegmentFooter), sizeof(TickSegmentFooter));
+
+    const uint64_t body = file_.size() - sizeof(TickSegmentFooter);
+    const uint64_t rows = footer_.row_count;
+    const bool valid = footer_.magic == kTickSegmentMagic && footer_.version == kTickSegmentVersion &&
+                       rows <= body / sizeof(uint64_t) && // bounds the products below
+                       span_fits(footer_.timestamp_offset, rows * sizeof(uint64_t), body) &&
+                       span_fits(footer_.price_offset, rows * sizeof(int64_t), body) &&
+                       span_fits(footer_.quantity_offset, rows * sizeof(int64_t), body) &&
+                       span_fits(footer_.venue_offset, rows * sizeof(uint16_t), body) &&
+                       span_fits(footer_.side_offset, rows, body) &&
+                       span_fits(footer_.venue_table_offset, uint64_t{footer_.venue_count} * kTickSegmentNameLength, body) &&
+                       (footer_.timestamp_offset | footer_.price_offset | footer_.quantity_offset |
+                        footer_.venue_offset) % 8 == 0;
+    if (!valid) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TickSegment::close() {
+    file_.close();
+    footer_ = TickSegmentFooter{};
+}
+
+std::string_view TickSegment::symbol() const {
+    return bounded_name(footer_.symbol, sizeof(footer_.symbol));
+}
+
+std::string_view TickSegment::venue_name(uint16_t index) const {
+    if (!file_.data() || index >= footer_.venue_count) return {};
+    return bounded_name(file_.data() + footer_.venue_table_offset + index * kTickSegmentNameLength,
+                        kTickSegmentNameLength);
+}
+
+void TickSegment::read_tick(size_t i, MarketTick* out) const {
+    if (!out || i >= size()) return;
+    *out = MarketTick{};
+    out->timestamp_ns = timestamps()[i];
+    out->price = core::from_price_ticks(price_ticks()[i]);
+    out->quantity = core::from_quantity_lots(quantity_lots()[i]);
+    out->side = sides()[i];
+    const std::string_view sym = symbol();
+    std::memcpy(out->symbol, sym.data(), std::min(sym.size(), sizeof(out->symbol) - 1));
+    const std::string_view venue = venue_name(venues()[i]);
+    std::memcpy(out->source, venue.data(), std::min(venue.size(), sizeof(out->source) - 1));
+}
+
+std::vector<std::string> list_tick_segments(const std::string& root,
+                                            std::string_view symbol,
+                                            uint64_t from_ns,
+                                            uint64_t to_ns) {
+    std::vector<std::filesystem::path> dirs;
+    std::error_code ec;
+    if (symbol.empty()) {
+        for (std::filesystem::directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec)) dirs.push_back(it->path());
+        }
+    } else {
+        dirs.push_back(std::filesystem::path(root) / tick_store_symbol_dir(symbol));
+    }
+
+    std::vector<std::pair<uint64_t, std::string>> found;
+    for (const auto& dir : dirs) {
+        for (std::filesystem::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec) || it->path().extension() != ".ats") continue;
+            TickSegmentFooter footer{};
+            if (!read_footer(it->path(), &footer)) continue;
+            if (!symbol.empty() && bounded_name(footer.symbol, sizeof(footer.symbol)) != symbol) continue;
+            if (footer.max_timestamp_ns < from_ns || footer.min_timestamp_ns > to_ns) continue;
+            found.emplace_back(footer.min_timestamp_ns, it->path().string());
+        }
+        ec.clear();
+    }
+    std::sort(found.begin(), found.end());
+
+    std::vector<std::string> paths;
+    paths.reserve(found.size());
+    for (auto& entry : found) paths.push_back(std::move(entry.second));
+    return paths;
+}
+
+} // namespace argentum::persist
@@ -1,6 +1,7 @@
 #include "api/market_gateway.hpp"
 #include "bus/message_bus.hpp"
 #include "codec/market_tick_codec.hpp"
+#include "core/instrument_registry.hpp"
 
 #include <cassert>
 #include <chrono>
@@ -15,6 +16,8 @@ int main() {
     auto bus = argentum::bus::create_inproc_bus(config);
     bus->connect("inproc://contract", true);
 
+    // Instruments come from configuration; bus symbols are only looked up.
+    assert(argentum::core::instrument_registry().intern("BTC/USDT") != argentum::core::InstrumentRegistry::kInvalidId);
     argentum::api::MarketGatewayService gateway(bus, "market.ticks");
     gateway.start();
 
@@ -47,10 +50,36 @@ int main() {
     assert(tick_json.find("\"symbol\":\"BTC/USDT\"") != std::string::npos);
     assert(tick_json.find("\"source\":\"BINANCE\"") != std::string::npos);
 
+    // Keyed by instrument: another spelling of BTC/USDT replaces the same entry.
+    MarketTick respelled = tick;
+    respelled.timestamp_ns += 1;
+    std::memset(respelled.symbol, 0, sizeof(respelled.symbol));
+    std::memcpy(respelled.symbol, "btc-usdt", 8);
+    assert(argentum::codec::encode_market_tick_legacy(respelled, &payload) == ARGENTUM_OK);
+    assert(bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK);
+    for (int i = 0; i < 100; ++i) {
+        if (gateway.get_latest_tick("BTC_USDT", &latest) && latest.timestamp_ns == respelled.timestamp_ns) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(latest.timestamp_ns == respelled.timestamp_ns);
+    assert(!gateway.get_latest_tick("ETH/USDT", &latest));
+
+    // Unregistered symbols are counted, not interned.
+    MarketTick unknown = tick;
+    std::memset(unknown.symbol, 0, sizeof(unknown.symbol));
+    std::memcpy(unknown.symbol, "XAG/CHF", 7);
+    assert(argentum::codec::encode_market_tick_legacy(unknown, &payload) == ARGENTUM_OK);
+    assert(bus->publish("market.ticks", payload.data(), payload.size()) == ARGENTUM_OK);
+    for (int i = 0; i < 100 && gateway.metrics().unknown_symbol_ticks == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(gateway.metrics().unknown_symbol_ticks == 1);
+    assert(argentum::core::instrument_registry().find("XAG/CHF") == argentum::core::InstrumentRegistry::kInvalidId);
+
     auto metrics = gateway.metrics();
-    assert(metrics.ticks_received >= 1);
-    assert(metrics.ticks_decoded >= 1);
-    assert(metrics.tracked_symbols >= 1);
+    assert(metrics.ticks_received >= 3);
+    assert(metrics.ticks_decoded >= 3);
+    assert(metrics.tracked_symbols == 1);
 
     std::string health = gateway.health_json();
     assert(health.find("\"status\":\"ok\"") != std::string::npos);
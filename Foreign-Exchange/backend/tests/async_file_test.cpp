@@ -0,0 +1,113 @@
+#include "persist/async_file.hpp"
+#include "persist/event_journal.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace {
+using argentum::persist::AsyncFile;
+using argentum::persist::AsyncFileBackend;
+using argentum::persist::AsyncFileConfig;
+
+std::string read_all(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void exercise(bool use_io_uring) {
+    const std::filesystem::path path = use_io_uring ? "data/test_async_file_uring.log" : "data/test_async_file_pwritev.log";
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    // Small buffers so lines straddle buffers and every buffer is reused many times.
+    AsyncFileConfig config{};
+    config.buffer_bytes = 4096;
+    config.buffer_count = 3;
+    config.use_io_uring = use_io_uring;
+
+    std::string expected;
+    {
+        AsyncFile file(config);
+        assert(!file.write("x", 1));
+        assert(file.open(path.string(), true));
+        if (!use_io_uring) assert(file.backend() == AsyncFileBackend::Pwritev);
+        char line[96];
+        for (int i = 0; i < 20000; ++i) {
+            const int n = std::snprintf(line, sizeof(line), "%d,EUR/USD,%.5f,%s\n", i, 1.08 + i * 1e-5, (i % 7) ? "B" : "SELL");
+            assert(file.write(line, static_cast<size_t>(n)));
+            expected.append(line, static_cast<size_t>(n));
+            if (i % 5000 == 4999) file.sync();
+        }
+        assert(file.size() == expected.size());
+        assert(file.wait());
+        assert(read_all(path) == expected);
+        assert(file.stats().bytes_written == expected.size());
+        assert(file.stats().syncs == 4);
+        assert(file.stats().failed == 0);
+        assert(file.stats().writes > expected.size() / config.buffer_bytes);
+
+        // A sync with nothing buffered still orders behind the writes in flight.
+        file.write("tail\n", 5);
+        expected += "tail\n";
+        file.flush();
+        file.sync();
+        assert(file.close());
+        assert(file.stats().syncs == 5);
+    }
+    assert(read_all(path) == expected);
+
+    // Reopening appends after the existing data.
+    {
+        AsyncFile file(config);
+        assert(file.open(path.string()));
+        assert(file.size() == expected.size());
+        assert(file.write("more\n", 5));
+    }
+    assert(read_all(path) == expected + "more\n");
+
+    AsyncFile missing(config);
+    assert(!missing.open("data/no_such_dir/file.log"));
+    std::filesystem::remove(path, ec);
+}
+} // namespace
+
+int main() {
+    std::filesystem::create_directories("data");
+    exercise(true);  // io_uring where available, pwritev otherwise
+    exercise(false);
+
+    // The journal writes through AsyncFile; flush() makes every line readable.
+    const std::filesystem::path journal_path = "data/test_async_journal.jsonl";
+    std::error_code ec;
+    std::filesystem::remove(journal_path, ec);
+    {
+        argentum::persist::EventJournal journal(journal_path.string());
+        for (uint64_t i = 1; i <= 500; ++i) {
+            argentum::persist::JournalEvent event{};
+            event.order_id = i;
+            event.timestamp_ns = 1'700'000'000'000'000'000ULL + i;
+            assert(journal.append(event));
+        }
+        journal.sync();
+        journal.flush();
+        argentum::persist::ReplaySummary summary{};
+        assert(argentum::persist::EventReplayer::replay_file(journal_path.string(), &summary));
+        assert(summary.total_events == 500 && summary.checksummed_events == 500);
+    }
+    {
+        // Sequence numbers continue after a restart.
+        argentum::persist::EventJournal journal(journal_path.string());
+        argentum::persist::JournalEvent event{};
+        event.order_id = 501;
+        assert(journal.append(event));
+    }
+    argentum::persist::ReplaySummary summary{};
+    assert(argentum::persist::EventReplayer::replay_file(journal_path.string(), &summary));
+    assert(summary.total_events == 501 && summary.monotonic_seq);
+    std::filesystem::remove(journal_path, ec);
+    return 0;
+}
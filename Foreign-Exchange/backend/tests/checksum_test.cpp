@@ -0,0 +1,55 @@
+#include "core/checksum.hpp"
+#include "core/cpu_features.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using argentum::core::ChecksumKind;
+
+int main() {
+    const char* check = "123456789";
+    const size_t check_len = std::strlen(check);
+
+    // Standard check values.
+    assert(argentum::core::crc32(check, check_len) == 0xCBF43926U);
+    assert(argentum::core::crc32c(check, check_len) == 0xE3069283U);
+    assert(argentum::core::detail::crc32_portable(check, check_len) == 0xCBF43926U);
+    assert(argentum::core::detail::crc32c_portable(check, check_len) == 0xE3069283U);
+    assert(argentum::core::xxhash32("", 0) == 0x02CC5D05U);
+    const char* xx_input = "Nobody inspects the spammish repetition";
+    assert(argentum::core::xxhash32(xx_input, std::strlen(xx_input)) == 0xE2293B2FU);
+
+    assert(argentum::core::compute_checksum(ChecksumKind::Crc32, check, check_len) == 0xCBF43926U);
+    assert(argentum::core::compute_checksum(ChecksumKind::Crc32c, check, check_len) == 0xE3069283U);
+    assert(argentum::core::crc32(nullptr, 0) == 0);
+
+    // Accelerated kernels must match the table path for every length, alignment and
+    // split point (running checksums continue across calls).
+    std::mt19937 rng(42);
+    std::vector<uint8_t> buf(4096 + 16);
+    for (auto& b : buf) b = static_cast<uint8_t>(rng());
+    for (size_t len = 0; len <= 300; ++len) {
+        const size_t offset = len % 7;
+        const uint8_t* p = buf.data() + offset;
+        const uint32_t ref = argentum::core::detail::crc32_portable(p, len);
+        const uint32_t ref_c = argentum::core::detail::crc32c_portable(p, len);
+        assert(argentum::core::crc32(p, len) == ref);
+        assert(argentum::core::crc32c(p, len) == ref_c);
+
+        const size_t split = len / 3;
+        assert(argentum::core::crc32(p + split, len - split, argentum::core::crc32(p, split)) == ref);
+        assert(argentum::core::crc32c(p + split, len - split, argentum::core::crc32c(p, split)) == ref_c);
+    }
+    assert(argentum::core::crc32(buf.data(), 4096) == argentum::core::detail::crc32_portable(buf.data(), 4096));
+    assert(argentum::core::crc32c(buf.data(), 4096) == argentum::core::detail::crc32c_portable(buf.data(), 4096));
+
+    // Feature probing is stable and self-consistent.
+    const auto& cpu = argentum::core::cpu_features();
+    assert(&cpu == &argentum::core::cpu_features());
+    assert(!cpu.avx512bw || cpu.avx512f);
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "codec/compact_tick_codec.hpp"
+#include "codec/market_tick_codec.hpp"
+#include "core/fixed_point.hpp"
+#include "core/instrument_registry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+MarketTick make_tick(const char* symbol, const char* source, double price, uint64_t ts) {
+    MarketTick tick{};
+    tick.timestamp_ns = ts;
+    tick.price = price;
+    tick.quantity = 0.125;
+    std::memcpy(tick.symbol, symbol, std::min(std::strlen(symbol), sizeof(tick.symbol) - 1));
+    std::memcpy(tick.source, source, std::min(std::strlen(source), sizeof(tick.source) - 1));
+    tick.side = SIDE_SELL;
+    return tick;
+}
+} // namespace
+
+int main() {
+    using argentum::codec::CompactTick;
+
+    // Registry: dense ids from 1, idempotent, bounded.
+    argentum::core::InstrumentRegistry small(2);
+    const uint32_t a = small.intern("EUR/USD");
+    assert(a == 1);
+    assert(small.intern("EUR/USD") == a);
+    assert(small.intern("GBP/USD") == 2);
+    assert(small.intern("USD/JPY") == argentum::core::InstrumentRegistry::kInvalidId);
+    assert(small.find("GBP/USD") == 2);
+    assert(small.find("USD/JPY") == argentum::core::InstrumentRegistry::kInvalidId);
+    assert(small.name(a) == "EUR/USD");
+    assert(small.name(0).empty());
+    assert(small.name(3).empty());
+    assert(small.intern("") == argentum::core::InstrumentRegistry::kInvalidId);
+    assert(small.intern("A-NAME-LONGER-THAN-15") == argentum::core::InstrumentRegistry::kInvalidId);
+
+    // Single tick: 64-byte frame (vs 80 for V1), fixed-point round trip through decode_market_tick.
+    const MarketTick tick = make_tick("BTC/USDT", "BINANCE", 50000.25, 1700000000000000000ULL);
+    std::array<uint8_t, 128> frame{};
+    size_t frame_size = 0;
+    assert(argentum::codec::encode_compact_tick_into(tick, frame, &frame_size) == ARGENTUM_OK);
+    assert(frame_size == argentum::codec::compact_tick_frame_size(1));
+    assert(frame_size == 64);
+
+    MarketTick decoded{};
+    assert(argentum::codec::decode_market_tick(frame.data(), frame_size, &decoded) == ARGENTUM_OK);
+    assert(decoded.timestamp_ns == tick.timestamp_ns);
+    assert(decoded.price == tick.price);
+    assert(decoded.quantity == tick.quantity);
+    assert(std::strcmp(decoded.symbol, "BTC/USDT") == 0);
+    assert(std::strcmp(decoded.source, "BINANCE") == 0);
+    assert(decoded.side == SIDE_SELL);
+
+    // Truncated and short-buffer cases.
+    assert(argentum::codec::decode_market_tick(frame.data(), frame_size - 1, &decoded) == ARGENTUM_ERR_PROTO);
+    size_t required = 0;
+    assert(argentum::codec::encode_compact_tick_into(tick, std::span<uint8_t>(frame.data(), 16), &required) == ARGENTUM_ERR_RANGE);
+    assert(required == frame_size);
+
+    // Packed batch: base timestamp in the header, deltas per record, checksummed.
+    std::vector<uint8_t> batch(argentum::codec::compact_tick_frame_size(3));
+    argentum::codec::CompactTickFrameWriter writer(
+        batch, argentum::bus::checksum_flags(argentum::core::ChecksumKind::Crc32c));
+    assert(writer.capacity() == 3);
+    const double prices[] = {1.1, 1.2, 1.3};
+    for (int i = 0; i < 3; ++i) {
+        CompactTick compact{};
+        const MarketTick src = make_tick("EUR/USD", "LMAX", prices[i], 1000 + static_cast<uint64_t>(i) * 500);
+        assert(argentum::codec::to_compact_tick(src, &compact) == ARGENTUM_OK);
+        assert(writer.add(compact) == ARGENTUM_OK);
+    }
+    CompactTick overflow{};
+    assert(writer.add(overflow) == ARGENTUM_ERR_RANGE);
+    size_t batch_size = 0;
+    assert(writer.finish(&batch_size) == ARGENTUM_OK);
+    assert(batch_size == batch.size());
+
+    std::array<CompactTick, 3> ticks{};
+    size_t count = 0;
+    assert(argentum::codec::decode_compact_ticks(batch.data(), batch_size, ticks, &count) == ARGENTUM_OK);
+    assert(count == 3);
+    for (size_t i = 0; i < count; ++i) {
+        assert(ticks[i].timestamp_ns == 1000 + i * 500);
+        assert(ticks[i].price_ticks == argentum::core::to_price_ticks(prices[i]));
+        assert(ticks[i].instrument_id == argentum::core::instrument_registry().find("EUR/USD"));
+        assert(argentum::core::venue_registry().name(ticks[i].venue_id) == "LMAX");
+    }
+    assert(argentum::codec::decode_compact_ticks(batch.data(), batch_size, std::span<CompactTick>(ticks.data(), 1), &count) == ARGENTUM_ERR_RANGE);
+    assert(count == 3);
+    // A batch is not a single tick.
+    assert(argentum::codec::decode_market_tick(batch.data(), batch_size, &decoded) != ARGENTUM_OK);
+
+    batch.back() ^= 0x01;
+    assert(argentum::codec::decode_compact_ticks(batch.data(), batch_size, ticks, &count) == ARGENTUM_ERR_PROTO);
+
+    // Deltas are unsigned 32-bit: earlier or far-later ticks need a new frame.
+    std::vector<uint8_t> window(argentum::codec::compact_tick_frame_size(4));
+    argentum::codec::CompactTickFrameWriter window_writer(window);
+    CompactTick t{};
+    t.instrument_id = 1;
+    t.timestamp_ns = 10'000'000'000ULL;
+    assert(window_writer.add(t) == ARGENTUM_OK);
+    t.timestamp_ns = 9'999'999'999ULL;
+    assert(window_writer.add(t) == ARGENTUM_ERR_RANGE);
+    t.timestamp_ns = 10'000'000'000ULL + 5'000'000'000ULL;
+    assert(window_writer.add(t) == ARGENTUM_ERR_RANGE);
+    assert(window_writer.count() == 1);
+
+    // Typed topic over the compact codec.
+    auto bus = argentum::bus::create_inproc_bus();
+    argentum::codec::CompactMarketTickTopic topic(bus, "market.ticks.compact");
+    std::atomic<bool> got{false};
+    MarketTick received{};
+    std::atomic<int> raw_size{0};
+    topic.subscribe([&](const MarketTick& value) {
+        received = value;
+        got.store(true);
+    });
+    bus->subscribe("market.ticks.compact", [&](const void*, size_t size) { raw_size.store(static_cast<int>(size)); });
+    assert(topic.publish(tick) == ARGENTUM_OK);
+    for (int i = 0; i < 2000 && (!got.load() || raw_size.load() == 0); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(got.load());
+    assert(received.price == tick.price);
+    assert(raw_size.load() == 64);
+
+    return 0;
+}
@@ -3,6 +3,9 @@
 #include <cassert>
 #include <cstring>
 #include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
 
 int main() {
     const std::filesystem::path out = "data/test_market_ticks.csv";
@@ -10,6 +13,7 @@ int main() {
     std::filesystem::remove(out, ec);
 
     argentum::persist::DataWriterService writer;
+    writer.set_local_format(argentum::persist::DataWriterService::LocalFormat::Csv);
     writer.set_csv_path(out.string());
     writer.set_max_batch(2);
     writer.set_flush_interval_ms(5);
@@ -33,5 +37,187 @@ int main() {
     auto size = std::filesystem::file_size(out, ec);
     assert(!ec);
     assert(size > 0);
+
+    // Default local output: columnar tick store segments, sealed on stop().
+    const std::filesystem::path store = "data/test_data_writer_ticks";
+    std::filesystem::remove_all(store, ec);
+    {
+        argentum::persist::DataWriterService store_writer;
+        store_writer.set_tick_store_path(store.string());
+        store_writer.set_max_batch(2);
+        store_writer.set_flush_interval_ms(5);
+        store_writer.start();
+        for (int i = 0; i < 5; ++i) {
+            MarketTick tick{};
+            tick.timestamp_ns = 1'700'000'000'000'000'000ULL + static_cast<uint64_t>(i);
+            tick.price = 100.0 + static_cast<double>(i);
+            tick.quantity = 1.0;
+            tick.side = SIDE_BUY;
+            std::strncpy(tick.symbol, "BTC/USDT", sizeof(tick.symbol) - 1);
+            std::strncpy(tick.source, "TEST", sizeof(tick.source) - 1);
+            store_writer.enqueue(tick);
+        }
+        store_writer.stop();
+        assert(store_writer.failed_flush_count() == 0);
+    }
+    size_t rows = 0;
+    for (const auto& path : argentum::persist::list_tick_segments(store.string(), "BTC/USDT")) {
+        argentum::persist::TickSegment segment;
+        assert(segment.open(path));
+        rows += segment.size();
+    }
+    assert(rows == 5);
+    std::filesystem::remove_all(store, ec);
+
+    // Block: producers outrunning a tiny queue wait instead of dropping.
+    {
+        argentum::persist::DataWriterService block_writer;
+        block_writer.set_tick_store_path(store.string());
+        block_writer.set_queue_capacity(8);
+        block_writer.set_max_batch(4);
+        block_writer.set_block_spin_budget(16);
+        block_writer.set_overflow_policy(argentum::persist::DataWriterService::OverflowPolicy::Block);
+        block_writer.start();
+        std::vector<std::thread> producers;
+        for (int p = 0; p < 3; ++p) {
+            producers.emplace_back([&block_writer, p] {
+                std::vector<MarketTick> ticks(500);
+                for (size_t i = 0; i < ticks.size(); ++i) {
+                    ticks[i].timestamp_ns = 1'700'000'000'000'000'000ULL + p * 1000 + i;
+                    ticks[i].price = 1.1;
+                    ticks[i].quantity = 1.0;
+                    ticks[i].side = SIDE_SELL;
+                    std::strncpy(ticks[i].symbol, "EUR/USD", sizeof(ticks[i].symbol) - 1);
+                    std::strncpy(ticks[i].source, "TEST", sizeof(ticks[i].source) - 1);
+                }
+                block_writer.enqueue_batch(ticks.data(), 250);
+                for (size_t i = 250; i < ticks.size(); ++i) block_writer.enqueue(ticks[i]);
+            });
+        }
+        for (auto& t : producers) t.join();
+        block_writer.stop();
+        assert(block_writer.dropped_count() == 0);
+    }
+    rows = 0;
+    for (const auto& path : argentum::persist::list_tick_segments(store.string(), "EUR/USD")) {
+        argentum::persist::TickSegment segment;
+        assert(segment.open(path));
+        rows += segment.size();
+    }
+    assert(rows == 1500);
+
+    // DropNewest: a full queue drops and counts instead of waiting.
+    {
+        argentum::persist::DataWriterService drop_writer;
+        drop_writer.set_tick_store_path(store.string());
+        drop_writer.set_queue_capacity(4);
+        drop_writer.start();
+        MarketTick tick{};
+        tick.price = 1.0;
+        tick.quantity = 1.0;
+        std::strncpy(tick.symbol, "GBP/USD", sizeof(tick.symbol) - 1);
+        for (int i = 0; i < 10000; ++i) {
+            tick.timestamp_ns = static_cast<uint64_t>(i + 1);
+            drop_writer.enqueue(tick);
+        }
+        drop_writer.stop();
+        rows = 0;
+        for (const auto& path : argentum::persist::list_tick_segments(store.string(), "GBP/USD")) {
+            argentum::persist::TickSegment segment;
+            assert(segment.open(path));
+            rows += segment.size();
+        }
+        assert(rows + drop_writer.dropped_count() == 10000);
+    }
+    std::filesystem::remove_all(store, ec);
+
+    // Symbols that share a tick store directory share a shard, so two workers never race
+    // for the same segment names.
+    {
+        const char* symbols[] = {"EUR/USD", "EUR-USD", "EUR_USD"};
+        argentum::persist::DataWriterService shard_writer;
+        shard_writer.set_shard_count(3);
+        shard_writer.set_tick_store_path(store.string());
+        argentum::persist::TickStoreConfig config{};
+        config.rows_per_segment = 32;
+        shard_writer.set_tick_store_config(config);
+        shard_writer.set_max_batch(64);
+        shard_writer.set_overflow_policy(argentum::persist::DataWriterService::OverflowPolicy::Block);
+        shard_writer.start();
+        size_t shard = 0;
+        for (int i = 0; i < 3000; ++i) {
+            MarketTick tick{};
+            tick.timestamp_ns = 1'700'000'000'000'000'000ULL + static_cast<uint64_t>(i / 3);
+            tick.price = 1.1;
+            tick.quantity = 1.0;
+            std::memcpy(tick.symbol, symbols[i % 3], std::strlen(symbols[i % 3]));
+            if (i < 3) {
+                if (i == 0) shard = shard_writer.shard_for(tick);
+                assert(shard_writer.shard_for(tick) == shard);
+            }
+            shard_writer.enqueue(tick);
+        }
+        shard_writer.stop();
+        assert(shard_writer.dropped_count() == 0 && shard_writer.failed_flush_count() == 0);
+        for (const char* symbol : symbols) {
+            rows = 0;
+            for (const auto& path : argentum::persist::list_tick_segments(store.string(), symbol)) {
+                argentum::persist::TickSegment segment;
+                assert(segment.open(path));
+                rows += segment.size();
+            }
+            assert(rows == 1000);
+        }
+        std::filesystem::remove_all(store, ec);
+    }
+
+    // Shards: a symbol always maps to one shard; each shard keeps its own CSV and counters.
+    {
+        const std::filesystem::path sharded = "data/test_sharded_ticks.csv";
+        argentum::persist::DataWriterService shard_writer;
+        shard_writer.set_shard_count(4);
+        shard_writer.set_local_format(argentum::persist::DataWriterService::LocalFormat::Csv);
+        shard_writer.set_csv_path(sharded.string());
+        shard_writer.set_max_batch(16);
+        shard_writer.set_flush_interval_ms(5);
+        assert(shard_writer.shard_count() == 4);
+        shard_writer.start();
+
+        const char* symbols[] = {"EUR/USD", "GBP/USD", "USD/JPY", "BTC/USDT", "ETH/USDT", "USD/ARS", "AUD/USD", "USD/CHF"};
+        std::vector<uint64_t> expected(4, 0);
+        for (int i = 0; i < 800; ++i) {
+            MarketTick tick{};
+            tick.timestamp_ns = static_cast<uint64_t>(i + 1);
+            tick.price = 1.0;
+            tick.quantity = 1.0;
+            std::strncpy(tick.symbol, symbols[i % 8], sizeof(tick.symbol) - 1);
+            const size_t shard = shard_writer.shard_for(tick);
+            assert(shard < 4);
+            ++expected[shard];
+            shard_writer.enqueue(tick);
+        }
+        MarketTick again{};
+        again.timestamp_ns = 12345;
+        std::strncpy(again.symbol, "EUR/USD", sizeof(again.symbol) - 1);
+        MarketTick first{};
+        std::strncpy(first.symbol, symbols[0], sizeof(first.symbol) - 1);
+        assert(shard_writer.shard_for(again) == shard_writer.shard_for(first)); // symbol only
+        shard_writer.stop();
+
+        size_t used = 0;
+        for (size_t shard = 0; shard < 4; ++shard) {
+            const auto stats = shard_writer.shard_stats(shard);
+            assert(stats.written == expected[shard]);
+            assert(stats.dropped == 0 && stats.queued == 0);
+            assert(shard_writer.dropped_count(shard) == 0);
+            const std::filesystem::path path = "data/test_sharded_ticks." + std::to_string(shard) + ".csv";
+            assert(std::filesystem::exists(path) == (expected[shard] > 0));
+            if (expected[shard] > 0) ++used;
+            std::filesystem::remove(path, ec);
+        }
+        assert(used > 1);
+        assert(shard_writer.stats().written == 800);
+        assert(shard_writer.dropped_count() == 0 && shard_writer.failed_flush_count() == 0);
+    }
     return 0;
 }
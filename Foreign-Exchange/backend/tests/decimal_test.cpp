@@ -0,0 +1,80 @@
+#include "core/decimal.h"
+#include "core/fixed_point.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace {
+ArgentumStatus parse(const char* text, int scale, int64_t* out, size_t* consumed = nullptr) {
+    const char* end = nullptr;
+    const ArgentumStatus st = decimal_parse_scaled(text, text + std::strlen(text), scale, out, &end);
+    if (consumed && st == ARGENTUM_OK) *consumed = static_cast<size_t>(end - text);
+    return st;
+}
+
+int64_t ticks(const char* text) {
+    int64_t value = -1;
+    const ArgentumStatus st = parse(text, 6, &value);
+    assert(st == ARGENTUM_OK);
+    (void)st;
+    return value;
+}
+} // namespace
+
+int main() {
+    using namespace argentum;
+
+    // Exact decimal scaling, including values binary floating point cannot represent.
+    assert(ticks("0") == 0);
+    assert(ticks("1050.25") == 1'050'250'000);
+    assert(ticks("0.1") == 100'000);
+    assert(ticks("1.005") == 1'005'000);
+    assert(ticks("-2.5") == -2'500'000);
+    assert(ticks("+7") == 7'000'000);
+    assert(ticks(".5") == 500'000);
+    assert(ticks("5.") == 5'000'000);
+    assert(ticks("1.5e3") == 1'500'000'000);
+    assert(ticks("15E-1") == 1'500'000);
+
+    // Digits below the scale round half away from zero.
+    assert(ticks("1.0000005") == 1'000'001);
+    assert(ticks("1.00000049999") == 1'000'000);
+    assert(ticks("-1.0000005") == -1'000'001);
+    assert(ticks("0.0000004") == 0);
+    assert(ticks("1e-30") == 0);
+
+    // Long inputs take the slow path and must agree with the fast one.
+    assert(ticks("000000000000000000000001.25") == 1'250'000);
+    assert(ticks("1.2500000000000000000000") == 1'250'000);
+    assert(ticks("9223372036854.7758065") == std::numeric_limits<int64_t>::max());
+    assert(ticks("123456789.1234564999999999") == 123'456'789'123'456);
+    assert(ticks("123456789.1234565000000000") == 123'456'789'123'457);
+
+    // Overflow and malformed input.
+    int64_t value = 42;
+    assert(parse("9223372036854.775808", 6, &value) == ARGENTUM_ERR_RANGE);
+    assert(parse("1e13", 6, &value) == ARGENTUM_ERR_RANGE);
+    assert(parse("92233720368547758070000000", 0, &value) == ARGENTUM_ERR_RANGE);
+    assert(parse("", 6, &value) == ARGENTUM_ERR_PARSE);
+    assert(parse("-", 6, &value) == ARGENTUM_ERR_PARSE);
+    assert(parse(".", 6, &value) == ARGENTUM_ERR_PARSE);
+    assert(parse("abc", 6, &value) == ARGENTUM_ERR_PARSE);
+    assert(value == 42);
+
+    // from_chars-style stop position: trailing text and a dangling exponent are not consumed.
+    size_t consumed = 0;
+    assert(parse("12.5|44=", 6, &value, &consumed) == ARGENTUM_OK && value == 12'500'000 && consumed == 4);
+    assert(parse("3e", 6, &value, &consumed) == ARGENTUM_OK && value == 3'000'000 && consumed == 1);
+    assert(parse("3e+", 6, &value, &consumed) == ARGENTUM_OK && consumed == 1);
+
+    // C++ wrappers require the whole string.
+    int64_t px = 0;
+    assert(core::parse_price_ticks("100.10", &px) && px == 100'100'000);
+    assert(!core::parse_price_ticks("100.10x", &px));
+    assert(!core::parse_quantity_lots("", &px));
+    assert(core::parse_quantity_lots(std::string("2.5"), &px) && px == 2'500'000);
+    return 0;
+}
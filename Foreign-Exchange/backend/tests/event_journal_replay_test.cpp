@@ -8,7 +8,9 @@
 #include <chrono>
 #include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <string>
 
@@ -99,6 +101,7 @@ int main() {
     CHECK(summary.active_orders.empty());
     CHECK(summary.committed_exposure_units == 0);
     CHECK(summary.net_position_lots == 0);
+    CHECK(summary.checksummed_events == summary.total_events);
 
     auto maker_hist_it = summary.order_history.find(1001);
     CHECK(maker_hist_it != summary.order_history.end());
@@ -108,6 +111,21 @@ int main() {
     CHECK(taker_hist_it != summary.order_history.end());
     CHECK(taker_hist_it->second.filled_lots > 0);
 
+    // A single altered byte must fail the per-line CRC-32C.
+    const std::string tampered_path = journal_path + ".tampered";
+    {
+        std::ifstream in(journal_path);
+        std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        const size_t pos = content.find("\"order_id\":1001");
+        CHECK(pos != std::string::npos);
+        content[pos + std::strlen("\"order_id\":1001") - 1] = '2';
+        std::ofstream out(tampered_path, std::ios::trunc);
+        out << content;
+    }
+    argentum::persist::ReplaySummary tampered{};
+    CHECK(!argentum::persist::EventReplayer::replay_file(tampered_path, &tampered));
+
+    std::filesystem::remove(tampered_path, ec);
     std::filesystem::remove(journal_path, ec);
     return 0;
 }
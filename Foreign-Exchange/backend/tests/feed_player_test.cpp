@@ -0,0 +1,89 @@
+#include "datafeed/feed_player.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+bool wait_for(const std::atomic<size_t>& value, size_t expected) {
+    for (int i = 0; i < 5000; ++i) {
+        if (value.load() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+} // namespace
+
+int main() {
+    std::filesystem::create_directories("data");
+    const std::filesystem::path path = "data/test_feed_player.jsonl";
+
+    // Mixed line endings, blank and malformed lines, no newline at end of file.
+    constexpr size_t kLines = 20000;
+    size_t valid = 0;
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        for (size_t i = 1; i <= kLines; ++i) {
+            if (i % 997 == 0) {
+                out << "{\"price\":\"oops\"}\n";
+                continue;
+            }
+            if (i % 501 == 0) out << "\r\n";
+            char line[160];
+            std::snprintf(line, sizeof(line),
+                          "{\"timestamp_ns\":%zu,\"price\":%zu.25,\"quantity\":1,\"symbol\":\"EURUSD\",\"side\":\"B\"}",
+                          i, i);
+            out << line << (i == kLines ? "" : (i % 3 == 0 ? "\r\n" : "\n"));
+            ++valid;
+        }
+    }
+
+    argentum::bus::InprocBusConfig config{};
+    config.policy = argentum::bus::BackpressurePolicy::Block;
+    auto bus = argentum::bus::create_inproc_bus(config);
+    argentum::bus::MarketTickTopic topic(bus, "market.ticks");
+
+    std::mutex mutex;
+    std::vector<uint64_t> seen;
+    std::atomic<size_t> received{0};
+    topic.subscribe([&](const MarketTick& tick) {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.push_back(tick.timestamp_ns);
+        received.fetch_add(1);
+    });
+
+    argentum::datafeed::FeedPlayer player(bus, "market.ticks");
+
+    // Small chunks and a narrow window force many reorder-buffer wraparounds.
+    argentum::datafeed::ParallelPlayOptions options{};
+    options.workers = 4;
+    options.chunk_bytes = 4096;
+    options.max_chunks_in_flight = 3;
+    assert(player.play_file_parallel(path.string(), FEED_FORMAT_JSON, options) == valid);
+    assert(wait_for(received, valid));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(seen.size() == valid);
+        for (size_t i = 1; i < seen.size(); ++i) assert(seen[i] > seen[i - 1]);
+        assert(seen.back() == kLines);
+        seen.clear();
+    }
+
+    // Defaults, and agreement with the sequential player.
+    received.store(0);
+    assert(player.play_file_parallel(path.string(), FEED_FORMAT_JSON) == valid);
+    assert(player.play_file(path.string(), FEED_FORMAT_JSON, 0) == valid);
+    assert(wait_for(received, 2 * valid));
+
+    assert(player.play_file_parallel("data/does_not_exist.jsonl", FEED_FORMAT_JSON) == 0);
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+    return 0;
+}
@@ -1,3 +1,4 @@
+#include "core/fix_tokenizer.h"
 #include "datafeed/market_parser.h"
 #include "gateway/fix_adapter.hpp"
 
@@ -40,5 +41,29 @@ int main() {
     CHECK(std::strcmp(tick.symbol, "BTC/USDT") == 0);
     CHECK(tick.side == SIDE_BUY || tick.side == SIDE_SELL);
 
+    // Tokenizer: whole-tag matches only, first occurrence wins, malformed tokens skipped.
+    const std::string tricky = "8=FIX.4.4\x01" "155=XXX\x01" "=7\x01" "abc\x01" "55=eurusd\x01" "55=gbpusd\x01" "44=";
+    CHECK(fix_detect_delimiter(tricky.data(), tricky.size()) == FIX_SOH);
+    const uint32_t tags[] = {55, 44, 38};
+    FixField found[3];
+    CHECK(fix_scan_tags(tricky.data(), tricky.size(), FIX_SOH, tags, 3, found) == 2);
+    CHECK(tricky.compare(found[0].offset, found[0].length, "eurusd") == 0);
+    CHECK(found[1].tag == 44 && found[1].length == 0 && found[1].offset == tricky.size());
+    CHECK(found[2].tag == 0);
+
+    size_t cursor = 0;
+    FixField field{};
+    int count = 0;
+    while (fix_next_field(tricky.data(), tricky.size(), FIX_SOH, &cursor, &field)) ++count;
+    CHECK(count == 5);
+
+    const std::string soh = "8=FIX.4.4\x01" "55=usdars\x01" "54=2\x01" "44=1050.5\x01" "38=10\x01";
+    CHECK(parse_market_message(FEED_FORMAT_FIX, soh.data(), soh.size(), &tick) == ARGENTUM_OK);
+    CHECK(std::strcmp(tick.symbol, "USD/ARS") == 0);
+    CHECK(tick.side == SIDE_SELL);
+    CHECK(std::strcmp(tick.source, "FIX") == 0);
+    const std::string missing_side = "55=usdars|44=1050.5|38=10|";
+    CHECK(parse_market_message(FEED_FORMAT_FIX, missing_side.data(), missing_side.size(), &tick) == ARGENTUM_ERR_PARSE);
+
     return 0;
 }
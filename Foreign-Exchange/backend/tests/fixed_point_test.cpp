@@ -0,0 +1,88 @@
+#include "core/fixed_point.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace argentum::core;
+
+namespace {
+constexpr detail::FixedPointKernel kKernels[] = {
+    detail::FixedPointKernel::Scalar,
+    detail::FixedPointKernel::Avx2,
+    detail::FixedPointKernel::Avx512,
+};
+
+bool same_bits(double a, double b) {
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+} // namespace
+
+int main() {
+    // Scalar rounding: half away from zero on the exact product, saturating, NaN -> 0.
+    assert(round_to_i64(0.5, 1) == 1);
+    assert(round_to_i64(-0.5, 1) == -1);
+    assert(round_to_i64(2.5, 1) == 3);
+    assert(round_to_i64(0.49999999999999994, 1) == 0);
+    assert(to_price_ticks(1050.25) == 1'050'250'000);
+    assert(to_price_ticks(0.1) == 100'000);
+    assert(to_price_ticks(-0.000001) == -1);
+    assert(to_quantity_lots(1e30) == std::numeric_limits<int64_t>::max());
+    assert(to_quantity_lots(-1e30) == std::numeric_limits<int64_t>::min());
+    assert(to_price_ticks(std::numeric_limits<double>::quiet_NaN()) == 0);
+    assert(to_price_ticks(std::numeric_limits<double>::infinity()) == 0);
+    assert(round_to_i64(4503599627370497.0, 1) == 4503599627370497LL);
+
+    // Batch kernels agree bit-for-bit with the scalar functions, including the lanes
+    // they hand back to the scalar path and a tail that is not a multiple of the width.
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> unit(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-12, 16);
+    std::vector<double> prices(1003);
+    for (size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = unit(rng) * std::pow(10.0, exponent(rng));
+    }
+    prices[5] = std::numeric_limits<double>::quiet_NaN();
+    prices[17] = -std::numeric_limits<double>::infinity();
+    prices[33] = 3e15; // beyond the vector range at 1e6 scale
+    prices[64] = 0.5e-6;
+    prices[65] = -0.5e-6;
+    prices[66] = -0.0;
+
+    std::vector<int64_t> ticks(prices.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        ticks[i] = static_cast<int64_t>(rng()) >> (rng() % 64);
+    }
+    ticks[3] = std::numeric_limits<int64_t>::min();
+    ticks[4] = std::numeric_limits<int64_t>::max();
+    ticks[9] = (int64_t{1} << 51) + 1;
+
+    for (detail::FixedPointKernel kernel : kKernels) {
+        std::vector<int64_t> rounded(prices.size(), -7);
+        detail::round_to_i64_batch_with(kernel, prices, kPriceScale, rounded);
+        for (size_t i = 0; i < prices.size(); ++i) {
+            assert(rounded[i] == to_price_ticks(prices[i]));
+        }
+
+        std::vector<double> back(ticks.size(), -7.0);
+        detail::to_double_batch_with(kernel, ticks, kQuantityScale, back);
+        for (size_t i = 0; i < ticks.size(); ++i) {
+            assert(same_bits(back[i], from_quantity_lots(ticks[i])));
+        }
+    }
+
+    // Public entry points use the best kernel; a short output span bounds the work.
+    std::vector<int64_t> out(10, -1);
+    to_price_ticks_batch(prices, std::span<int64_t>(out).first(8));
+    for (size_t i = 0; i < 8; ++i) assert(out[i] == to_price_ticks(prices[i]));
+    assert(out[8] == -1 && out[9] == -1);
+
+    std::vector<double> prices_back(ticks.size());
+    from_price_ticks_batch(ticks, prices_back);
+    for (size_t i = 0; i < ticks.size(); ++i) assert(same_bits(prices_back[i], from_price_ticks(ticks[i])));
+    return 0;
+}
@@ -0,0 +1,73 @@
+#include "datafeed/market_parser.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace {
+ArgentumStatus parse(const std::string& line, MarketTick* out) {
+    return parse_market_message(FEED_FORMAT_JSON, line.data(), line.size(), out);
+}
+
+bool near(double a, double b) {
+    return std::fabs(a - b) < 1e-9;
+}
+} // namespace
+
+int main() {
+    MarketTick tick{};
+
+    // Flat object, all fields.
+    assert(parse(R"({"timestamp_ns":1700000000000000001,"price":1050.25,"quantity":2.5,)"
+                 R"("symbol":"usd-ars","side":"BUY","source":"byma"})",
+                 &tick) == ARGENTUM_OK);
+    assert(tick.timestamp_ns == 1700000000000000001ULL);
+    assert(near(tick.price, 1050.25));
+    assert(near(tick.quantity, 2.5));
+    assert(std::strcmp(tick.symbol, "USD/ARS") == 0);
+    assert(tick.side == SIDE_BUY);
+    assert(std::strcmp(tick.source, "byma") == 0);
+
+    // Whitespace, quoted numbers, numeric side, volume/ts aliases, exponent.
+    assert(parse(" { \"ts\" : 42 , \"price\" : \"9.99\" , \"volume\" : 1e3 ,\n"
+                 " \"symbol\" : \"EURUSD\" , \"side\" : 2 } ",
+                 &tick) == ARGENTUM_OK);
+    assert(tick.timestamp_ns == 42);
+    assert(near(tick.price, 9.99));
+    assert(near(tick.quantity, 1000.0));
+    assert(tick.side == SIDE_SELL);
+    assert(tick.source[0] == '\0');
+
+    // timestamp_ns wins over ts and quantity over volume, regardless of order.
+    assert(parse(R"({"ts":1,"volume":7,"timestamp_ns":2,"quantity":3,"price":1,"symbol":"EURUSD","side":"s"})",
+                 &tick) == ARGENTUM_OK);
+    assert(tick.timestamp_ns == 2);
+    assert(near(tick.quantity, 3.0));
+
+    // Keys inside nested objects are still found; arrays and escaped strings are skipped.
+    assert(parse(R"({"type":"trade","tags":["a\"]",{"price":0}],"note":"x\\\"y",)"
+                 R"("data":{"price":-0.000001,"quantity":100,"symbol":"BTCUSDT","side":"b"}})",
+                 &tick) == ARGENTUM_OK);
+    assert(near(tick.price, -0.000001));
+    assert(std::strcmp(tick.symbol, "BTC/USDT") == 0);
+    assert(tick.side == SIDE_BUY);
+
+    // Digits below 1e-6 round half away from zero.
+    assert(parse(R"({"price":1.0000005,"quantity":0.0000004,"symbol":"EURUSD","side":1})", &tick) == ARGENTUM_OK);
+    assert(near(tick.price, 1.000001));
+    assert(near(tick.quantity, 0.0));
+
+    // Missing required fields, malformed values and truncation fail.
+    assert(parse(R"({"price":1,"symbol":"EURUSD","side":"B"})", &tick) == ARGENTUM_ERR_PARSE);
+    assert(parse(R"({"price":"abc","quantity":1,"symbol":"EURUSD","side":"B"})", &tick) == ARGENTUM_ERR_PARSE);
+    assert(parse(R"({"price":1,"quantity":1,"symbol":"EURUSD","side":3})", &tick) == ARGENTUM_ERR_PARSE);
+    assert(parse(R"({"price":1,"quantity":1,"symbol":"EURUSD","side":"X"})", &tick) == ARGENTUM_ERR_PARSE);
+    assert(parse(R"({"price":1e30,"quantity":1,"symbol":"EURUSD","side":"B"})", &tick) == ARGENTUM_ERR_PARSE);
+    assert(parse(R"({"price":1,"quantity":1,"symbol":"EU","side":"B"})", &tick) == ARGENTUM_ERR_INVALID);
+    const std::string full = R"({"price":1,"quantity":1,"symbol":"EURUSD","side":"B"})";
+    for (size_t cut = 0; cut < full.size(); ++cut) {
+        assert(parse(full.substr(0, cut), &tick) == ARGENTUM_ERR_PARSE);
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+#include "core/instrument_registry.hpp"
+#include "core/symbol_alias_table.hpp"
+#include "datafeed/l2_feed_handler.hpp"
+#include "gateway/smart_order_router.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+using argentum::datafeed::L2Action;
+using argentum::datafeed::L2ApplyResult;
+using argentum::datafeed::L2Book;
+using argentum::datafeed::L2LevelUpdate;
+using argentum::gateway::QuoteLevel;
+
+L2LevelUpdate level(uint8_t side, L2Action action, uint8_t index, int64_t price, int64_t size) {
+    return L2LevelUpdate{price, size, side, action, index};
+}
+
+SbeMarketEvent book_event(const char* symbol, uint32_t rpt_seq, uint8_t side, uint8_t action, uint8_t index, int64_t price) {
+    SbeMarketEvent ev{};
+    ev.template_id = SBE_TEMPLATE_BOOK_UPDATE;
+    ev.security_id = 7;
+    ev.rpt_seq = rpt_seq;
+    ev.transact_time_ns = 1000 + rpt_seq;
+    ev.price_ticks = price;
+    ev.quantity_lots = 5;
+    ev.side = side;
+    ev.update_action = action;
+    ev.price_level = index;
+    std::strncpy(ev.symbol, symbol, SBE_SYMBOL_LENGTH);
+    return ev;
+}
+} // namespace
+
+int main() {
+    auto& instruments = argentum::core::instrument_registry();
+    auto& venues = argentum::core::venue_registry();
+    const uint32_t eurusd = instruments.intern("EUR/USD");
+    const uint32_t venue_a = venues.intern("VENUE_A");
+    const uint32_t venue_b = venues.intern("VENUE_B");
+
+    argentum::datafeed::L2FeedHandler handler;
+    assert(handler.add_book(venue_a, eurusd) == handler.add_book(venue_a, eurusd));
+    assert(handler.add_book(venue_b, eurusd) != nullptr);
+
+    uint32_t gap_expected = 0;
+    uint32_t gap_received = 0;
+    handler.set_gap_handler([&](const L2Book&, uint32_t expected, uint32_t received) {
+        gap_expected = expected;
+        gap_received = received;
+    });
+
+    // Build a book: inserts shift lower levels down, deletes shift them up.
+    {
+        const L2LevelUpdate msg[] = {
+            level(SIDE_BUY, L2Action::New, 1, 100, 10),
+            level(SIDE_BUY, L2Action::New, 1, 101, 20),
+            level(SIDE_BUY, L2Action::New, 3, 99, 30),
+            level(SIDE_SELL, L2Action::New, 1, 103, 15),
+            level(SIDE_SELL, L2Action::New, 2, 104, 25),
+        };
+        assert(handler.apply(venue_a, eurusd, 1, 10, msg) == L2ApplyResult::Applied);
+    }
+    const L2Book* book = handler.find(venue_a, eurusd);
+    assert(book->bids().size() == 3);
+    assert(book->bids()[0].price_ticks == 101 && book->bids()[1].price_ticks == 100 && book->bids()[2].price_ticks == 99);
+    assert(book->asks().size() == 2 && book->asks()[0].size_lots == 15);
+    {
+        const L2LevelUpdate msg[] = {
+            level(SIDE_BUY, L2Action::Delete, 1, 0, 0),
+            level(SIDE_SELL, L2Action::Change, 2, 104, 40),
+        };
+        assert(handler.apply(venue_a, eurusd, 2, 20, msg) == L2ApplyResult::Applied);
+    }
+    assert(book->bids().size() == 2 && book->bids()[0].price_ticks == 100);
+    assert(book->asks()[1].size_lots == 40);
+
+    // Replayed sequences are dropped without touching the book.
+    {
+        const L2LevelUpdate msg[] = {level(SIDE_BUY, L2Action::Delete, 1, 0, 0)};
+        assert(handler.apply(venue_a, eurusd, 2, 20, msg) == L2ApplyResult::Duplicate);
+        assert(book->bids().size() == 2);
+    }
+
+    // Gap: the book clears, reports the hole and drops updates until a snapshot.
+    {
+        const L2LevelUpdate msg[] = {level(SIDE_BUY, L2Action::New, 1, 102, 1)};
+        assert(handler.apply(venue_a, eurusd, 5, 50, msg) == L2ApplyResult::Gap);
+        assert(gap_expected == 3 && gap_received == 5);
+        assert(!book->synced() && book->bids().empty());
+        assert(handler.apply(venue_a, eurusd, 6, 60, msg) == L2ApplyResult::Stale);
+
+        argentum::gateway::VenueOrderBookSnapshot untouched{};
+        assert(!book->snapshot_into(&untouched));
+
+        const QuoteLevel bids[] = {{100, 10}, {99, 20}};
+        const QuoteLevel asks[] = {{102, 30}};
+        handler.find(venue_a, eurusd)->apply_snapshot(6, 60, bids, asks);
+        assert(book->synced() && book->sequence() == 6);
+        assert(handler.apply(venue_a, eurusd, 6, 60, msg) == L2ApplyResult::Duplicate);
+        const L2LevelUpdate next[] = {level(SIDE_SELL, L2Action::Change, 1, 102, 35)};
+        assert(handler.apply(venue_a, eurusd, 7, 70, next) == L2ApplyResult::Applied);
+    }
+
+    // A level beyond the book is a desync, not a silent hole.
+    {
+        const L2LevelUpdate msg[] = {level(SIDE_BUY, L2Action::Change, 9, 1, 1)};
+        assert(handler.find(venue_b, eurusd)->apply(1, 1, msg) == L2ApplyResult::Invalid);
+        assert(!handler.find(venue_b, eurusd)->synced());
+        const QuoteLevel bids[] = {{101, 5}};
+        const QuoteLevel asks[] = {{101, 50}};
+        handler.find(venue_b, eurusd)->apply_snapshot(1, 1, bids, asks);
+    }
+
+    // Depth is capped: inserts past the last tracked level push the tail out.
+    {
+        L2Book deep(venue_a, eurusd);
+        for (uint32_t seq = 1; seq <= L2Book::kMaxDepth + 4; ++seq) {
+            const L2LevelUpdate msg[] = {level(SIDE_SELL, L2Action::New, 1, 1000 - seq, 1)};
+            assert(deep.apply(seq, seq, msg) == L2ApplyResult::Applied);
+        }
+        assert(deep.asks().size() == L2Book::kMaxDepth);
+        assert(deep.asks()[0].price_ticks == 1000 - static_cast<int64_t>(L2Book::kMaxDepth + 4));
+        const L2LevelUpdate beyond[] = {level(SIDE_SELL, L2Action::Delete, L2Book::kMaxDepth + 1, 0, 0)};
+        assert(deep.apply(L2Book::kMaxDepth + 5, 0, beyond) == L2ApplyResult::Applied);
+        assert(deep.truncated_updates() == 1 && !deep.needs_snapshot());
+
+        // The venue is deeper than the book, so a Delete leaves the held side short.
+        const L2LevelUpdate pull[] = {level(SIDE_SELL, L2Action::Delete, 1, 0, 0)};
+        assert(deep.apply(L2Book::kMaxDepth + 6, 0, pull) == L2ApplyResult::Applied);
+        assert(deep.asks().size() == L2Book::kMaxDepth - 1 && deep.needs_snapshot() && deep.synced());
+        const QuoteLevel bids[] = {{900, 1}};
+        const QuoteLevel asks[] = {{1000, 1}};
+        deep.apply_snapshot(L2Book::kMaxDepth + 6, 0, bids, asks);
+        assert(!deep.needs_snapshot());
+        const L2LevelUpdate shallow[] = {level(SIDE_SELL, L2Action::Delete, 1, 0, 0)};
+        assert(deep.apply(L2Book::kMaxDepth + 7, 0, shallow) == L2ApplyResult::Applied);
+        assert(deep.asks().empty() && !deep.needs_snapshot());
+    }
+
+    // Through the handler, a short book is counted and reported like a gap at its own sequence.
+    {
+        const uint32_t gbpusd = instruments.intern("GBP/USD");
+        L2Book* gbp = handler.add_book(venue_a, gbpusd);
+        std::vector<QuoteLevel> asks;
+        for (int64_t i = 0; i <= static_cast<int64_t>(L2Book::kMaxDepth); ++i) asks.push_back({200 + i, 1});
+        gbp->apply_snapshot(10, 0, {}, asks);
+        assert(gbp->asks().size() == L2Book::kMaxDepth);
+        const L2LevelUpdate msg[] = {level(SIDE_SELL, L2Action::Delete, 1, 0, 0),
+                                     level(SIDE_SELL, L2Action::Change, L2Book::kMaxDepth + 2, 240, 1)};
+        assert(handler.apply(venue_a, gbpusd, 11, 0, msg) == L2ApplyResult::Applied);
+        assert(gap_expected == 11 && gap_received == 11);
+        assert(handler.stats().short_books == 1 && handler.stats().truncated == 1);
+    }
+
+    // Snapshots feed the router directly.
+    std::vector<argentum::gateway::VenueOrderBookSnapshot> books;
+    assert(handler.collect_snapshots(eurusd, &books) == 2);
+    assert(handler.collect_snapshots(eurusd, &books, 1) == 2);
+    assert(books[0].venue_id == "VENUE_A" && books[0].symbol == "EUR/USD");
+    assert(books[0].bid_levels.size() == 1 && books[0].ask_levels[0].size_lots == 35);
+
+    argentum::gateway::SmartOrderRouter router;
+    Order order{};
+    order.order_id = 1;
+    order.side = SIDE_BUY;
+    order.type = ORDER_TYPE_MARKET;
+    order.quantity_lots = 60;
+    const auto decision = router.route_l2(order, books);
+    assert(decision.accepted);
+    assert(decision.legs.size() == 2);
+    assert(decision.legs[0].venue_id == "VENUE_B" && decision.legs[0].requested_lots == 50);
+    assert(decision.legs[1].venue_id == "VENUE_A" && decision.legs[1].requested_lots == 10);
+
+    // SBE BookUpdate entries sharing an rpt_seq apply as one message.
+    {
+        const SbeMarketEvent events[] = {
+            book_event("EURUSD", 8, SIDE_BUY, SBE_ACTION_NEW, 1, 101),
+            book_event("EURUSD", 8, SIDE_SELL, SBE_ACTION_DELETE, 1, 0),
+            book_event("EURUSD", 9, SIDE_BUY, SBE_ACTION_CHANGE, 1, 101),
+            book_event("EURUSD", 9, SIDE_BUY, SBE_ACTION_CHANGE, 1, 101),
+        };
+        argentum::core::symbol_aliases().add_instrument("EUR/USD");
+        assert(argentum::core::symbol_aliases().build());
+        assert(handler.apply_sbe_events(venue_a, events) == 2);
+        assert(book->sequence() == 9 && book->bids()[0].price_ticks == 101 && book->asks().empty());
+    }
+
+    // Readers on another thread never see a torn book: the writer keeps size == price.
+    {
+        L2Book shared(venue_a, eurusd);
+        std::atomic<bool> done{false};
+        std::thread reader([&] {
+            argentum::gateway::VenueOrderBookSnapshot snap{};
+            while (!done.load(std::memory_order_acquire)) {
+                if (!shared.snapshot_into(&snap)) continue;
+                for (const QuoteLevel& lvl : snap.bid_levels) assert(lvl.size_lots == lvl.price_ticks);
+                if (snap.timestamp_ns < 5) continue;
+                for (size_t i = 1; i < snap.bid_levels.size(); ++i) {
+                    assert(snap.bid_levels[i].price_ticks == snap.bid_levels[0].price_ticks);
+                }
+            }
+        });
+        for (uint32_t seq = 1; seq <= 200'000; ++seq) {
+            const int64_t px = seq;
+            L2LevelUpdate msg[4];
+            const uint8_t action = seq <= 4 ? 0 : 1;
+            for (uint8_t i = 0; i < 4; ++i) {
+                msg[i] = level(SIDE_BUY, static_cast<L2Action>(action), action == 0 ? 1 : i + 1, px, px);
+            }
+            assert(shared.apply(seq, seq, std::span<const L2LevelUpdate>(msg, action == 0 ? 1 : 4)) == L2ApplyResult::Applied);
+        }
+        done.store(true, std::memory_order_release);
+        reader.join();
+    }
+
+    const auto& stats = handler.stats();
+    assert(stats.gaps == 1 && stats.stale == 1 && stats.duplicates == 2);
+    return 0;
+}
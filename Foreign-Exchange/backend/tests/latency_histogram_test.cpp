@@ -0,0 +1,43 @@
+#include "core/latency_histogram.hpp"
+
+#include <cassert>
+#include <cstdint>
+
+int main() {
+    using argentum::core::LatencyHistogram;
+
+    // Small values are exact; larger ones land in a bucket whose upper bound covers them.
+    for (uint64_t v = 0; v < LatencyHistogram::kSubBuckets; ++v) {
+        assert(LatencyHistogram::bucket_index(v) == v);
+        assert(LatencyHistogram::bucket_upper(LatencyHistogram::bucket_index(v)) == v);
+    }
+    const uint64_t samples[] = {16, 17, 31, 32, 1000, 123456, 987654321, UINT64_MAX};
+    for (uint64_t v : samples) {
+        const uint32_t index = LatencyHistogram::bucket_index(v);
+        assert(index < LatencyHistogram::kBucketCount);
+        const uint64_t upper = LatencyHistogram::bucket_upper(index);
+        assert(upper >= v);
+        assert(upper - v <= v / LatencyHistogram::kSubBuckets);
+    }
+
+    LatencyHistogram hist;
+    assert(hist.percentiles().count == 0);
+
+    // 1..1000 ns uniform, plus one 1 ms outlier.
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        hist.record(v);
+    }
+    hist.record(1'000'000);
+
+    const argentum::core::LatencyPercentiles p = hist.percentiles();
+    assert(p.count == 1001);
+    assert(p.max_ns == 1'000'000);
+    assert(p.p50_ns >= 500 && p.p50_ns <= 500 + 500 / 16);
+    assert(p.p99_ns >= 990 && p.p99_ns <= 990 + 990 / 16);
+    assert(p.p999_ns >= 1000 && p.p999_ns <= 1000 + 1000 / 16);
+
+    hist.reset();
+    assert(hist.count() == 0);
+    assert(hist.percentiles().max_ns == 0);
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include "datafeed/feed_player.hpp"
+#include "datafeed/line_arbitrator.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+using argentum::datafeed::ArbitrationResult;
+using argentum::datafeed::FeedLine;
+using argentum::datafeed::LineArbitrator;
+using argentum::datafeed::LineGap;
+
+bool wait_for(const std::atomic<size_t>& value, size_t expected) {
+    for (int i = 0; i < 5000; ++i) {
+        if (value.load() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+void write_line(std::ofstream& out, uint64_t seq, uint64_t ts) {
+    char line[160];
+    std::snprintf(line, sizeof(line),
+                  "{\"seq\":%llu,\"timestamp_ns\":%llu,\"price\":1.25,\"quantity\":1,\"symbol\":\"EURUSD\",\"side\":\"B\"}\n",
+                  static_cast<unsigned long long>(seq), static_cast<unsigned long long>(ts));
+    out << line;
+}
+} // namespace
+
+int main() {
+    // First arrival wins from either line; later copies are duplicates.
+    {
+        LineArbitrator arb(64);
+        assert(arb.window() == 64);
+        assert(arb.on_message(FeedLine::A, 100) == ArbitrationResult::Accepted);
+        assert(arb.on_message(FeedLine::B, 100) == ArbitrationResult::Duplicate);
+        assert(arb.on_message(FeedLine::B, 101) == ArbitrationResult::Accepted);
+        assert(arb.on_message(FeedLine::A, 101) == ArbitrationResult::Duplicate);
+        assert(arb.on_message(FeedLine::A, 99) == ArbitrationResult::Stale);
+        assert(arb.stats().won[0] == 1 && arb.stats().won[1] == 1);
+        assert(arb.stats().duplicates == 2 && arb.stats().stale == 1);
+    }
+
+    // A hole on one line is filled by the other without being reported.
+    {
+        std::vector<LineGap> gaps;
+        LineArbitrator arb(64);
+        arb.set_gap_handler([&](const LineGap& gap) { gaps.push_back(gap); });
+        assert(arb.on_message(FeedLine::A, 1) == ArbitrationResult::Accepted);
+        assert(arb.on_message(FeedLine::A, 4) == ArbitrationResult::Accepted);
+        assert(arb.on_message(FeedLine::B, 2) == ArbitrationResult::Recovered);
+        assert(arb.on_message(FeedLine::B, 3) == ArbitrationResult::Recovered);
+        assert(arb.on_message(FeedLine::B, 4) == ArbitrationResult::Duplicate);
+        for (uint64_t seq = 5; seq < 500; ++seq) assert(arb.on_message(FeedLine::A, seq) == ArbitrationResult::Accepted);
+        arb.finish();
+        assert(gaps.empty());
+        assert(arb.stats().recovered == 2 && arb.stats().lost == 0);
+    }
+
+    // Holes neither line fills are reported once they leave the window, coalesced.
+    {
+        std::vector<LineGap> gaps;
+        LineArbitrator arb(64);
+        arb.set_gap_handler([&](const LineGap& gap) { gaps.push_back(gap); });
+        for (uint64_t seq = 1; seq <= 10; ++seq) arb.on_message(FeedLine::A, seq);
+        arb.on_message(FeedLine::A, 15); // 11..14 missing
+        assert(gaps.empty());
+        for (uint64_t seq = 16; seq <= 100; ++seq) arb.on_message(FeedLine::B, seq);
+        assert(gaps.size() == 1 && gaps[0].first_seq == 11 && gaps[0].last_seq == 14);
+        assert(arb.on_message(FeedLine::A, 12) == ArbitrationResult::Stale);
+
+        // A jump past the whole window: the skipped range is one gap, reported once
+        // the first delivered sequence after it leaves the window.
+        arb.on_message(FeedLine::A, 1000);
+        for (uint64_t seq = 1001; seq < 1064; ++seq) arb.on_message(FeedLine::A, seq);
+        assert(gaps.size() == 1);
+        arb.on_message(FeedLine::A, 1064);
+        assert(gaps.size() == 2 && gaps[1].first_seq == 101 && gaps[1].last_seq == 999);
+
+        // Holes still open at the end of the session are flushed by finish().
+        arb.on_message(FeedLine::A, 1067);
+        arb.finish();
+        assert(gaps.size() == 3 && gaps[2].first_seq == 1065 && gaps[2].last_seq == 1066);
+        assert(arb.stats().lost == 4 + 899 + 2 && arb.stats().gaps == 3);
+
+        // finish() starts a new session.
+        assert(arb.on_message(FeedLine::B, 5) == ArbitrationResult::Accepted);
+    }
+
+    // Feed sequence numbers: JSON "seq", FIX MsgSeqNum (34); 0 when absent.
+    {
+        MarketTick tick{};
+        uint64_t seq = 99;
+        const char fix[] = "8=FIX.4.4|34=4711|55=EUR/USD|54=1|44=1.1|38=2|";
+        assert(parse_market_message_seq(FEED_FORMAT_FIX, fix, sizeof(fix) - 1, &tick, &seq) == ARGENTUM_OK);
+        assert(seq == 4711);
+        const char json[] = "{\"price\":1,\"quantity\":1,\"symbol\":\"EURUSD\",\"side\":\"S\"}";
+        assert(parse_market_message_seq(FEED_FORMAT_JSON, json, sizeof(json) - 1, &tick, &seq) == ARGENTUM_OK);
+        assert(seq == 0);
+    }
+
+    // Two local replay captures: each line drops different messages and B lags A.
+    std::filesystem::create_directories("data");
+    const std::filesystem::path path_a = "data/test_line_a.jsonl";
+    const std::filesystem::path path_b = "data/test_line_b.jsonl";
+    constexpr uint64_t kMessages = 5000;
+    size_t expected = 0;
+    {
+        std::ofstream a(path_a, std::ios::binary | std::ios::trunc);
+        std::ofstream b(path_b, std::ios::binary | std::ios::trunc);
+        for (uint64_t seq = 1; seq <= kMessages; ++seq) {
+            const bool lost_on_both = seq == 2500 || seq == 2501;
+            if (seq % 7 != 0 && !lost_on_both) write_line(a, seq, seq * 1000);
+            if (seq % 7 != 3 && !lost_on_both) write_line(b, seq, seq * 1000 + 300);
+            if (!lost_on_both) ++expected;
+        }
+    }
+
+    argentum::bus::InprocBusConfig config{};
+    config.policy = argentum::bus::BackpressurePolicy::Block;
+    auto bus = argentum::bus::create_inproc_bus(config);
+    argentum::bus::MarketTickTopic topic(bus, "market.ticks");
+
+    std::mutex mutex;
+    std::vector<uint64_t> seen;
+    std::atomic<size_t> received{0};
+    topic.subscribe([&](const MarketTick& tick) {
+        std::lock_guard<std::mutex> lock(mutex);
+        seen.push_back(tick.timestamp_ns);
+        received.fetch_add(1);
+    });
+
+    std::vector<LineGap> gaps;
+    LineArbitrator arb;
+    arb.set_gap_handler([&](const LineGap& gap) { gaps.push_back(gap); });
+    argentum::datafeed::FeedPlayer player(bus, "market.ticks");
+    assert(player.play_arbitrated(path_a.string(), path_b.string(), FEED_FORMAT_JSON, &arb) == expected);
+    assert(wait_for(received, expected));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        assert(seen.size() == expected);
+        // Every delivered tick is unique, and B only wins where A dropped the message.
+        for (size_t i = 1; i < seen.size(); ++i) assert(seen[i] / 1000 > seen[i - 1] / 1000);
+        for (uint64_t ts : seen) assert((ts % 1000 == 0) == ((ts / 1000) % 7 != 0));
+    }
+    assert(gaps.size() == 1 && gaps[0].first_seq == 2500 && gaps[0].last_seq == 2501);
+    assert(arb.stats().won[1] == kMessages / 7);
+    assert(arb.stats().duplicates > 0);
+
+    // One dead line: the other carries the feed alone.
+    received.store(0);
+    LineArbitrator solo;
+    const size_t solo_expected = kMessages - kMessages / 7 - 2;
+    assert(player.play_arbitrated(path_a.string(), "data/missing_line_b.jsonl", FEED_FORMAT_JSON, &solo) == solo_expected);
+    assert(wait_for(received, solo_expected));
+    assert(solo.stats().won[1] == 0 && solo.stats().gaps > 0);
+
+    std::filesystem::remove(path_a);
+    std::filesystem::remove(path_b);
+    return 0;
+}
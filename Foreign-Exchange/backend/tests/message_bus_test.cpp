@@ -1,7 +1,24 @@
 #include "bus/message_bus.hpp"
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+bool wait_until(const std::atomic<int>& value, int expected) {
+    for (int i = 0; i < 2000; ++i) {
+        if (value.load() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+} // namespace
 
 int main() {
     argentum::bus::InprocBusConfig config;
@@ -21,5 +38,144 @@ int main() {
     assert(metrics.queue_depth == 2);
     assert(metrics.drops == 1);
 
+    // Per-topic wait strategies: spinning consumers never park, SpinPark parks once idle.
+    argentum::bus::InprocBusConfig wait_config;
+    wait_config.wait = {argentum::bus::WaitStrategy::SpinPark, 64};
+    wait_config.topic_wait["market.ticks"] = {argentum::bus::WaitStrategy::BusySpin, 0};
+    wait_config.topic_wait["orders.yield"] = {argentum::bus::WaitStrategy::SpinYield, 64};
+    auto wait_bus = argentum::bus::create_inproc_bus(wait_config);
+
+    std::atomic<int> ticks{0};
+    std::atomic<int> orders{0};
+    std::atomic<int> yielded{0};
+    wait_bus->subscribe("market.ticks", [&](const void*, size_t) { ticks.fetch_add(1); });
+    wait_bus->subscribe("orders.new", [&](const void*, size_t) { orders.fetch_add(1); });
+    wait_bus->subscribe("orders.yield", [&](const void*, size_t) { yielded.fetch_add(1); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    for (int i = 0; i < 10; ++i) {
+        assert(wait_bus->publish("market.ticks", payload, sizeof(payload)) == ARGENTUM_OK);
+        assert(wait_bus->publish("orders.new", payload, sizeof(payload)) == ARGENTUM_OK);
+        assert(wait_bus->publish("orders.yield", payload, sizeof(payload)) == ARGENTUM_OK);
+    }
+    assert(wait_until(ticks, 10));
+    assert(wait_until(orders, 10));
+    assert(wait_until(yielded, 10));
+
+    assert(wait_bus->get_metrics("market.ticks", &metrics));
+    assert(metrics.wait_spins > 0);
+    assert(metrics.wait_parks == 0);
+    assert(metrics.publish_latency.count == 10);
+    assert(metrics.dwell.count == 10);
+    // Callback duration is recorded after the callback returns; allow the last one to land.
+    for (int i = 0; i < 2000 && metrics.callback.count < 10; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        wait_bus->get_metrics("market.ticks", &metrics);
+    }
+    assert(metrics.callback.count == 10);
+    assert(metrics.dwell.p50_ns <= metrics.dwell.p99_ns);
+    assert(metrics.dwell.p999_ns <= metrics.dwell.max_ns);
+    assert(wait_bus->get_metrics("orders.new", &metrics));
+    assert(metrics.wait_parks > 0);
+    assert(wait_bus->get_metrics("orders.yield", &metrics));
+    assert(metrics.wait_yields > 0);
+    assert(metrics.wait_parks == 0);
+
+    // Unsubscribe: returns once no consumer dispatches the removed callback any more.
+    auto sub_bus = argentum::bus::create_inproc_bus(argentum::bus::InprocBusConfig{});
+    std::atomic<int> first{0};
+    std::atomic<int> second{0};
+    const argentum::bus::SubscriptionId first_id =
+        sub_bus->subscribe("orders.fills", [&](const void*, size_t) { first.fetch_add(1); });
+    const argentum::bus::SubscriptionId second_id =
+        sub_bus->subscribe("orders.fills", [&](const void*, size_t) { second.fetch_add(1); });
+    assert(first_id != argentum::bus::kInvalidSubscription);
+    assert(second_id != first_id);
+
+    assert(sub_bus->publish("orders.fills", payload, sizeof(payload)) == ARGENTUM_OK);
+    assert(wait_until(first, 1));
+    assert(wait_until(second, 1));
+
+    assert(sub_bus->unsubscribe("orders.fills", first_id));
+    assert(!sub_bus->unsubscribe("orders.fills", first_id));
+    assert(!sub_bus->unsubscribe("orders.unknown", second_id));
+    const int first_after = first.load();
+    for (int i = 0; i < 5; ++i) {
+        assert(sub_bus->publish("orders.fills", payload, sizeof(payload)) == ARGENTUM_OK);
+    }
+    assert(wait_until(second, 6));
+    assert(first.load() == first_after);
+
+    // A callback may remove itself from its own consumer thread.
+    std::atomic<int> once{0};
+    argentum::bus::SubscriptionId once_id = argentum::bus::kInvalidSubscription;
+    std::atomic<bool> once_ready{false};
+    once_id = sub_bus->subscribe("orders.once", [&](const void*, size_t) {
+        while (!once_ready.load()) {
+            std::this_thread::yield();
+        }
+        once.fetch_add(1);
+        sub_bus->unsubscribe("orders.once", once_id);
+    });
+    once_ready.store(true);
+    assert(sub_bus->publish("orders.once", payload, sizeof(payload)) == ARGENTUM_OK);
+    assert(sub_bus->publish("orders.once", payload, sizeof(payload)) == ARGENTUM_OK);
+    assert(wait_until(once, 1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    assert(once.load() == 1);
+
+    // Conflated topic: while the consumer is busy, a newer message replaces the queued one
+    // with the same key. Payloads here are {key, value}; one-byte payloads are unkeyed.
+    {
+        argentum::bus::InprocBusConfig conflate_config;
+        conflate_config.topic_conflation["market.ticks.ws"] = [](const void* data, size_t size, argentum::bus::ConflationKey* key) {
+            if (size < 2) return false;
+            key->lo = static_cast<const uint8_t*>(data)[0];
+            return true;
+        };
+        auto conflate_bus = argentum::bus::create_inproc_bus(conflate_config);
+
+        std::atomic<bool> release{false};
+        std::atomic<int> delivered{0};
+        std::mutex seen_mtx;
+        std::vector<std::array<char, 2>> seen;
+        conflate_bus->subscribe("market.ticks.ws", [&](const void* data, size_t size) {
+            std::array<char, 2> msg{static_cast<const char*>(data)[0], size > 1 ? static_cast<const char*>(data)[1] : '\0'};
+            delivered.fetch_add(1);
+            while (!release.load()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            std::lock_guard<std::mutex> lock(seen_mtx);
+            seen.push_back(msg);
+        });
+
+        const char warm[1] = {'W'};
+        assert(conflate_bus->publish("market.ticks.ws", warm, sizeof(warm)) == ARGENTUM_OK);
+        assert(wait_until(delivered, 1));
+
+        for (const char* msg : {"B1", "B2", "B3", "E1", "E2"}) {
+            assert(conflate_bus->publish("market.ticks.ws", msg, 2) == ARGENTUM_OK);
+        }
+        argentum::bus::TopicMetrics conflated{};
+        assert(conflate_bus->get_metrics("market.ticks.ws", &conflated));
+        assert(conflated.queue_depth == 2);
+        assert(conflated.conflated == 3);
+        assert(conflated.published == 6);
+
+        release.store(true);
+        assert(wait_until(delivered, 3));
+        for (int i = 0; i < 2000; ++i) {
+            {
+                std::lock_guard<std::mutex> lock(seen_mtx);
+                if (seen.size() == 3) break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        std::lock_guard<std::mutex> lock(seen_mtx);
+        assert(seen.size() == 3);
+        assert(seen[1][0] == 'B' && seen[1][1] == '3');
+        assert(seen[2][0] == 'E' && seen[2][1] == '2');
+    }
+
     return 0;
 }
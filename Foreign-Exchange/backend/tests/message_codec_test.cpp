@@ -1,16 +1,33 @@
 #include "codec/market_tick_codec.hpp"
 #include "bus/message_protocol.hpp"
+#include "codec/compact_tick_codec.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstring>
+#include <vector>
+
+namespace {
+std::vector<uint8_t> encode_tick(const char* symbol, double price) {
+    MarketTick tick{};
+    tick.timestamp_ns = 1700000000000000000ULL;
+    tick.price = price;
+    tick.quantity = 1.0;
+    std::memcpy(tick.symbol, symbol, std::min(std::strlen(symbol), sizeof(tick.symbol) - 1));
+    std::vector<uint8_t> payload;
+    assert(argentum::codec::encode_market_tick_legacy(tick, &payload) == ARGENTUM_OK);
+    return payload;
+}
+} // namespace
 
 int main() {
     MarketTick tick{};
     tick.timestamp_ns = 1700000000000000000ULL;
     tick.price = 50000.25;
     tick.quantity = 0.42;
-    std::strncpy(tick.symbol, "BTC/USDT", sizeof(tick.symbol) - 1);
-    std::strncpy(tick.source, "BINANCE", sizeof(tick.source) - 1);
+    std::memcpy(tick.symbol, "BTC/USDT", std::strlen("BTC/USDT"));
+    std::memcpy(tick.source, "BINANCE", std::strlen("BINANCE"));
     tick.side = SIDE_BUY;
 
     std::vector<uint8_t> payload;
@@ -28,6 +45,24 @@ int main() {
 
     assert(argentum::codec::decode_market_tick(payload.data(), 4, &decoded) == ARGENTUM_ERR_PROTO);
 
+    // Span encoders produce the same frame without touching the heap.
+    std::array<uint8_t, argentum::codec::kMarketTickMaxEncodedBytes> frame{};
+    size_t frame_size = 0;
+    assert(argentum::codec::encode_market_tick_legacy_into(tick, frame, &frame_size) == ARGENTUM_OK);
+    assert(frame_size == payload.size());
+    assert(std::memcmp(frame.data(), payload.data(), frame_size) == 0);
+
+    std::vector<uint8_t> bus_payload;
+    assert(argentum::codec::encode_market_tick(tick, &bus_payload) == ARGENTUM_OK);
+    assert(argentum::codec::encode_market_tick_into(tick, frame, &frame_size) == ARGENTUM_OK);
+    assert(frame_size == bus_payload.size());
+    assert(std::memcmp(frame.data(), bus_payload.data(), frame_size) == 0);
+
+    // Too small: nothing written, required length reported.
+    size_t required = 0;
+    assert(argentum::codec::encode_market_tick_into(tick, std::span<uint8_t>(frame.data(), 8), &required) == ARGENTUM_ERR_RANGE);
+    assert(required == frame_size);
+
     // CRC validation (V2)
     const uint8_t raw_payload[4] = {1, 2, 3, 4};
     auto msg_v2 = argentum::bus::encode_message_v2(
@@ -40,10 +75,53 @@ int main() {
     argentum::bus::DecodedHeader hdr{};
     assert(argentum::bus::decode_header(msg_v2.data(), msg_v2.size(), &hdr) == ARGENTUM_OK);
 
+    // encode_message_v2_into matches the vector form byte for byte.
+    std::array<uint8_t, 64> v2_frame{};
+    size_t v2_size = 0;
+    assert(argentum::bus::encode_message_v2_into(argentum::bus::MessageType::MarketTick,
+                                                 raw_payload,
+                                                 sizeof(raw_payload),
+                                                 1234,
+                                                 static_cast<uint32_t>(argentum::bus::MessageFlags::HasCrc32),
+                                                 v2_frame,
+                                                 &v2_size) == ARGENTUM_OK);
+    assert(v2_size == msg_v2.size());
+    assert(std::memcmp(v2_frame.data(), msg_v2.data(), v2_size) == 0);
+
     // Corrupt payload and expect CRC failure.
     msg_v2.back() ^= 0xFF;
     assert(argentum::bus::decode_header(msg_v2.data(), msg_v2.size(), &hdr) == ARGENTUM_ERR_PROTO);
 
+    // Checksum kind travels in the flags; every kind round-trips and detects corruption.
+    const argentum::core::ChecksumKind kinds[] = {
+        argentum::core::ChecksumKind::Crc32,
+        argentum::core::ChecksumKind::Crc32c,
+        argentum::core::ChecksumKind::XxHash32};
+    for (auto kind : kinds) {
+        auto framed = argentum::bus::encode_message_v2(
+            argentum::bus::MessageType::MarketTick, raw_payload, sizeof(raw_payload), 1234,
+            argentum::bus::checksum_flags(kind));
+        assert(argentum::bus::decode_header(framed.data(), framed.size(), &hdr) == ARGENTUM_OK);
+        assert(argentum::bus::checksum_kind_from_flags(hdr.header.flags) == kind);
+        assert(hdr.header.crc32 == argentum::core::compute_checksum(kind, raw_payload, sizeof(raw_payload)));
+        framed.back() ^= 0x01;
+        assert(argentum::bus::decode_header(framed.data(), framed.size(), &hdr) == ARGENTUM_ERR_PROTO);
+    }
+
+    // Plain HasCrc32 (kind bits zero) is CRC-32, as before the field existed.
+    auto legacy_crc = argentum::bus::encode_message_v2(
+        argentum::bus::MessageType::MarketTick, raw_payload, sizeof(raw_payload), 1234,
+        static_cast<uint32_t>(argentum::bus::MessageFlags::HasCrc32));
+    assert(argentum::bus::decode_header(legacy_crc.data(), legacy_crc.size(), &hdr) == ARGENTUM_OK);
+    assert(hdr.header.crc32 == argentum::core::crc32(raw_payload, sizeof(raw_payload)));
+
+    // Unknown checksum kinds are rejected rather than skipped.
+    argentum::bus::MessageHeaderV2 unknown_kind{};
+    std::memcpy(&unknown_kind, legacy_crc.data(), sizeof(unknown_kind));
+    unknown_kind.flags |= 0xFU << argentum::bus::kChecksumKindShift;
+    std::memcpy(legacy_crc.data(), &unknown_kind, sizeof(unknown_kind));
+    assert(argentum::bus::decode_header(legacy_crc.data(), legacy_crc.size(), &hdr) == ARGENTUM_ERR_PROTO);
+
     // Invalid size should fail.
     argentum::bus::MessageHeaderV1 bad_hdr{};
     bad_hdr.version = argentum::bus::kMessageProtocolVersionV1;
@@ -54,5 +132,38 @@ int main() {
     std::memcpy(bad_buf.data(), &bad_hdr, sizeof(bad_hdr));
     assert(argentum::bus::decode_header(bad_buf.data(), bad_buf.size(), &hdr) == ARGENTUM_ERR_PROTO);
 
+    // Conflation key: one key per symbol, independent of price; undecodable payloads are unkeyed.
+    argentum::bus::ConflationKey key_a{};
+    argentum::bus::ConflationKey key_b{};
+    argentum::bus::ConflationKey key_c{};
+    auto btc_1 = encode_tick("BTC/USDT", 1.0);
+    auto btc_2 = encode_tick("BTC/USDT", 2.0);
+    auto eth_1 = encode_tick("ETH/USDT", 1.0);
+    assert(argentum::codec::market_tick_conflation_key(btc_1.data(), btc_1.size(), &key_a));
+    assert(argentum::codec::market_tick_conflation_key(btc_2.data(), btc_2.size(), &key_b));
+    assert(argentum::codec::market_tick_conflation_key(eth_1.data(), eth_1.size(), &key_c));
+    assert(key_a == key_b);
+    assert(!(key_a == key_c));
+    assert(!argentum::codec::market_tick_conflation_key(raw_payload, sizeof(raw_payload), &key_a));
+
+    // Keys hold the symbol itself, so symbols differing only in their last byte stay apart.
+    auto long_a = encode_tick("ABCDEFGHIJKLMNA", 1.0);
+    auto long_b = encode_tick("ABCDEFGHIJKLMNB", 1.0);
+    assert(argentum::codec::market_tick_conflation_key(long_a.data(), long_a.size(), &key_a));
+    assert(argentum::codec::market_tick_conflation_key(long_b.data(), long_b.size(), &key_b));
+    assert(!(key_a == key_b));
+
+    // Single-tick V3 frames are keyed on the instrument id; multi-tick batches are unkeyed.
+    std::vector<uint8_t> compact;
+    assert(argentum::codec::encode_compact_tick(tick, &compact) == ARGENTUM_OK);
+    assert(argentum::codec::market_tick_conflation_key(compact.data(), compact.size(), &key_a));
+    assert(argentum::codec::market_tick_conflation_key(compact.data(), compact.size(), &key_b));
+    assert(key_a == key_b);
+    argentum::codec::CompactTickBatchHeader batch{};
+    std::memcpy(&batch, compact.data() + sizeof(argentum::bus::MessageHeaderV2), sizeof(batch));
+    batch.count = 2;
+    std::memcpy(compact.data() + sizeof(argentum::bus::MessageHeaderV2), &batch, sizeof(batch));
+    assert(!argentum::codec::market_tick_conflation_key(compact.data(), compact.size(), &key_a));
+
     return 0;
 }
@@ -0,0 +1,147 @@
+#include "core/mpsc_ring.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+using Ring = argentum::core::MpscRing<uint64_t>;
+}
+
+int main() {
+    // Capacity bounds queued values; claimed values do not count against it.
+    {
+        Ring ring(6, 4);
+        assert(ring.slot_count() == 16);
+        for (uint64_t i = 0; i < 6; ++i) assert(ring.try_push(i));
+        assert(!ring.try_push(99));
+        auto run = ring.claim(10);
+        assert(run.size() == 4 && run[0] == 0 && run[3] == 3);
+        for (uint64_t i = 6; i < 10; ++i) assert(ring.try_push(i));
+        assert(!ring.try_push(99));
+        ring.release(run.size());
+        run = ring.claim(4);
+        assert(run.size() == 4 && run[0] == 4);
+        ring.release(run.size());
+    }
+
+    // capacity + max_claim an exact power of two: a full claimed run plus a full queue
+    // still leaves the head slot free, so one overflow evicts exactly one value.
+    {
+        Ring ring(4, 4);
+        assert(ring.slot_count() > 8);
+        uint64_t evicted = 0;
+        for (uint64_t i = 0; i < 4; ++i) assert(ring.try_push(i));
+        auto run = ring.claim(4);
+        assert(run.size() == 4);
+        for (uint64_t i = 4; i < 8; ++i) assert(ring.try_push(i));
+        assert(!ring.try_push(99));
+        assert(ring.push_evict(8, &evicted));
+        assert(evicted == 1);
+        ring.release(run.size());
+        run = ring.claim(8);
+        assert(run.size() == 4 && run[0] == 5 && run[3] == 8);
+        ring.release(run.size());
+    }
+
+    // A claimed run stops at the end of the array and resumes at the start.
+    {
+        Ring ring(8, 8);
+        uint64_t next = 0;
+        uint64_t expected = 0;
+        for (int round = 0; round < 10; ++round) {
+            for (int i = 0; i < 5; ++i) assert(ring.try_push(next++));
+            while (!ring.empty()) {
+                auto run = ring.claim(8);
+                assert(!run.empty());
+                for (uint64_t v : run) assert(v == expected++);
+                ring.release(run.size());
+            }
+        }
+        assert(expected == next);
+    }
+
+    // Eviction discards the oldest unclaimed value, never a claimed one.
+    {
+        Ring ring(4, 2);
+        uint64_t evicted = 0;
+        for (uint64_t i = 0; i < 4; ++i) assert(ring.push_evict(i, &evicted));
+        auto run = ring.claim(2);
+        assert(run.size() == 2 && run[0] == 0);
+        assert(ring.push_evict(4, &evicted) && ring.push_evict(5, &evicted));
+        assert(evicted == 0);
+        assert(ring.push_evict(6, &evicted));
+        assert(evicted == 1);
+        assert(run[0] == 0 && run[1] == 1);
+        ring.release(run.size());
+        run = ring.claim(8);
+        assert(run.size() == 2 && run[0] == 3 && run[1] == 4);
+        ring.release(run.size());
+        run = ring.claim(8);
+        assert(run.size() == 2 && run[0] == 5 && run[1] == 6);
+        ring.release(run.size());
+        assert(ring.empty());
+    }
+
+    // Concurrent producers: every value arrives exactly once, in per-producer order.
+    {
+        constexpr int kProducers = 4;
+        constexpr uint64_t kPerProducer = 200000;
+        Ring ring(1024, 256);
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&ring, p] {
+                for (uint64_t i = 0; i < kPerProducer; ++i) {
+                    const uint64_t value = (static_cast<uint64_t>(p) << 32) | i;
+                    while (!ring.try_push(value)) std::this_thread::yield();
+                }
+            });
+        }
+        std::vector<uint64_t> next(kProducers, 0);
+        uint64_t received = 0;
+        while (received < kProducers * kPerProducer) {
+            auto run = ring.claim(256);
+            for (uint64_t value : run) {
+                const size_t p = static_cast<size_t>(value >> 32);
+                assert(p < kProducers);
+                assert((value & 0xFFFFFFFFULL) == next[p]);
+                ++next[p];
+            }
+            received += run.size();
+            ring.release(run.size());
+        }
+        for (auto& t : producers) t.join();
+        assert(ring.empty());
+    }
+
+    // Concurrent evicting producers: received + evicted accounts for every value.
+    {
+        constexpr int kProducers = 3;
+        constexpr uint64_t kPerProducer = 100000;
+        Ring ring(64, 16);
+        std::atomic<uint64_t> evicted_total{0};
+        std::atomic<int> done{0};
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&] {
+                uint64_t evicted = 0;
+                for (uint64_t i = 0; i < kPerProducer; ++i) {
+                    if (!ring.push_evict(i, &evicted)) ++evicted;
+                }
+                evicted_total.fetch_add(evicted);
+                done.fetch_add(1);
+            });
+        }
+        uint64_t received = 0;
+        while (done.load() < kProducers || !ring.empty()) {
+            auto run = ring.claim(16);
+            received += run.size();
+            ring.release(run.size());
+        }
+        for (auto& t : producers) t.join();
+        assert(received + evicted_total.load() == kProducers * kPerProducer);
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "codec/order_codec.hpp"
+#include "core/fixed_point.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+int main() {
+    Order order{};
+    order.order_id = 42;
+    order.client_id = 7;
+    order.timestamp_ns = 1700000000000000000ULL;
+    order.price = 1.08345;
+    order.quantity = 250000.0;
+    order.price_ticks = argentum::core::to_price_ticks(order.price);
+    order.quantity_lots = argentum::core::to_quantity_lots(order.quantity);
+    std::strncpy(order.symbol, "EUR/USD", sizeof(order.symbol) - 1);
+    order.side = SIDE_BUY;
+    order.type = ORDER_TYPE_LIMIT;
+    order.tif = TIF_IOC;
+
+    std::array<uint8_t, argentum::codec::kOrderMaxEncodedBytes> frame{};
+    size_t frame_size = 0;
+    assert(argentum::codec::encode_order_into(order, frame, &frame_size) == ARGENTUM_OK);
+    assert(frame_size > 0 && frame_size <= frame.size());
+
+    Order decoded{};
+    assert(argentum::codec::decode_order(frame.data(), frame_size, &decoded) == ARGENTUM_OK);
+    assert(decoded.order_id == order.order_id);
+    assert(decoded.client_id == order.client_id);
+    assert(decoded.price_ticks == order.price_ticks);
+    assert(decoded.quantity_lots == order.quantity_lots);
+    assert(std::strcmp(decoded.symbol, "EUR/USD") == 0);
+    assert(decoded.side == SIDE_BUY);
+    assert(decoded.type == ORDER_TYPE_LIMIT);
+    assert(decoded.tif == TIF_IOC);
+
+    std::vector<uint8_t> vec;
+    assert(argentum::codec::encode_order(order, &vec) == ARGENTUM_OK);
+    assert(vec.size() == frame_size);
+    assert(std::memcmp(vec.data(), frame.data(), frame_size) == 0);
+
+    // Frames of another type or truncated frames are rejected.
+    Trade wrong{};
+    assert(argentum::codec::decode_trade(frame.data(), frame_size, &wrong) == ARGENTUM_ERR_PROTO);
+    assert(argentum::codec::decode_order(frame.data(), frame_size - 1, &decoded) == ARGENTUM_ERR_PROTO);
+    size_t required = 0;
+    assert(argentum::codec::encode_order_into(order, std::span<uint8_t>(frame.data(), 4), &required) == ARGENTUM_ERR_RANGE);
+    assert(required == frame_size);
+
+    // Trades: fixed-point fields are derived when a producer only sent doubles.
+    Trade trade{};
+    trade.trade_id = 9;
+    trade.maker_order_id = 41;
+    trade.taker_order_id = 42;
+    trade.timestamp_ns = order.timestamp_ns + 1;
+    trade.price = 1.0834;
+    trade.quantity = 100000.0;
+    trade.side = SIDE_SELL;
+    std::vector<uint8_t> trade_frame;
+    assert(argentum::codec::encode_trade(trade, &trade_frame) == ARGENTUM_OK);
+    Trade trade_out{};
+    assert(argentum::codec::decode_trade(trade_frame.data(), trade_frame.size(), &trade_out) == ARGENTUM_OK);
+    assert(trade_out.trade_id == 9);
+    assert(trade_out.maker_order_id == 41);
+    assert(trade_out.taker_order_id == 42);
+    assert(trade_out.price_ticks == argentum::core::to_price_ticks(trade.price));
+    assert(trade_out.quantity_lots == argentum::core::to_quantity_lots(trade.quantity));
+    assert(trade_out.side == SIDE_SELL);
+
+    // Typed topics carry orders between a byte publisher and typed subscribers.
+    auto bus = argentum::bus::create_inproc_bus();
+    argentum::bus::OrderTopic orders(bus, "orders.internal");
+    std::atomic<bool> got{false};
+    Order seen{};
+    orders.subscribe([&](const Order& value) {
+        seen = value;
+        got.store(true);
+    });
+    assert(bus->publish("orders.internal", vec.data(), vec.size()) == ARGENTUM_OK);
+    for (int i = 0; i < 2000 && !got.load(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(got.load());
+    assert(seen.order_id == 42);
+    assert(seen.price_ticks == order.price_ticks);
+
+    return 0;
+}
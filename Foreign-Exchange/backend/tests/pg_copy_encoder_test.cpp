@@ -0,0 +1,137 @@
+#include "persist/pg_copy_encoder.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#ifdef ARGENTUM_USE_LIBPQ
+#include "persist/data_writer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <libpq-fe.h>
+#include <string>
+#endif
+
+namespace {
+MarketTick make_tick(uint64_t ts, const char* symbol, double price, double quantity, uint8_t side, const char* source) {
+    MarketTick tick{};
+    tick.timestamp_ns = ts;
+    tick.price = price;
+    tick.quantity = quantity;
+    tick.side = side;
+    std::memcpy(tick.symbol, symbol, std::strlen(symbol));
+    std::memcpy(tick.source, source, std::strlen(source));
+    return tick;
+}
+
+uint64_t be(const uint8_t* p, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i) value = (value << 8) | p[i];
+    return value;
+}
+
+#ifdef ARGENTUM_USE_LIBPQ
+// Live round trip against the PostgreSQL named by ARGENTUM_PG_TEST_DSN, if set.
+void copy_to_postgres(const char* dsn) {
+    PGconn* conn = PQconnectdb(dsn);
+    assert(PQstatus(conn) == CONNECTION_OK);
+    PQclear(PQexec(conn, "CREATE TABLE IF NOT EXISTS market_ticks (time TIMESTAMPTZ NOT NULL, symbol TEXT NOT NULL, "
+                         "price DOUBLE PRECISION NOT NULL, volume DOUBLE PRECISION NOT NULL, side CHAR(1) NOT NULL, "
+                         "source TEXT NOT NULL)"));
+    char source[16];
+    std::snprintf(source, sizeof(source), "T%09lld",
+                  static_cast<long long>(std::chrono::steady_clock::now().time_since_epoch().count() % 1000000000));
+    {
+        argentum::persist::DataWriterService writer(dsn);
+        writer.set_max_batch(100);
+        writer.set_flush_interval_ms(5);
+        writer.start();
+        for (uint64_t i = 0; i < 1000; ++i) {
+            writer.enqueue(make_tick(1'700'000'000'000'000'000ULL + i * 1000, "EUR/USD", 1.08 + i * 1e-5, 1.5, SIDE_BUY, source));
+        }
+        writer.stop();
+        assert(writer.failed_flush_count() == 0);
+    }
+    const std::string where = std::string(" FROM market_ticks WHERE source = '") + source + "'";
+    PGresult* res = PQexec(conn, ("SELECT count(*), min(time) = to_timestamp(1700000000), max(price)" + where).c_str());
+    assert(PQresultStatus(res) == PGRES_TUPLES_OK);
+    assert(std::strcmp(PQgetvalue(res, 0, 0), "1000") == 0);
+    assert(std::strcmp(PQgetvalue(res, 0, 1), "t") == 0);
+    PQclear(res);
+    PQclear(PQexec(conn, ("DELETE" + where).c_str()));
+    PQfinish(conn);
+}
+#endif
+} // namespace
+
+int main() {
+    assert(argentum::persist::pg_timestamp_us(946'684'801'000'000'000ULL) == 1'000'000);
+    assert(argentum::persist::pg_timestamp_us(0) == -argentum::persist::kPgEpochOffsetUs);
+
+    argentum::persist::PgTickCopyEncoder encoder;
+    encoder.begin();
+    const std::vector<MarketTick> ticks = {
+        make_tick(946'684'801'000'000'000ULL, "EUR/USD", 1.5, 2.0, SIDE_BUY, "LMAX"),
+        make_tick(946'684'802'000'001'999ULL, "BTC/USDT", -0.0, 0.25, SIDE_SELL, ""),
+    };
+    encoder.append_batch(ticks);
+    encoder.finish();
+    assert(encoder.rows() == 2);
+
+    const auto data = encoder.data();
+    const uint8_t* p = data.data();
+    const uint8_t signature[11] = {'P', 'G', 'C', 'O', 'P', 'Y', '\n', 0xFF, '\r', '\n', 0};
+    assert(std::memcmp(p, signature, sizeof(signature)) == 0);
+    p += 11;
+    assert(be(p, 4) == 0 && be(p + 4, 4) == 0);
+    p += 8;
+
+    // Row 1
+    assert(be(p, 2) == 6);
+    p += 2;
+    assert(be(p, 4) == 8 && be(p + 4, 8) == 1'000'000);
+    p += 12;
+    assert(be(p, 4) == 7 && std::memcmp(p + 4, "EUR/USD", 7) == 0);
+    p += 11;
+    assert(be(p, 4) == 8 && be(p + 4, 8) == 0x3FF8000000000000ULL); // 1.5
+    p += 12;
+    assert(be(p, 4) == 8 && be(p + 4, 8) == 0x4000000000000000ULL); // 2.0
+    p += 12;
+    assert(be(p, 4) == 1 && p[4] == 'B');
+    p += 5;
+    assert(be(p, 4) == 4 && std::memcmp(p + 4, "LMAX", 4) == 0);
+    p += 8;
+
+    // Row 2: sub-microsecond remainder truncated, sign of -0.0 kept, empty source.
+    assert(be(p, 2) == 6);
+    p += 2;
+    assert(be(p + 4, 8) == 2'000'001);
+    p += 12;
+    assert(be(p, 4) == 8);
+    p += 12;
+    assert(be(p + 4, 8) == 0x8000000000000000ULL);
+    p += 12;
+    assert(be(p + 4, 8) == 0x3FD0000000000000ULL); // 0.25
+    p += 12;
+    assert(p[4] == 'S');
+    p += 5;
+    assert(be(p, 4) == 0);
+    p += 4;
+
+    assert(be(p, 2) == 0xFFFF);
+    assert(p + 2 == data.data() + data.size());
+
+    // The buffer is reused: a new stream starts from the header again.
+    encoder.begin();
+    encoder.append(ticks[0]);
+    encoder.finish();
+    assert(encoder.rows() == 1 && encoder.data().size() == 19 + 2 + 12 + 11 + 12 + 12 + 5 + 8 + 2);
+
+#ifdef ARGENTUM_USE_LIBPQ
+    if (const char* dsn = std::getenv("ARGENTUM_PG_TEST_DSN")) copy_to_postgres(dsn);
+#endif
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "datafeed/feed_player.hpp"
+#include "datafeed/replay_clock.hpp"
+#include "core/time_utils.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using argentum::datafeed::ReplayClock;
+using argentum::datafeed::ReplayClockConfig;
+
+int main() {
+    // 10x: 100 events recorded 1 ms apart must take at least 9.9 ms of wall time.
+    {
+        ReplayClockConfig config{};
+        config.speed = 10.0;
+        ReplayClock clock(config);
+        const uint64_t base = 1'700'000'000'000'000'000ULL;
+        const uint64_t start = argentum::core::now_ns();
+        for (uint64_t i = 0; i < 100; ++i) {
+            clock.wait_for_event(base + i * 1'000'000ULL);
+        }
+        const uint64_t elapsed = argentum::core::now_ns() - start;
+        assert(elapsed >= 9'900'000ULL);
+        const auto stats = clock.stats();
+        assert(stats.events == 100);
+        assert(stats.lag.count == 100);
+    }
+
+    // Out-of-order and missing timestamps never move the schedule backwards or stall.
+    {
+        ReplayClockConfig config{};
+        config.speed = 1.0;
+        ReplayClock clock(config);
+        const uint64_t start = argentum::core::now_ns();
+        clock.wait_for_event(5'000'000);
+        clock.wait_for_event(6'000'000);
+        clock.wait_for_event(1'000);
+        clock.wait_for_event(0);
+        const uint64_t elapsed = argentum::core::now_ns() - start;
+        assert(elapsed >= 1'000'000ULL && elapsed < 500'000'000ULL);
+    }
+
+    // A first event without a timestamp (parse_json leaves it 0) does not anchor the
+    // schedule, so the recorded timestamps that follow are paced normally.
+    {
+        ReplayClockConfig config{};
+        config.speed = 1.0;
+        ReplayClock clock(config);
+        const uint64_t base = 1'700'000'000'000'000'000ULL;
+        const uint64_t start = argentum::core::now_ns();
+        assert(clock.wait_for_event(0) == 0);
+        clock.wait_for_event(base);
+        clock.wait_for_event(0);
+        clock.wait_for_event(base + 2'000'000ULL);
+        const uint64_t elapsed = argentum::core::now_ns() - start;
+        assert(elapsed >= 2'000'000ULL && elapsed < 500'000'000ULL);
+        assert(clock.stats().events == 4);
+    }
+
+    // As fast as possible: no waiting, zero lag.
+    {
+        ReplayClockConfig config{};
+        config.speed = 0.0;
+        ReplayClock clock(config);
+        assert(clock.wait_for_event(1) == 0);
+        assert(clock.wait_for_event(1'000'000'000'000ULL) == 0);
+        assert(clock.stats().late_events == 0);
+    }
+
+    // FeedPlayer on the recorded timeline: 50 ticks 2 ms apart at 20x ~= 4.9 ms.
+    {
+        std::filesystem::create_directories("data");
+        const std::filesystem::path path = "data/test_replay_clock.jsonl";
+        {
+            std::ofstream out(path, std::ios::trunc);
+            // Leading tick without a timestamp must not anchor the replay at 0.
+            out << "{\"price\":1.1,\"quantity\":1,\"symbol\":\"EURUSD\",\"side\":\"S\"}\n";
+            for (int i = 0; i < 50; ++i) {
+                char line[160];
+                std::snprintf(line, sizeof(line),
+                              "{\"timestamp_ns\":%llu,\"price\":1.1,\"quantity\":1,\"symbol\":\"EURUSD\",\"side\":\"S\"}\n",
+                              static_cast<unsigned long long>(1'000'000'000ULL + i * 2'000'000ULL));
+                out << line;
+            }
+        }
+
+        auto bus = argentum::bus::create_inproc_bus();
+        argentum::bus::MarketTickTopic topic(bus, "market.ticks");
+        std::atomic<int> received{0};
+        topic.subscribe([&](const MarketTick&) { received.fetch_add(1); });
+
+        argentum::datafeed::FeedPlayer player(bus, "market.ticks");
+        ReplayClockConfig config{};
+        config.speed = 20.0;
+        ReplayClock clock(config);
+        const uint64_t start = argentum::core::now_ns();
+        assert(player.play_file_paced(path.string(), FEED_FORMAT_JSON, &clock) == 51);
+        const uint64_t elapsed = argentum::core::now_ns() - start;
+        assert(elapsed >= 4'900'000ULL && elapsed < 2'000'000'000ULL);
+        assert(clock.stats().events == 51);
+
+        for (int i = 0; i < 2000 && received.load() < 51; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        assert(received.load() == 51);
+
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+    return 0;
+}
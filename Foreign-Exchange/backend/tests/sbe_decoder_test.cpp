@@ -0,0 +1,165 @@
+#include "datafeed/market_parser.h"
+#include "datafeed/sbe_decoder.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+class PacketBuilder {
+public:
+    PacketBuilder(uint32_t seq, uint64_t sending_time) {
+        put(seq);
+        put(sending_time);
+    }
+
+    // Appends msg_size + MessageHeader + block (+ raw tail) and returns the message offset.
+    size_t message(uint16_t template_id, const std::vector<uint8_t>& block, const std::vector<uint8_t>& tail = {},
+                   uint16_t schema = ARGENTUM_SBE_SCHEMA_ID) {
+        const size_t at = bytes.size();
+        boundaries.push_back(at);
+        put(static_cast<uint16_t>(SBE_MSG_SIZE_FIELD + SBE_MESSAGE_HEADER_SIZE + block.size() + tail.size()));
+        put(static_cast<uint16_t>(block.size()));
+        put(template_id);
+        put(schema);
+        put(static_cast<uint16_t>(ARGENTUM_SBE_SCHEMA_VERSION));
+        bytes.insert(bytes.end(), block.begin(), block.end());
+        bytes.insert(bytes.end(), tail.begin(), tail.end());
+        return at;
+    }
+
+    template <typename T>
+    void put(T value) {
+        const auto* p = reinterpret_cast<const uint8_t*>(&value);
+        bytes.insert(bytes.end(), p, p + sizeof(T));
+    }
+
+    std::vector<uint8_t> bytes;
+    std::vector<size_t> boundaries;
+};
+
+template <typename T>
+void store(std::vector<uint8_t>& block, size_t offset, T value) {
+    std::memcpy(block.data() + offset, &value, sizeof(T));
+}
+
+std::vector<uint8_t> trade_block(const char* symbol, int64_t price, int64_t qty, uint8_t side, size_t length = SBE_TRADE_BLOCK_LENGTH) {
+    std::vector<uint8_t> b(length, 0);
+    store<uint64_t>(b, SBE_TRADE_OFF_TIME, 1700000000000000001ULL);
+    store<int64_t>(b, SBE_TRADE_OFF_PRICE, price);
+    store<int64_t>(b, SBE_TRADE_OFF_QUANTITY, qty);
+    store<uint32_t>(b, SBE_TRADE_OFF_SECURITY_ID, 77);
+    b[SBE_TRADE_OFF_AGGRESSOR] = side;
+    std::memcpy(b.data() + SBE_TRADE_OFF_SYMBOL, symbol, std::strlen(symbol));
+    return b;
+}
+} // namespace
+
+int main() {
+    PacketBuilder packet(1001, 1700000000000000000ULL);
+
+    packet.message(SBE_TEMPLATE_TRADE, trade_block("EUR/USD", 1083450, 2500000, SIDE_SELL));
+
+    std::vector<uint8_t> tob(SBE_TOB_BLOCK_LENGTH, 0);
+    store<uint64_t>(tob, SBE_TOB_OFF_TIME, 5);
+    store<int64_t>(tob, SBE_TOB_OFF_BID_PRICE, 1083400);
+    store<int64_t>(tob, SBE_TOB_OFF_BID_QUANTITY, 1000000);
+    store<int64_t>(tob, SBE_TOB_OFF_ASK_PRICE, 1083500);
+    store<int64_t>(tob, SBE_TOB_OFF_ASK_QUANTITY, 3000000);
+    store<uint32_t>(tob, SBE_TOB_OFF_RPT_SEQ, 12);
+    std::memcpy(tob.data() + SBE_TOB_OFF_SYMBOL, "EUR/USD", 7);
+    packet.message(SBE_TEMPLATE_TOP_OF_BOOK, tob);
+
+    // Unknown template and foreign schema are skipped.
+    packet.message(99, std::vector<uint8_t>(8, 0));
+    packet.message(SBE_TEMPLATE_TRADE, trade_block("GBP/USD", 1, 1, SIDE_BUY), {}, 0x1234);
+
+    // Book update with two levels; entries carry 4 bytes of a newer schema's extension.
+    std::vector<uint8_t> book(SBE_BOOK_BLOCK_LENGTH, 0);
+    store<uint64_t>(book, SBE_BOOK_OFF_TIME, 9);
+    store<uint32_t>(book, SBE_BOOK_OFF_RPT_SEQ, 13);
+    std::memcpy(book.data() + SBE_BOOK_OFF_SYMBOL, "EUR/USD", 7);
+    const uint16_t entry_len = SBE_BOOK_ENTRY_LENGTH + 4;
+    std::vector<uint8_t> group(SBE_GROUP_HEADER_SIZE + 2 * entry_len, 0);
+    store<uint16_t>(group, 0, entry_len);
+    group[2] = 2;
+    for (int i = 0; i < 2; ++i) {
+        const size_t at = SBE_GROUP_HEADER_SIZE + static_cast<size_t>(i) * entry_len;
+        store<int64_t>(group, at + SBE_ENTRY_OFF_PRICE, 1083300 - i * 100);
+        store<int64_t>(group, at + SBE_ENTRY_OFF_QUANTITY, (i + 1) * 1000000);
+        group[at + SBE_ENTRY_OFF_ACTION] = i == 0 ? SBE_ACTION_CHANGE : SBE_ACTION_DELETE;
+        group[at + SBE_ENTRY_OFF_SIDE] = SIDE_BUY;
+        group[at + SBE_ENTRY_OFF_LEVEL] = static_cast<uint8_t>(i + 1);
+    }
+    packet.message(SBE_TEMPLATE_BOOK_UPDATE, book, group);
+
+    SbeMarketEvent events[8];
+    SbePacketInfo info{};
+    size_t count = 0;
+    assert(sbe_decode_packet(packet.bytes.data(), packet.bytes.size(), &info, events, 8, &count) == ARGENTUM_OK);
+    assert(info.sequence_number == 1001);
+    assert(info.sending_time_ns == 1700000000000000000ULL);
+    assert(info.messages == 5);
+    assert(info.skipped_messages == 2);
+    assert(count == 4);
+
+    assert(events[0].template_id == SBE_TEMPLATE_TRADE);
+    assert(events[0].price_ticks == 1083450);
+    assert(events[0].quantity_lots == 2500000);
+    assert(events[0].security_id == 77);
+    assert(events[0].side == SIDE_SELL);
+    assert(std::strcmp(events[0].symbol, "EUR/USD") == 0);
+
+    assert(events[1].template_id == SBE_TEMPLATE_TOP_OF_BOOK);
+    assert(events[1].price_ticks == 1083400);
+    assert(events[1].ask_price_ticks == 1083500);
+    assert(events[1].ask_quantity_lots == 3000000);
+    assert(events[1].rpt_seq == 12);
+
+    assert(events[2].template_id == SBE_TEMPLATE_BOOK_UPDATE);
+    assert(events[2].rpt_seq == 13);
+    assert(events[2].price_ticks == 1083300);
+    assert(events[2].update_action == SBE_ACTION_CHANGE);
+    assert(events[2].price_level == 1);
+    assert(events[3].price_ticks == 1083200);
+    assert(events[3].quantity_lots == 2000000);
+    assert(events[3].update_action == SBE_ACTION_DELETE);
+    assert(events[3].side == SIDE_BUY);
+
+    // Output full: events decoded so far are reported.
+    assert(sbe_decode_packet(packet.bytes.data(), packet.bytes.size(), &info, events, 3, &count) == ARGENTUM_ERR_RANGE);
+    assert(count == 3);
+
+    // Cutting between messages leaves a shorter valid packet; cutting inside one is a
+    // protocol error, never an over-read.
+    for (size_t cut = 0; cut < packet.bytes.size(); ++cut) {
+        const ArgentumStatus st = sbe_decode_packet(packet.bytes.data(), cut, &info, events, 8, &count);
+        bool on_boundary = false;
+        for (size_t b : packet.boundaries) on_boundary = on_boundary || b == cut;
+        assert(st == (on_boundary ? ARGENTUM_OK : ARGENTUM_ERR_PROTO));
+    }
+
+    // Root blocks shorter than the schema's are rejected; longer ones (newer versions) decode.
+    PacketBuilder short_block(1, 0);
+    short_block.message(SBE_TEMPLATE_TRADE, trade_block("EUR/USD", 1, 1, SIDE_BUY, SBE_TRADE_BLOCK_LENGTH), {});
+    short_block.bytes[SBE_PACKET_HEADER_SIZE + SBE_MSG_SIZE_FIELD] = SBE_TRADE_BLOCK_LENGTH - 8;
+    assert(sbe_decode_packet(short_block.bytes.data(), short_block.bytes.size(), &info, events, 8, &count) == ARGENTUM_ERR_PROTO);
+
+    // parse_market_message(FEED_FORMAT_SBE) takes one Trade message without msg_size.
+    PacketBuilder single(0, 0);
+    const size_t at = single.message(SBE_TEMPLATE_TRADE, trade_block("eurusd", 1083450, 2500000, SIDE_BUY, SBE_TRADE_BLOCK_LENGTH + 16));
+    const char* msg = reinterpret_cast<const char*>(single.bytes.data() + at + SBE_MSG_SIZE_FIELD);
+    const size_t msg_len = single.bytes.size() - at - SBE_MSG_SIZE_FIELD;
+    MarketTick tick{};
+    assert(parse_market_message(FEED_FORMAT_SBE, msg, msg_len, &tick) == ARGENTUM_OK);
+    assert(std::strcmp(tick.symbol, "EUR/USD") == 0);
+    assert(tick.price == 1.08345);
+    assert(tick.quantity == 2.5);
+    assert(tick.side == SIDE_BUY);
+    assert(tick.timestamp_ns == 1700000000000000001ULL);
+    assert(std::strcmp(tick.source, "SBE") == 0);
+    assert(parse_market_message(FEED_FORMAT_SBE, msg, SBE_MESSAGE_HEADER_SIZE + 4, &tick) == ARGENTUM_ERR_PROTO);
+
+    return 0;
+}
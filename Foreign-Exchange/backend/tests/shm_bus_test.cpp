@@ -0,0 +1,161 @@
+#include "bus/message_bus.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+bool wait_until(const std::atomic<int>& value, int expected) {
+    for (int i = 0; i < 2000; ++i) {
+        if (value.load() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+} // namespace
+
+int main() {
+    argentum::bus::ShmBusConfig config;
+    config.region_name = "argentum_shm_bus_test";
+    config.slots_per_topic = 8;
+    config.slot_payload_bytes = 64;
+    config.policy = argentum::bus::BackpressurePolicy::DropNewest;
+    config.max_consumers_per_topic = 2;
+    config.reset_existing = true;
+    config.unlink_on_close = true;
+
+    auto publisher = argentum::bus::create_shm_bus(config);
+    if (!publisher) {
+        return 0; // Shared-memory transport unavailable on this platform.
+    }
+
+    // A second mapping of the same region behaves like a separate process.
+    argentum::bus::ShmBusConfig attach_config;
+    attach_config.region_name = config.region_name;
+    auto subscriber = argentum::bus::create_shm_bus(attach_config);
+    assert(subscriber);
+
+    std::mutex mtx;
+    std::vector<uint32_t> received;
+    std::atomic<int> count{0};
+    subscriber->subscribe("market.ticks", [&](const void* data, size_t size) {
+        assert(size == sizeof(uint32_t));
+        uint32_t value = 0;
+        std::memcpy(&value, data, sizeof(value));
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            received.push_back(value);
+        }
+        count.fetch_add(1);
+    });
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        assert(publisher->publish("market.ticks", &i, sizeof(i)) == ARGENTUM_OK);
+    }
+    assert(wait_until(count, 5));
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (uint32_t i = 0; i < 5; ++i) {
+            assert(received[i] == i);
+        }
+    }
+
+    argentum::bus::TopicMetrics metrics{};
+    assert(subscriber->get_metrics("market.ticks", &metrics));
+    assert(metrics.published == 5);
+    assert(metrics.drops == 0);
+    assert(metrics.dwell.count == 5);
+    // Callback duration is recorded after the callback returns; allow the last one to land.
+    for (int i = 0; i < 2000 && metrics.callback.count < 5; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        subscriber->get_metrics("market.ticks", &metrics);
+    }
+    assert(metrics.callback.count == 5);
+
+    uint8_t oversized[128] = {};
+    assert(publisher->publish("market.ticks", oversized, sizeof(oversized)) == ARGENTUM_ERR_RANGE);
+
+    // A stalled consumer holds its cursor; DropNewest rejects once the ring is full.
+    std::atomic<bool> release{false};
+    std::atomic<int> slow_count{0};
+    subscriber->subscribe("orders.slow", [&](const void*, size_t) {
+        while (!release.load()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        slow_count.fetch_add(1);
+    });
+
+    int accepted = 0;
+    int rejected = 0;
+    for (uint32_t i = 0; i < 12; ++i) {
+        const ArgentumStatus status = publisher->publish("orders.slow", &i, sizeof(i));
+        if (status == ARGENTUM_OK) {
+            ++accepted;
+        } else {
+            assert(status == ARGENTUM_ERR_TIMEOUT);
+            ++rejected;
+        }
+    }
+    assert(accepted == 8);
+    assert(rejected == 4);
+    assert(publisher->get_metrics("orders.slow", &metrics));
+    assert(metrics.drops == 4);
+    assert(metrics.backpressure_hits == 4);
+
+    release.store(true);
+    assert(wait_until(slow_count, 8));
+
+    // Each mapping claims one cursor per topic; one more than max_consumers_per_topic is refused
+    // until a slot is released.
+    auto second = argentum::bus::create_shm_bus(attach_config);
+    auto third = argentum::bus::create_shm_bus(attach_config);
+    assert(second && third);
+    std::atomic<int> capped_first{0};
+    std::atomic<int> capped_second{0};
+    std::atomic<int> capped_rejected{0};
+    std::atomic<int> capped_third{0};
+    assert(subscriber->subscribe("fills.capped", [&](const void*, size_t) { capped_first.fetch_add(1); }) !=
+           argentum::bus::kInvalidSubscription);
+    assert(second->subscribe("fills.capped", [&](const void*, size_t) { capped_second.fetch_add(1); }) !=
+           argentum::bus::kInvalidSubscription);
+    assert(third->subscribe("fills.capped", [&](const void*, size_t) { capped_rejected.fetch_add(1); }) ==
+           argentum::bus::kInvalidSubscription);
+
+    second.reset();
+    assert(third->subscribe("fills.capped", [&](const void*, size_t) { capped_third.fetch_add(1); }) !=
+           argentum::bus::kInvalidSubscription);
+    uint32_t fill = 7;
+    assert(publisher->publish("fills.capped", &fill, sizeof(fill)) == ARGENTUM_OK);
+    assert(wait_until(capped_first, 1));
+    assert(wait_until(capped_third, 1));
+    assert(capped_rejected.load() == 0);
+
+    third.reset();
+
+    // Shutdown joins workers without holding the bus lock, so a callback that is still
+    // running may call back into the bus.
+    auto reentrant = argentum::bus::create_shm_bus(attach_config);
+    assert(reentrant);
+    argentum::bus::MessageBus* reentrant_bus = reentrant.get();
+    std::atomic<int> entered{0};
+    std::atomic<int> reentered{0};
+    reentrant->subscribe("fills.reentrant", [&](const void*, size_t) {
+        entered.fetch_add(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        argentum::bus::TopicMetrics during{};
+        reentrant_bus->get_metrics("fills.reentrant", &during);
+        reentered.fetch_add(1);
+    });
+    assert(publisher->publish("fills.reentrant", &fill, sizeof(fill)) == ARGENTUM_OK);
+    assert(wait_until(entered, 1));
+    reentrant.reset();
+    assert(reentered.load() == 1);
+
+    subscriber.reset();
+    publisher.reset();
+    return 0;
+}
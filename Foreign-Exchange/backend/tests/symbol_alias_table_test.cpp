@@ -0,0 +1,100 @@
+#include "core/instrument_registry.hpp"
+#include "core/symbol_alias_table.hpp"
+#include "datafeed/market_parser.h"
+#include "datafeed/normalizer.h"
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+int main() {
+    using argentum::core::InstrumentRegistry;
+    using argentum::core::SymbolAliasTable;
+
+    // Local table: every common spelling of an instrument resolves to its registry id.
+    InstrumentRegistry registry(64);
+    SymbolAliasTable table(registry);
+    const uint32_t btc = table.add_instrument("BTC/USDT");
+    const uint32_t eur = table.add_instrument("EUR/USD");
+    assert(btc != InstrumentRegistry::kInvalidId);
+    assert(eur != InstrumentRegistry::kInvalidId && eur != btc);
+    assert(table.add_alias("XBTUSDT", "BTC/USDT"));
+    assert(table.build());
+    assert(table.size() > 0);
+
+    for (const char* spelling : {"BTC/USDT", "BTCUSDT", "BTC-USDT", "BTC_USDT", "btc/usdt", "btcusdt", "XBTUSDT"}) {
+        assert(table.find(spelling) == btc);
+    }
+    for (const char* spelling : {"EUR/USD", "EURUSD", "eur.usd", "EUR USD"}) {
+        assert(table.find(spelling) == eur);
+    }
+    assert(table.canonical_name(btc) == "BTC/USDT");
+    assert(registry.find("EUR/USD") == eur);
+
+    // Misses: unknown, prefix, overlong and empty spellings.
+    assert(table.find("GBP/USD") == InstrumentRegistry::kInvalidId);
+    assert(table.find("BTC/USD") == InstrumentRegistry::kInvalidId);
+    assert(table.find("BTC/USDT-PERPETUAL-SWAP") == InstrumentRegistry::kInvalidId);
+    assert(table.find("") == InstrumentRegistry::kInvalidId);
+
+    // Rebuilding after more instruments keeps earlier ids stable.
+    const uint32_t eth = table.add_instrument("ETH/USDT");
+    assert(table.build());
+    assert(table.find("ethusdt") == eth);
+    assert(table.find("btc-usdt") == btc);
+
+    // One spelling claimed by two instruments is a conflict.
+    {
+        InstrumentRegistry other_registry(8);
+        SymbolAliasTable conflicting(other_registry);
+        conflicting.add_instrument("BTC/USDT");
+        conflicting.add_instrument("ETH/USDT");
+        assert(conflicting.add_alias("COIN", "BTC/USDT"));
+        assert(conflicting.add_alias("COIN", "ETH/USDT"));
+        assert(!conflicting.build());
+    }
+
+    // Process-wide table: resolve_symbol hits the alias table first, then falls back.
+    auto& aliases = argentum::core::symbol_aliases();
+    const uint32_t global_btc = aliases.add_instrument("BTC/USDT");
+    assert(aliases.build());
+
+    char out[SYMBOL_LEN];
+    uint32_t id = InstrumentRegistry::kInvalidId;
+    const std::string_view raw = "btc_usdt";
+    assert(resolve_symbol(raw.data(), raw.size(), out, sizeof(out), &id) == ARGENTUM_OK);
+    assert(std::string(out) == "BTC/USDT");
+    assert(id == global_btc);
+
+    const std::string_view unknown = "GBP-JPY";
+    assert(resolve_symbol(unknown.data(), unknown.size(), out, sizeof(out), &id) == ARGENTUM_OK);
+    assert(std::string(out) == "GBP/JPY");
+    assert(id == InstrumentRegistry::kInvalidId);
+
+    // Map keys: any spelling of one instrument gives one id; unknown names are only
+    // registered on request.
+    const std::string_view btc_dash = "BTC-USDT";
+    assert(instrument_id_for_symbol(btc_dash.data(), btc_dash.size(), 0) == global_btc);
+    const std::string_view gbp = "gbpjpy";
+    assert(instrument_id_for_symbol(gbp.data(), gbp.size(), 0) == InstrumentRegistry::kInvalidId);
+    const uint32_t gbp_id = instrument_id_for_symbol(gbp.data(), gbp.size(), 1);
+    assert(gbp_id != InstrumentRegistry::kInvalidId);
+    assert(instrument_id_for_symbol(unknown.data(), unknown.size(), 0) == gbp_id);
+    const std::string_view short_name = "aapl";
+    const uint32_t aapl = instrument_id_for_symbol(short_name.data(), short_name.size(), 1);
+    assert(aapl != InstrumentRegistry::kInvalidId);
+    assert(argentum::core::instrument_registry().name(aapl) == "AAPL");
+    assert(instrument_id_for_symbol("A.A.P.L", 7, 0) == aapl);
+    assert(instrument_id_for_symbol("/", 1, 1) == InstrumentRegistry::kInvalidId);
+
+    // Parsed ticks carry the instrument id alongside the canonical symbol.
+    const std::string json = R"({"symbol":"btcusdt","price":101.5,"quantity":2,"side":"buy","ts":42})";
+    MarketTick tick{};
+    assert(parse_market_message(FEED_FORMAT_JSON, json.data(), json.size(), &tick) == ARGENTUM_OK);
+    assert(std::string(tick.symbol) == "BTC/USDT");
+    assert(tick.instrument_id == global_btc);
+
+    return 0;
+}
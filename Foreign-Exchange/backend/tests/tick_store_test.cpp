@@ -0,0 +1,166 @@
+#include "backtest/backtest_engine.hpp"
+#include "core/fixed_point.hpp"
+#include "core/instrument_registry.hpp"
+#include "persist/tick_store.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+MarketTick make_tick(const char* symbol, const char* source, uint64_t ts, double price, double quantity, uint8_t side) {
+    MarketTick tick{};
+    tick.timestamp_ns = ts;
+    tick.price = price;
+    tick.quantity = quantity;
+    tick.side = side;
+    std::memcpy(tick.symbol, symbol, std::strlen(symbol));
+    std::memcpy(tick.source, source, std::strlen(source));
+    return tick;
+}
+} // namespace
+
+int main() {
+    using argentum::persist::TickSegment;
+    using argentum::persist::TickSegmentFooter;
+    using argentum::persist::TickStoreConfig;
+    using argentum::persist::TickStoreWriter;
+
+    const std::filesystem::path root = "data/test_tick_store";
+    std::error_code ec;
+    std::filesystem::remove_all(root, ec);
+
+    constexpr uint64_t kPartition = 1'000'000;
+    constexpr uint64_t kBase = 5 * kPartition;
+    TickStoreConfig config{};
+    config.partition_ns = kPartition;
+    config.rows_per_segment = 1000;
+
+    // 2500 EUR/USD ticks in one partition from two venues, interleaved with BTC/USDT, then
+    // a few EUR/USD ticks in the next partition.
+    size_t eur_rows = 0;
+    {
+        TickStoreWriter writer(root.string(), config);
+        for (uint64_t i = 0; i < 2500; ++i) {
+            const char* venue = (i % 3 == 0) ? "LMAX" : "EBS";
+            assert(writer.append(make_tick("EUR/USD", venue, kBase + i * 10, 1.08 + i * 1e-6, 1.5, i % 2 ? SIDE_BUY : SIDE_SELL)));
+            ++eur_rows;
+            if (i % 100 == 0) assert(writer.append(make_tick("BTC/USDT", "BINANCE", kBase + i * 10, 60000.25, 0.01, SIDE_BUY)));
+        }
+        std::vector<MarketTick> next;
+        for (uint64_t i = 0; i < 7; ++i) next.push_back(make_tick("EUR/USD", "EBS", kBase + kPartition + i, 1.09, 2.0, SIDE_SELL));
+        assert(writer.append_batch(next) == next.size());
+        eur_rows += next.size();
+        assert(!writer.append(make_tick("", "EBS", kBase, 1.0, 1.0, SIDE_BUY)));
+        assert(writer.flush());
+        // 1000 + 1000 + 500 (partition change) + 7, plus one BTC/USDT segment.
+        assert(writer.segments_written() == 5);
+        assert(writer.failed_writes() == 0);
+    }
+
+    // Reads map the file and hand out columns directly.
+    const auto segments = argentum::persist::list_tick_segments(root.string(), "EUR/USD");
+    assert(segments.size() == 4);
+    size_t rows = 0;
+    uint64_t last_ts = 0;
+    for (const std::string& path : segments) {
+        TickSegment segment;
+        assert(segment.open(path));
+        assert(segment.symbol() == "EUR/USD");
+        const auto ts = segment.timestamps();
+        const auto px = segment.price_ticks();
+        assert(ts.size() == segment.size() && px.size() == segment.size());
+        assert(ts.front() == segment.min_timestamp_ns() && ts.back() == segment.max_timestamp_ns());
+        assert(ts.front() > last_ts || last_ts == 0);
+        last_ts = ts.back();
+        for (size_t i = 0; i < segment.size(); ++i) {
+            if (ts[i] < kBase + kPartition) {
+                const uint64_t n = (ts[i] - kBase) / 10;
+                assert(px[i] == argentum::core::to_price_ticks(1.08 + n * 1e-6));
+                assert(segment.venue_name(segment.venues()[i]) == ((n % 3 == 0) ? "LMAX" : "EBS"));
+                assert(segment.sides()[i] == (n % 2 ? SIDE_BUY : SIDE_SELL));
+            }
+            assert(segment.quantity_lots()[i] == argentum::core::to_quantity_lots(ts[i] < kBase + kPartition ? 1.5 : 2.0));
+        }
+        MarketTick first{};
+        segment.read_tick(0, &first);
+        assert(std::strcmp(first.symbol, "EUR/USD") == 0 && first.timestamp_ns == ts.front());
+        rows += segment.size();
+    }
+    assert(rows == eur_rows);
+
+    // Footer index prunes by time without touching the columns.
+    assert(argentum::persist::list_tick_segments(root.string(), "EUR/USD", kBase + kPartition).size() == 1);
+    assert(argentum::persist::list_tick_segments(root.string(), "EUR/USD", 0, kBase + 5).size() == 1);
+    assert(argentum::persist::list_tick_segments(root.string(), "EUR/USD", kBase + 100'000).size() == 1);
+    assert(argentum::persist::list_tick_segments(root.string(), "").size() == 5);
+    assert(argentum::persist::list_tick_segments(root.string(), "GBP/USD").empty());
+
+    // A restarted writer never overwrites existing segments.
+    {
+        TickStoreWriter writer(root.string(), config);
+        assert(writer.append(make_tick("EUR/USD", "EBS", kBase + 1, 1.07, 1.0, SIDE_BUY)));
+    }
+    assert(argentum::persist::list_tick_segments(root.string(), "EUR/USD").size() == 5);
+
+    // Truncated or foreign files are rejected.
+    {
+        const std::filesystem::path bogus = root / "EUR_USD" / "bogus.ats";
+        std::ofstream(bogus, std::ios::binary) << "not a segment";
+        TickSegment segment;
+        assert(!segment.open(bogus.string()));
+        assert(segment.size() == 0 && segment.timestamps().empty());
+        assert(argentum::persist::list_tick_segments(root.string(), "EUR/USD").size() == 5);
+    }
+
+    // A footer whose offset wraps past 2^64 back into the body is rejected.
+    {
+        const std::string source = argentum::persist::list_tick_segments(root.string(), "EUR/USD").front();
+        const std::filesystem::path corrupt = root / "corrupt.ats";
+        std::filesystem::copy_file(source, corrupt, ec);
+        assert(!ec);
+        TickSegment segment;
+        assert(segment.open(corrupt.string()));
+        const uint64_t rows = segment.size();
+        segment.close();
+
+        const uint64_t file_size = std::filesystem::file_size(corrupt);
+        TickSegmentFooter footer{};
+        std::fstream io(corrupt, std::ios::binary | std::ios::in | std::ios::out);
+        io.seekg(static_cast<std::streamoff>(file_size - sizeof(footer)));
+        io.read(reinterpret_cast<char*>(&footer), sizeof(footer));
+        footer.price_offset = uint64_t{0} - rows * sizeof(int64_t);
+        io.seekp(static_cast<std::streamoff>(file_size - sizeof(footer)));
+        io.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+        io.close();
+        assert(!segment.open(corrupt.string()));
+        std::filesystem::remove(corrupt, ec);
+    }
+
+    // The backtester loads straight from the store.
+    {
+        argentum::backtest::BacktestEngine engine;
+        assert(engine.load_ticks_from_store(root.string(), "EURUSD"));
+        assert(engine.load_ticks_from_store(root.string(), "eur_usd"));
+        assert(!engine.load_ticks_from_store(root.string(), "GBPUSD"));
+        assert(engine.unknown_symbol_ticks() == 0);
+
+        // Symbols read from data are looked up, not registered.
+        const std::filesystem::path csv = root / "ticks.csv";
+        std::ofstream(csv) << "timestamp_ns,symbol,price,quantity,side,source\n"
+                           << kBase << ",EUR/USD,1.07,1.0,B,EBS\n"
+                           << kBase + 1 << ",XAG/CHF,21.5,1.0,S,EBS\n";
+        argentum::backtest::BacktestEngine csv_engine;
+        assert(csv_engine.load_ticks_from_csv(csv.string()));
+        assert(csv_engine.unknown_symbol_ticks() == 1);
+        assert(argentum::core::instrument_registry().find("XAG/CHF") == argentum::core::InstrumentRegistry::kInvalidId);
+    }
+
+    std::filesystem::remove_all(root, ec);
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include "bus/typed_topic.hpp"
+#include "codec/market_tick_codec.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Quote {
+    uint64_t id;
+    int64_t bid_ticks;
+    int64_t ask_ticks;
+};
+
+std::atomic<int> g_encodes{0};
+std::atomic<int> g_decodes{0};
+
+struct CountingQuoteCodec {
+    static ArgentumStatus encode(const Quote& quote, std::vector<uint8_t>* out) {
+        g_encodes.fetch_add(1);
+        out->resize(sizeof(quote));
+        std::memcpy(out->data(), &quote, sizeof(quote));
+        return ARGENTUM_OK;
+    }
+    static ArgentumStatus decode(const void* data, size_t size, Quote* out) {
+        g_decodes.fetch_add(1);
+        if (size != sizeof(Quote)) return ARGENTUM_ERR_PROTO;
+        std::memcpy(out, data, sizeof(Quote));
+        return ARGENTUM_OK;
+    }
+};
+
+using QuoteTopic = argentum::bus::Topic<Quote, CountingQuoteCodec>;
+
+// Same wire size as Quote, so one byte message decodes as either type.
+struct Level {
+    uint64_t id;
+    int64_t price_ticks;
+    int64_t quantity_lots;
+};
+
+std::atomic<int> g_level_decodes{0};
+
+struct CountingLevelCodec {
+    static ArgentumStatus encode(const Level& level, std::vector<uint8_t>* out) {
+        out->resize(sizeof(level));
+        std::memcpy(out->data(), &level, sizeof(level));
+        return ARGENTUM_OK;
+    }
+    static ArgentumStatus decode(const void* data, size_t size, Level* out) {
+        g_level_decodes.fetch_add(1);
+        if (size != sizeof(Level)) return ARGENTUM_ERR_PROTO;
+        std::memcpy(out, data, sizeof(Level));
+        return ARGENTUM_OK;
+    }
+};
+
+using LevelTopic = argentum::bus::Topic<Level, CountingLevelCodec>;
+
+bool wait_until(const std::atomic<int>& value, int expected) {
+    for (int i = 0; i < 2000; ++i) {
+        if (value.load() >= expected) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+} // namespace
+
+int main() {
+    auto bus = argentum::bus::create_inproc_bus(argentum::bus::InprocBusConfig{});
+
+    // Typed publish to typed subscribers: no serialization, every subscriber sees the same object.
+    QuoteTopic quotes(bus, "quotes.typed");
+    std::atomic<int> received{0};
+    std::atomic<const Quote*> first_addr{nullptr};
+    std::atomic<const Quote*> second_addr{nullptr};
+    quotes.subscribe([&](const Quote& q) {
+        assert(q.bid_ticks == 100 && q.ask_ticks == 101);
+        first_addr.store(&q);
+        received.fetch_add(1);
+    });
+    quotes.subscribe([&](const Quote& q) {
+        second_addr.store(&q);
+        received.fetch_add(1);
+    });
+    assert(quotes.publish(Quote{1, 100, 101}) == ARGENTUM_OK);
+    assert(wait_until(received, 2));
+    assert(first_addr.load() == second_addr.load());
+    assert(g_encodes.load() == 0);
+    assert(g_decodes.load() == 0);
+
+    // A byte subscriber on the same topic triggers exactly one encode per message.
+    std::atomic<int> raw_received{0};
+    bus->subscribe("quotes.typed", [&](const void*, size_t size) {
+        assert(size == sizeof(Quote));
+        raw_received.fetch_add(1);
+    });
+    bus->subscribe("quotes.typed", [&](const void*, size_t) { raw_received.fetch_add(1); });
+    assert(quotes.publish(Quote{2, 100, 101}) == ARGENTUM_OK);
+    assert(wait_until(raw_received, 2));
+    assert(wait_until(received, 4));
+    assert(g_encodes.load() == 1);
+    assert(g_decodes.load() == 0);
+
+    // Byte publish to typed subscribers: decoded once, shared by both.
+    QuoteTopic wire(bus, "quotes.wire");
+    std::atomic<int> wire_received{0};
+    std::atomic<int> decode_errors{0};
+    auto on_error = [&](ArgentumStatus status) {
+        assert(status == ARGENTUM_ERR_PROTO);
+        decode_errors.fetch_add(1);
+    };
+    wire.subscribe([&](const Quote& q) { assert(q.id == 3); wire_received.fetch_add(1); }, on_error);
+    wire.subscribe([&](const Quote& q) { assert(q.id == 3); wire_received.fetch_add(1); }, on_error);
+    const Quote raw_quote{3, 5, 6};
+    assert(bus->publish("quotes.wire", &raw_quote, sizeof(raw_quote)) == ARGENTUM_OK);
+    assert(wait_until(wire_received, 2));
+    assert(g_decodes.load() == 1);
+
+    const uint8_t garbage[3] = {1, 2, 3};
+    assert(bus->publish("quotes.wire", garbage, sizeof(garbage)) == ARGENTUM_OK);
+    assert(wait_until(decode_errors, 2));
+    assert(g_decodes.load() == 2);
+
+    // Interleaved value types (Quote, Level, Quote) still decode once per type.
+    QuoteTopic mixed_quotes(bus, "quotes.mixed");
+    LevelTopic mixed_levels(bus, "quotes.mixed");
+    std::atomic<int> mixed_received{0};
+    mixed_quotes.subscribe([&](const Quote& q) { assert(q.id == 4); mixed_received.fetch_add(1); });
+    mixed_levels.subscribe([&](const Level& l) { assert(l.id == 4 && l.price_ticks == 8); mixed_received.fetch_add(1); });
+    mixed_quotes.subscribe([&](const Quote& q) { assert(q.id == 4); mixed_received.fetch_add(1); });
+    const int mixed_decodes_before = g_decodes.load();
+    const Quote mixed_quote{4, 8, 9};
+    assert(bus->publish("quotes.mixed", &mixed_quote, sizeof(mixed_quote)) == ARGENTUM_OK);
+    assert(wait_until(mixed_received, 3));
+    assert(g_decodes.load() == mixed_decodes_before + 1);
+    assert(g_level_decodes.load() == 1);
+
+    // MarketTick uses the codec trait from market_tick_codec.hpp.
+    argentum::bus::MarketTickTopic ticks(bus, "market.ticks");
+    std::atomic<int> tick_count{0};
+    ticks.subscribe([&](const MarketTick& tick) {
+        assert(std::strcmp(tick.symbol, "EUR/USD") == 0);
+        tick_count.fetch_add(1);
+    });
+    std::atomic<int> tick_bytes{0};
+    bus->subscribe("market.ticks", [&](const void* data, size_t size) {
+        MarketTick decoded{};
+        assert(argentum::codec::decode_market_tick(data, size, &decoded) == ARGENTUM_OK);
+        assert(decoded.price == 1.0850);
+        tick_bytes.fetch_add(1);
+    });
+    MarketTick tick{};
+    tick.price = 1.0850;
+    std::memcpy(tick.symbol, "EUR/USD", 8);
+    assert(ticks.publish(tick) == ARGENTUM_OK);
+    assert(wait_until(tick_count, 1));
+    assert(wait_until(tick_bytes, 1));
+
+    // Shared-memory transport: bytes cross the mapping, decoded once for both typed subscribers.
+    argentum::bus::ShmBusConfig shm_config;
+    shm_config.region_name = "argentum_typed_topic_test";
+    shm_config.slots_per_topic = 8;
+    shm_config.slot_payload_bytes = 64;
+    shm_config.reset_existing = true;
+    shm_config.unlink_on_close = true;
+    auto shm_pub = argentum::bus::create_shm_bus(shm_config);
+    if (shm_pub) {
+        argentum::bus::ShmBusConfig attach;
+        attach.region_name = shm_config.region_name;
+        auto shm_sub = argentum::bus::create_shm_bus(attach);
+        assert(shm_sub);
+        QuoteTopic shm_quotes_sub(shm_sub, "quotes.shm");
+        std::atomic<int> shm_received{0};
+        shm_quotes_sub.subscribe([&](const Quote& q) { assert(q.id == 7); shm_received.fetch_add(1); });
+        shm_quotes_sub.subscribe([&](const Quote& q) { assert(q.id == 7); shm_received.fetch_add(1); });
+
+        const int decodes_before = g_decodes.load();
+        QuoteTopic shm_quotes_pub(shm_pub, "quotes.shm");
+        assert(shm_quotes_pub.publish(Quote{7, 1, 2}) == ARGENTUM_OK);
+        assert(wait_until(shm_received, 2));
+        assert(g_decodes.load() == decodes_before + 1);
+    }
+
+    return 0;
+}
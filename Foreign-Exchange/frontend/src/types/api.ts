@@ -33,4 +33,5 @@ export interface HealthResponse {
   auth_failures?: number;
   rate_limited?: number;
   tracked_symbols?: number;
+  unknown_symbol_ticks?: number;
 }